@@ -488,6 +488,16 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("bn_mod_inv") {
+		bn_rand(a, BN_POS, BN_BITS);
+		bn_rand(b, BN_POS, BN_BITS);
+		if (bn_is_even(b)) {
+			bn_add_dig(b, b, 1);
+		}
+		BENCH_ADD(bn_mod_inv(c, a, b));
+	}
+	BENCH_END;
+
 #if BN_MOD == BASIC || !defined(STRIP)
 	BENCH_BEGIN("bn_mod_basic") {
 		bn_rand(a, BN_POS, 2 * BN_BITS - BN_DIGIT / 2);
@@ -653,6 +663,15 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+#if BN_MXP == FIXED || !defined(STRIP)
+	BENCH_BEGIN("bn_mxp_fixed") {
+		bn_rand(a, BN_POS, 2 * BN_BITS - BN_DIGIT / 2);
+		bn_mod(a, a, b);
+		BENCH_ADD(bn_mxp_fixed(c, a, b, b));
+	}
+	BENCH_END;
+#endif
+
 	BENCH_BEGIN("bn_mxp_dig") {
 		bn_rand(a, BN_POS, BN_BITS);
 		bn_rand(d, BN_POS, BN_DIGIT);
@@ -804,6 +823,8 @@ static void arith(void) {
 
 	BENCH_ONCE("bn_is_prime_solov", bn_is_prime_solov(a));
 
+	BENCH_ONCE("bn_is_prime_bpsw", bn_is_prime_bpsw(a));
+
 	bn_rand(a, BN_POS, BN_BITS);
 
 	BENCH_ONCE("bn_factor", bn_factor(c, a));
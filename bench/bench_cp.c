@@ -87,6 +87,17 @@ static void rsa(void) {
 		cp_rsa_enc(out, &out_len, in, sizeof(in), pub);
 		BENCH_ADD(cp_rsa_dec_quick(new, &new_len, out, out_len, prv));
 	} BENCH_END;
+
+	BENCH_ONCE("cp_rsa_gen_multi",
+			cp_rsa_gen_multi(pub, prv, BN_BITS, CP_RSA_PRIMES));
+
+	BENCH_BEGIN("cp_rsa_dec_quick (multi-prime)") {
+		out_len = BN_BITS / 8 + 1;
+		new_len =out_len;
+		rand_bytes(in, sizeof(in));
+		cp_rsa_enc(out, &out_len, in, sizeof(in), pub);
+		BENCH_ADD(cp_rsa_dec_quick(new, &new_len, out, out_len, prv));
+	} BENCH_END;
 #endif
 
 	BENCH_ONCE("cp_rsa_gen", cp_rsa_gen(pub, prv, BN_BITS));
@@ -658,6 +669,14 @@ static void bgn(void) {
 		BENCH_ADD(cp_bgn_dec1(&in, c, prv));
 	} BENCH_END;
 
+	BENCH_BEGIN("cp_bgn_dec1 (10^6)") {
+		in = 1000000;
+		cp_bgn_enc1(c, in, pub);
+		BENCH_ADD(cp_bgn_dec1(&in, c, prv));
+	} BENCH_END;
+
+	in = 10;
+
 	BENCH_BEGIN("cp_bgn_enc2") {
 		BENCH_ADD(cp_bgn_enc2(d, in, pub));
 		cp_bgn_dec2(&in, d, prv);
@@ -692,9 +711,10 @@ static void bgn(void) {
 }
 
 static void bls(void) {
-	uint8_t msg[5] = { 0, 1, 2, 3, 4 };
-	g1_t s;
-	g2_t p;
+	uint8_t msg[5] = { 0, 1, 2, 3, 4 }, _m[8][5], *msgs[8];
+	int lens[8], ver[8];
+	g1_t s, sigs[8];
+	g2_t p, qs[8];
 	bn_t d;
 
 	g1_null(s);
@@ -704,6 +724,12 @@ static void bls(void) {
 	g1_new(s);
 	g2_new(p);
 	bn_new(d);
+	for (int i = 0; i < 8; i++) {
+		g1_null(sigs[i]);
+		g2_null(qs[i]);
+		g1_new(sigs[i]);
+		g2_new(qs[i]);
+	}
 
 	BENCH_BEGIN("cp_bls_gen") {
 		BENCH_ADD(cp_bls_gen(d, p));
@@ -720,9 +746,37 @@ static void bls(void) {
 	}
 	BENCH_END;
 
+	for (int i = 0; i < 8; i++) {
+		memcpy(_m[i], msg, sizeof(msg));
+		_m[i][0] = i;
+		msgs[i] = _m[i];
+		lens[i] = sizeof(msg);
+		cp_bls_gen(d, qs[i]);
+		cp_bls_sig(sigs[i], msgs[i], lens[i], d);
+	}
+
+	BENCH_BEGIN("cp_bls_agg (n = 8)") {
+		BENCH_ADD(cp_bls_agg(s, sigs, 8));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("cp_bls_ver_agg (n = 8)") {
+		BENCH_ADD(cp_bls_ver_agg(s, msgs, lens, qs, 8));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("cp_bls_ver_batch (n = 8)") {
+		BENCH_ADD(cp_bls_ver_batch(ver, sigs, msgs, lens, qs, 8));
+	}
+	BENCH_END;
+
 	g1_free(s);
 	bn_free(d);
 	g2_free(p);
+	for (int i = 0; i < 8; i++) {
+		g1_free(sigs[i]);
+		g2_free(qs[i]);
+	}
 }
 
 static void bbs(void) {
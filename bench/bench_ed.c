@@ -426,6 +426,40 @@ static void arith(void) {
 		BENCH_ADD(ed_upk(q, p));
 	} BENCH_END;
 
+	BENCH_BEGIN("ed_norm_bat (n = 256)") {
+		ed_t _p[256], _q[256];
+		for (int i = 0; i < 256; i++) {
+			ed_null(_p[i]);
+			ed_null(_q[i]);
+			ed_new(_p[i]);
+			ed_new(_q[i]);
+			ed_rand(_p[i]);
+			ed_dbl(_p[i], _p[i]);
+		}
+		BENCH_ADD(ed_norm_bat(_q, (const ed_t *)_p, 256, NULL));
+		for (int i = 0; i < 256; i++) {
+			ed_free(_p[i]);
+			ed_free(_q[i]);
+		}
+	} BENCH_END;
+
+	BENCH_BEGIN("ed_upk_bat (n = 256)") {
+		ed_t _p[256], _q[256];
+		for (int i = 0; i < 256; i++) {
+			ed_null(_p[i]);
+			ed_null(_q[i]);
+			ed_new(_p[i]);
+			ed_new(_q[i]);
+			ed_rand(_p[i]);
+			ed_pck(_p[i], _p[i]);
+		}
+		BENCH_ADD(ed_upk_bat(_q, (const ed_t *)_p, 256, NULL));
+		for (int i = 0; i < 256; i++) {
+			ed_free(_p[i]);
+			ed_free(_q[i]);
+		}
+	} BENCH_END;
+
 	ed_free(p);
 	ed_free(q);
 	ed_free(r);
@@ -559,12 +559,63 @@ static void arith(void) {
 		BENCH_ADD(ep_mul_sim_gen(r, k, q, l));
 	} BENCH_END;
 
+	BENCH_BEGIN("ep_mul_sim_lot (n = 16)") {
+		ep_t _p[16];
+		bn_t _k[16];
+		for (int i = 0; i < 16; i++) {
+			ep_null(_p[i]);
+			bn_null(_k[i]);
+			ep_new(_p[i]);
+			bn_new(_k[i]);
+			ep_rand(_p[i]);
+			bn_rand_mod(_k[i], n);
+		}
+		BENCH_ADD(ep_mul_sim_lot(r, (const ep_t *)_p, (const bn_t *)_k, 16));
+		for (int i = 0; i < 16; i++) {
+			ep_free(_p[i]);
+			bn_free(_k[i]);
+		}
+	} BENCH_END;
+
+	BENCH_BEGIN("ep_mul_sim_lot (n = 256)") {
+		ep_t _p[256];
+		bn_t _k[256];
+		for (int i = 0; i < 256; i++) {
+			ep_null(_p[i]);
+			bn_null(_k[i]);
+			ep_new(_p[i]);
+			bn_new(_k[i]);
+			ep_rand(_p[i]);
+			bn_rand_mod(_k[i], n);
+		}
+		BENCH_ADD(ep_mul_sim_lot(r, (const ep_t *)_p, (const bn_t *)_k, 256));
+		for (int i = 0; i < 256; i++) {
+			ep_free(_p[i]);
+			bn_free(_k[i]);
+		}
+	} BENCH_END;
+
 	BENCH_BEGIN("ep_map") {
 		uint8_t msg[5];
 		rand_bytes(msg, 5);
 		BENCH_ADD(ep_map(p, msg, 5));
 	} BENCH_END;
 
+	BENCH_BEGIN("ep_map_basic") {
+		uint8_t msg[5];
+		rand_bytes(msg, 5);
+		BENCH_ADD(ep_map_basic(p, msg, 5));
+	} BENCH_END;
+
+	if (ep_curve_opt_b() != OPT_ZERO &&
+			(ep_curve_opt_a() != OPT_ZERO || ep_curve_is_endom())) {
+		BENCH_BEGIN("ep_map_swu") {
+			uint8_t msg[5];
+			rand_bytes(msg, 5);
+			BENCH_ADD(ep_map_swu(p, msg, 5));
+		} BENCH_END;
+	}
+
 	BENCH_BEGIN("ep_pck") {
 		ep_rand(p);
 		BENCH_ADD(ep_pck(q, p));
@@ -575,6 +626,23 @@ static void arith(void) {
 		BENCH_ADD(ep_upk(q, p));
 	} BENCH_END;
 
+	BENCH_BEGIN("ep_norm_bat (n = 256)") {
+		ep_t _p[256], _q[256];
+		for (int i = 0; i < 256; i++) {
+			ep_null(_p[i]);
+			ep_null(_q[i]);
+			ep_new(_p[i]);
+			ep_new(_q[i]);
+			ep_rand(_p[i]);
+			ep_dbl(_p[i], _p[i]);
+		}
+		BENCH_ADD(ep_norm_bat(_q, (const ep_t *)_p, 256, NULL));
+		for (int i = 0; i < 256; i++) {
+			ep_free(_p[i]);
+			ep_free(_q[i]);
+		}
+	} BENCH_END;
+
 	ep_free(p);
 	ep_free(q);
 	ep_free(r);
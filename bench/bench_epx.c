@@ -345,6 +345,20 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("ep2_mul_basic") {
+		bn_rand_mod(k, n);
+		BENCH_ADD(ep2_mul_basic(q, p, k));
+	}
+	BENCH_END;
+
+#if EP2_MUL == LWNAF || !defined(STRIP)
+	BENCH_BEGIN("ep2_mul_lwnaf") {
+		bn_rand_mod(k, n);
+		BENCH_ADD(ep2_mul_lwnaf(q, p, k));
+	}
+	BENCH_END;
+#endif
+
 	BENCH_BEGIN("ep2_mul_gen") {
 		bn_rand_mod(k, n);
 		BENCH_ADD(ep2_mul_gen(q, k));
@@ -566,6 +580,40 @@ static void arith(void) {
 		BENCH_ADD(ep2_upk(q, p));
 	} BENCH_END;	
 
+	BENCH_BEGIN("ep2_norm_bat (n = 256)") {
+		ep2_t _p[256], _q[256];
+		for (int i = 0; i < 256; i++) {
+			ep2_null(_p[i]);
+			ep2_null(_q[i]);
+			ep2_new(_p[i]);
+			ep2_new(_q[i]);
+			ep2_rand(_p[i]);
+			ep2_dbl(_p[i], _p[i]);
+		}
+		BENCH_ADD(ep2_norm_bat(_q, _p, 256, NULL));
+		for (int i = 0; i < 256; i++) {
+			ep2_free(_p[i]);
+			ep2_free(_q[i]);
+		}
+	} BENCH_END;
+
+	BENCH_BEGIN("ep2_upk_bat (n = 256)") {
+		ep2_t _p[256], _q[256];
+		for (int i = 0; i < 256; i++) {
+			ep2_null(_p[i]);
+			ep2_null(_q[i]);
+			ep2_new(_p[i]);
+			ep2_new(_q[i]);
+			ep2_rand(_p[i]);
+			ep2_pck(_p[i], _p[i]);
+		}
+		BENCH_ADD(ep2_upk_bat(_q, _p, 256, NULL));
+		for (int i = 0; i < 256; i++) {
+			ep2_free(_p[i]);
+			ep2_free(_q[i]);
+		}
+	} BENCH_END;
+
 	ep2_free(p);
 	ep2_free(q);
 	ep2_free(r);
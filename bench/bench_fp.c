@@ -503,6 +503,14 @@ static void arith(void) {
 	BENCH_END;
 #endif
 
+#if FP_INV == DIVST || !defined(STRIP)
+	BENCH_BEGIN("fp_inv_divst") {
+		fp_rand(a);
+		BENCH_ADD(fp_inv_divst(c, a));
+	}
+	BENCH_END;
+#endif
+
 #if FP_INV == LOWER || !defined(STRIP)
 	BENCH_BEGIN("fp_inv_lower") {
 		fp_rand(a);
@@ -559,6 +567,12 @@ static void arith(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("fp_is_sqr") {
+		fp_rand(a);
+		BENCH_ADD(fp_is_sqr(a));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("fp_prime_conv") {
 		bn_rand(e, BN_POS, FP_BITS);
 		BENCH_ADD(fp_prime_conv(a, e));
@@ -1308,6 +1308,14 @@ static void arith12(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("fp12_exp_cyc_gls") {
+		fp12_rand(a);
+		pp_exp_k12(a, a);
+		bn_rand(e, BN_POS, FP_BITS);
+		BENCH_ADD(fp12_exp_cyc_gls(c, a, e));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("fp12_exp_cyc_sps (param)") {
 		int l = MAX_TERMS + 1, k[MAX_TERMS + 1];
 		fp_param_get_sps(k, &l);
@@ -250,6 +250,27 @@ static void arith1(void) {
 		BENCH_ADD(g1_map(p, msg, 5));
 	} BENCH_END;
 
+	BENCH_BEGIN("g1_dlog_pre (1024)") {
+		pc_dlog_t d;
+		pc_dlog_null(d);
+		pc_dlog_new(d);
+		g1_rand(p);
+		BENCH_ADD(g1_dlog_pre(d, p, 1024));
+		pc_dlog_free(d);
+	} BENCH_END;
+
+	BENCH_BEGIN("g1_dlog (1024, 10^6)") {
+		dig_t m;
+		pc_dlog_t d;
+		pc_dlog_null(d);
+		pc_dlog_new(d);
+		g1_rand(p);
+		g1_dlog_pre(d, p, 1024);
+		g1_mul_dig(q, p, 1000000);
+		BENCH_ADD(g1_dlog(&m, d, p, q, 1 << 20));
+		pc_dlog_free(d);
+	} BENCH_END;
+
 	g1_free(p);
 	g1_free(q);
 	bn_free(k);
@@ -627,6 +648,7 @@ static void arith(void) {
 	BENCH_BEGIN("gt_exp") {
 		gt_rand(a);
 		g1_get_ord(d);
+		bn_rand(d, BN_POS, bn_bits(d));
 		BENCH_ADD(gt_exp(c, a, d));
 	}
 	BENCH_END;
@@ -638,13 +660,17 @@ static void arith(void) {
 }
 
 static void pairing(void) {
-	g1_t p;
-	g2_t q;
+	g1_t p, _p[2];
+	g2_t q, _q[2];
 	gt_t r;
 
 	g1_new(p);
 	g2_new(q);
 	gt_new(r);
+	for (int i = 0; i < 2; i++) {
+		g1_new(_p[i]);
+		g2_new(_q[i]);
+	}
 
 	BENCH_BEGIN("pc_map") {
 		g1_rand(p);
@@ -653,6 +679,15 @@ static void pairing(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("pc_map_sim (m = 2)") {
+		for (int i = 0; i < 2; i++) {
+			g1_rand(_p[i]);
+			g2_rand(_q[i]);
+		}
+		BENCH_ADD(pc_map_sim(r, _p, _q, 2));
+	}
+	BENCH_END;
+
 	BENCH_BEGIN("pc_exp") {
 		gt_rand(r);
 		BENCH_ADD(pc_exp(r, r));
@@ -662,6 +697,10 @@ static void pairing(void) {
 	g1_free(p);
 	g2_free(q);	
 	gt_free(r);	
+	for (int i = 0; i < 2; i++) {
+		g1_free(_p[i]);
+		g2_free(_q[i]);
+	}
 }
 
 int main(void) {
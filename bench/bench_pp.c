@@ -185,8 +185,9 @@ static void pairing2(void) {
 
 static void pairing12(void) {
 	bn_t k, n, l;
-	ep2_t p, r;
-	ep_t q;
+	ep2_t p, r, _p[2];
+	ep_t q, _q[2];
+	fp2_t t[PP_TABLE];
 	fp12_t e;
 
 	ep2_null(p);
@@ -204,6 +205,14 @@ static void pairing12(void) {
 	ep2_new(r);
 	ep_new(q);
 	fp12_new(e);
+	for (int i = 0; i < PP_TABLE; i++) {
+		fp2_null(t[i]);
+		fp2_new(t[i]);
+	}
+	for (int i = 0; i < 2; i++) {
+		ep2_new(_p[i]);
+		ep_new(_q[i]);
+	}
 
 	ep2_curve_get_ord(n);
 
@@ -313,6 +322,15 @@ static void pairing12(void) {
 	}
 	BENCH_END;
 
+	BENCH_BEGIN("pp_map_sim_k12 (m = 2)") {
+		for (int i = 0; i < 2; i++) {
+			ep2_rand(_p[i]);
+			ep_rand(_q[i]);
+		}
+		BENCH_ADD(pp_map_sim_k12(e, _q, _p, 2));
+	}
+	BENCH_END;
+
 #if PP_MAP == TATEP || !defined(STRIP)
 	BENCH_BEGIN("pp_map_tatep_k12") {
 		ep2_rand(p);
@@ -338,6 +356,20 @@ static void pairing12(void) {
 		BENCH_ADD(pp_map_oatep_k12(e, q, p));
 	}
 	BENCH_END;
+
+	BENCH_BEGIN("pp_map_pre_oatep_k12") {
+		ep2_rand(p);
+		BENCH_ADD(pp_map_pre_oatep_k12(t, p));
+	}
+	BENCH_END;
+
+	BENCH_BEGIN("pp_map_fix_oatep_k12") {
+		ep2_rand(p);
+		ep_rand(q);
+		pp_map_pre_oatep_k12(t, p);
+		BENCH_ADD(pp_map_fix_oatep_k12(e, q, t));
+	}
+	BENCH_END;
 #endif
 
 	bn_free(k);
@@ -347,6 +379,13 @@ static void pairing12(void) {
 	ep2_free(r);
 	ep_free(q);
 	fp12_free(e);
+	for (int i = 0; i < 2; i++) {
+		ep2_free(_p[i]);
+		ep_free(_q[i]);
+	}
+	for (int i = 0; i < PP_TABLE; i++) {
+		fp2_free(t[i]);
+	}
 }
 
 int main(void) {
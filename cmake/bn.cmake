@@ -6,7 +6,8 @@ message("      BN_PRECI=n        The base precision in bits. Let w be n in words
 message("      BN_MAGNI=DOUBLE   A multiple precision integer can store 2w words.")
 message("      BN_MAGNI=CARRY    A multiple precision integer can store w+1 words.")
 message("      BN_MAGNI=SINGLE   A multiple precision integer can store w words.")
-message("      BN_KARAT=n        The number of Karatsuba steps.\n")
+message("      BN_KARAT=n        The number of Karatsuba steps.")
+message("      BN_SMALL=[off|on] Store small integers inline and grow larger ones on the heap.\n")
 
 message("   ** Available multiple precision arithmetic methods (default = COMBA;COMBA;MONTY;SLIDE;STEIN;BASIC):\n")
 
@@ -28,7 +29,8 @@ message("      BN_METHD=RADIX    Diminished radix modular reduction.\n")
 message("      Modular exponentiation:")
 message("      BN_METHD=BASIC    Binary modular exponentiation.")
 message("      BN_METHD=MONTY    Montgomery powering ladder.")
-message("      BN_METHD=SLIDE    Sliding window modular exponentiation.\n")
+message("      BN_METHD=SLIDE    Sliding window modular exponentiation.")
+message("      BN_METHD=FIXED    Constant-time fixed window modular exponentiation.\n")
 
 message("      Greatest Common Divisor:")
 message("      BN_METHD=BASIC    Euclid's standard GCD algorithm.")
@@ -57,6 +59,8 @@ if (NOT BN_MAGNI)
 endif(NOT BN_MAGNI)
 set(BN_MAGNI ${BN_MAGNI} CACHE STRING "Effective size in words")
 
+option(BN_SMALL "Store small integers inline and grow larger ones on the heap" off)
+
 # Choose the arithmetic methods.
 if (NOT BN_METHD)
 	set(BN_METHD "COMBA;COMBA;MONTY;SLIDE;BASIC;BASIC")
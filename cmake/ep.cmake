@@ -34,6 +34,17 @@ message("      EP_METHD=TRICK    Shamir's trick for simultaneous multiplication.
 message("      EP_METHD=INTER    Interleaving of window NAFs (GLV for Koblitz curves).")
 message("      EP_METHD=JOINT    Joint sparse form.\n")
 
+message("   ** Available point multiplication methods over extensions (default = LWNAF):\n")
+
+message("      EP2_MUL=BASIC     Binary method.")
+message("      EP2_MUL=LWNAF     Left-to-right window NAF method (GLS for BN curves).\n")
+
+message("   ** Available methods for hashing to prime curves (default = BASIC):\n")
+
+message("      EP_MAP=BASIC      Try-and-increment method.")
+message("      EP_MAP=SWU        Shallue-van de Woestijne-Ulas encodings with a fixed number of operations.")
+message("                        Changes the point assigned to each message.\n")
+
 if (NOT EP_DEPTH)
 	set(EP_DEPTH 4)
 endif(NOT EP_DEPTH)	
@@ -63,3 +74,15 @@ list(GET EP_METHD 1 EP_MUL)
 list(GET EP_METHD 2 EP_FIX)
 list(GET EP_METHD 3 EP_SIM)
 set(EP_METHD ${EP_METHD} CACHE STRING "Method for prime elliptic curve arithmetic.")
+
+# Choose the point multiplication method for curves over extensions.
+if (NOT EP2_MUL)
+	set(EP2_MUL "LWNAF")
+endif(NOT EP2_MUL)
+set(EP2_MUL ${EP2_MUL} CACHE STRING "Method for point multiplication on prime elliptic curves over extensions.")
+
+# Choose the method for hashing to prime curves.
+if (NOT EP_MAP)
+	set(EP_MAP "BASIC")
+endif(NOT EP_MAP)
+set(EP_MAP ${EP_MAP} CACHE STRING "Method for hashing to prime elliptic curves.")
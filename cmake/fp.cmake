@@ -8,7 +8,7 @@ message("      FP_PMERS=[off|on] Prefer Pseudo-Mersenne primes over random prime
 message("      FP_QNRES=[off|on] Use -1 as quadratic non-residue (make sure that p = 3 mod 8).")
 message("      FP_WIDTH=w        Width w in [2,6] of window processing for exponentiation methods.\n")
 
-message("   ** Available prime field arithmetic methods (default = BASIC;COMBA;COMBA;MONTY;MONTY;SLIDE):")
+message("   ** Available prime field arithmetic methods (default = BASIC;COMBA;COMBA;MONTY;DIVST;SLIDE):")
 
 message("      Field addition")
 message("      FP_METHD=BASIC    Schoolbook addition.")
@@ -35,6 +35,7 @@ message("      FP_METHD=BASIC    Inversion by Fermat's Little Theorem.")
 message("      FP_METHD=BINAR    Binary Inversion algorithm.")
 message("      FP_METHD=MONTY    Mntgomery inversion.")
 message("      FP_METHD=EXGCD    Inversion by the Extended Euclidean algorithm.")
+message("      FP_METHD=DIVST    Constant-time inversion by Bernstein-Yang divsteps.")
 message("      FP_METHD=LOWER    Pass inversion to the lower level.\n")
 
 message("      Field exponentiation")
@@ -64,7 +65,7 @@ option(FP_QNRES "Use -1 as quadratic non-residue." off)
 
 # Choose the arithmetic methods.
 if (NOT FP_METHD)
-	set(FP_METHD "BASIC;COMBA;COMBA;MONTY;MONTY;SLIDE")
+	set(FP_METHD "BASIC;COMBA;COMBA;MONTY;DIVST;SLIDE")
 endif(NOT FP_METHD)
 list(LENGTH FP_METHD FP_LEN)
 if (FP_LEN LESS 6)
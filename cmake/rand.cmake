@@ -2,6 +2,7 @@ message(STATUS "Available pseudo-random number generators (default = HASH):\n")
 
 message("   RAND=HASH      Use the HASH-DRBG generator. (recommended)")
 message("   RAND=HMAC      Use the HMAC-DRBG generator. (recommended)")
+message("   RAND=CTR       Use the CTR-DRBG generator with AES. (recommended)")
 message("   RAND=UDEV      Use the operating system underlying generator.")
 message("   RAND=FIPS      Use the FIPS 186-2 (CN1) SHA1-based generator.")
 message("   RAND=CALL      Override the generator with a callback.\n")
@@ -71,7 +71,7 @@
 #define DV_DIGS	DV_FP
 #endif
 
-#if BN_SIZE > DV_DIGS
+#if BN_SIZE > DV_DIGS && !defined(BN_SMALL)
 #undef DV_DIGS
 #define DV_DIGS BN_SIZE
 #endif
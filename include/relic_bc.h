@@ -53,31 +53,118 @@
 /*============================================================================*/
 
 /**
- * Encrypts with AES in CBC mode.
- * 
+ * Enables or disables the use of AES-NI and the carry-less multiplier. When
+ * disabled, the portable constant-time engine is used even if the processor
+ * supports the extensions, which allows testing both engines on the same
+ * machine. The setting is global and must not change while another thread
+ * uses the module. Keys are expanded on every call, so the setting takes
+ * effect immediately.
+ *
+ * @param[in] on			- 1 to use the extensions when available, 0 otherwise.
+ */
+void bc_aes_ext(int on);
+
+/**
+ * Encrypts with AES in CBC mode and PKCS#7 padding. The input and output
+ * buffers may be the same.
+ *
  * @param[out] out			- the resulting ciphertext.
  * @param[in,out] out_len	- the buffer capacity and number of bytes written.
  * @param[in] in			- the bytes to be encrypted.
  * @param[in] in_len		- the number of bytes to encrypt.
  * @param[in] key			- the key.
- * @param[in] key_len		- the key size in bytes.
+ * @param[in] key_len		- the key size in bits.
+ * @param[in] iv			- the initialization vector.
  * @return STS_OK if no errors occurred, STS_ERR otherwise.
  */
 int bc_aes_cbc_enc(uint8_t *out, int *out_len, uint8_t *in,
 		int in_len, uint8_t *key, int key_len, uint8_t *iv);
 
 /**
- * Decrypts with AES in CBC mode.
+ * Decrypts with AES in CBC mode and PKCS#7 padding. Blocks are decrypted in
+ * parallel and the input and output buffers may be the same.
  *
  * @param[out] out			- the resulting plaintext.
  * @param[in,out] out_len	- the buffer capacity and number of bytes written.
  * @param[in] in			- the bytes to be decrypted.
  * @param[in] in_len		- the number of bytes to decrypt.
  * @param[in] key			- the key.
- * @param[in] key_len		- the key size in bytes.
+ * @param[in] key_len		- the key size in bits.
+ * @param[in] iv			- the initialization vector.
  * @return STS_OK if no errors occurred, STS_ERR otherwise.
  */
 int bc_aes_cbc_dec(uint8_t *out, int *out_len, uint8_t *in,
 		int in_len, uint8_t *key, int key_len, uint8_t *iv);
 
+/**
+ * Encrypts with AES in CTR mode. The counter block is incremented as a 128-bit
+ * big-endian integer and the input and output buffers may be the same.
+ *
+ * @param[out] out			- the resulting ciphertext.
+ * @param[in,out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in] in			- the bytes to be encrypted.
+ * @param[in] in_len		- the number of bytes to encrypt.
+ * @param[in] key			- the key.
+ * @param[in] key_len		- the key size in bits.
+ * @param[in] iv			- the initial counter block.
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+int bc_aes_ctr_enc(uint8_t *out, int *out_len, uint8_t *in,
+		int in_len, uint8_t *key, int key_len, uint8_t *iv);
+
+/**
+ * Decrypts with AES in CTR mode.
+ *
+ * @param[out] out			- the resulting plaintext.
+ * @param[in,out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in] in			- the bytes to be decrypted.
+ * @param[in] in_len		- the number of bytes to decrypt.
+ * @param[in] key			- the key.
+ * @param[in] key_len		- the key size in bits.
+ * @param[in] iv			- the initial counter block.
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+int bc_aes_ctr_dec(uint8_t *out, int *out_len, uint8_t *in,
+		int in_len, uint8_t *key, int key_len, uint8_t *iv);
+
+/**
+ * Encrypts and authenticates with AES in GCM mode. The ciphertext is followed
+ * by a tag of BC_LEN bytes and the input and output buffers may be the same.
+ *
+ * @param[out] out			- the resulting ciphertext and tag.
+ * @param[in,out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in] in			- the bytes to be encrypted.
+ * @param[in] in_len		- the number of bytes to encrypt.
+ * @param[in] key			- the key.
+ * @param[in] key_len		- the key size in bits.
+ * @param[in] iv			- the initialization vector.
+ * @param[in] iv_len		- the number of bytes in the initialization vector.
+ * @param[in] aad			- the additional data to authenticate.
+ * @param[in] aad_len		- the number of bytes of additional data.
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+int bc_aes_gcm_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		uint8_t *key, int key_len, uint8_t *iv, int iv_len, uint8_t *aad,
+		int aad_len);
+
+/**
+ * Verifies and decrypts with AES in GCM mode. Nothing is written if the tag
+ * is not valid.
+ *
+ * @param[out] out			- the resulting plaintext.
+ * @param[in,out] out_len	- the buffer capacity and number of bytes written.
+ * @param[in] in			- the ciphertext followed by the tag.
+ * @param[in] in_len		- the number of bytes in the ciphertext and tag.
+ * @param[in] key			- the key.
+ * @param[in] key_len		- the key size in bits.
+ * @param[in] iv			- the initialization vector.
+ * @param[in] iv_len		- the number of bytes in the initialization vector.
+ * @param[in] aad			- the additional data to authenticate.
+ * @param[in] aad_len		- the number of bytes of additional data.
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+int bc_aes_gcm_dec(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		uint8_t *key, int key_len, uint8_t *iv, int iv_len, uint8_t *aad,
+		int aad_len);
+
 #endif /* !RELIC_BC_H */
@@ -84,6 +84,16 @@
 #define BN_SIZE		((int)BN_DIGS)
 #endif
 
+#ifdef BN_SMALL
+/**
+ * Size in digits of the buffer stored inside a multiple precision integer.
+ * It holds the product of two prime or binary field elements, so curve and
+ * pairing arithmetic never reaches the heap.
+ */
+#define BN_SMALL_DIGS	((int)(2 * (((FP_PRIME > FB_POLYN ? FP_PRIME : FB_POLYN)	\
+		+ BN_DIGIT - 1) / BN_DIGIT) + 2))
+#endif
+
 /**
  * Positive sign of a multiple precision integer.
  */
@@ -112,9 +122,13 @@ typedef struct {
 	int used;
 	/** The sign of this multiple precision integer. */
 	int sign;
-#if ALLOC == DYNAMIC || ALLOC == STATIC
+#if ALLOC == DYNAMIC || ALLOC == STATIC || defined(BN_SMALL)
 	/** The sequence of contiguous digits that forms this integer. */
 	dig_t *dp;
+#endif
+#ifdef BN_SMALL
+	/** The inline digits, used while the integer fits in them. */
+	align dig_t buf[BN_SMALL_DIGS];
 #elif ALLOC == STACK || ALLOC == AUTO
 	/** The sequence of contiguous digits that forms this integer. */
 	align dig_t dp[BN_SIZE];
@@ -139,7 +153,9 @@ typedef bn_st *bn_t;
  *
  * @param[out] A			- the multiple precision integer to initialize.
  */
-#if ALLOC == AUTO
+#if ALLOC == AUTO && defined(BN_SMALL)
+#define bn_null(A)			(A)->dp = NULL;
+#elif ALLOC == AUTO
 #define bn_null(A)				/* empty */
 #else
 #define bn_null(A)			A = NULL;
@@ -167,10 +183,19 @@ typedef bn_st *bn_t;
 	}																		\
 	bn_init(A, BN_SIZE);													\
 
+#elif ALLOC == AUTO && defined(BN_SMALL)
+#define bn_new(A)															\
+	bn_init(A, BN_SMALL_DIGS);												\
+
 #elif ALLOC == AUTO
 #define bn_new(A)															\
 	bn_init(A, BN_SIZE);													\
 
+#elif ALLOC == STACK && defined(BN_SMALL)
+#define bn_new(A)															\
+	A = (bn_t)alloca(sizeof(bn_st));										\
+	bn_init(A, BN_SMALL_DIGS);												\
+
 #elif ALLOC == STACK
 #define bn_new(A)															\
 	A = (bn_t)alloca(sizeof(bn_st));										\
@@ -235,9 +260,19 @@ typedef bn_st *bn_t;
 		A = NULL;															\
 	}
 
+#elif ALLOC == AUTO && defined(BN_SMALL)
+#define bn_free(A)			bn_clean(A);									\
+
 #elif ALLOC == AUTO
 #define bn_free(A)			/* empty */										\
 
+#elif ALLOC == STACK && defined(BN_SMALL)
+#define bn_free(A)															\
+	if (A != NULL) {														\
+		bn_clean(A);														\
+		A = NULL;															\
+	}
+
 #elif ALLOC == STACK
 #define bn_free(A)															\
 	A = NULL;																\
@@ -356,6 +391,8 @@ typedef bn_st *bn_t;
 #define bn_mxp(C, A, B, M)	bn_mxp_slide(C, A, B, M)
 #elif BN_MXP == MONTY
 #define bn_mxp(C, A, B, M)	bn_mxp_monty(C, A, B, M)
+#elif BN_MXP == FIXED
+#define bn_mxp(C, A, B, M)	bn_mxp_fixed(C, A, B, M)
 #endif
 
 /**
@@ -921,6 +958,18 @@ void bn_mod_dig(dig_t *c, const bn_t a, dig_t b);
  */
 void bn_mod_basic(bn_t c, const bn_t a, const bn_t m);
 
+/**
+ * Inverts a multiple precision integer modulo an odd modulus in constant time,
+ * using the divsteps of Bernstein and Yang. The sequence of operations depends
+ * only on the size of the modulus. Returns zero if the inverse does not exist.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the multiple precision integer to invert.
+ * @param[in] m				- the modulus.
+ * @throw ERR_NO_VALID		- if the modulus is even or negative.
+ */
+void bn_mod_inv(bn_t c, const bn_t a, const bn_t m);
+
 /**
  * Computes the reciprocal of the modulus to be used in the Barrett modular
  * reduction algorithm.
@@ -1043,6 +1092,23 @@ void bn_mxp_slide(bn_t c, const bn_t a, const bn_t b, const bn_t m);
  */
 void bn_mxp_monty(bn_t c, const bn_t a, const bn_t b, const bn_t m);
 
+/**
+ * Exponentiates a multiple precision integer modulo an odd modulus using a
+ * constant-time fixed window method. Montgomery multiplications run on
+ * vectors as long as the modulus and always perform the final subtraction,
+ * and the precomputed powers are read in full for every window. Neither the
+ * sequence of operations nor the memory access pattern depends on the value
+ * of the exponent. The number of windows only depends on the size of the
+ * modulus, unless the exponent has more digits than the modulus.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the basis.
+ * @param[in] b				- the exponent.
+ * @param[in] m				- the modulus.
+ * @throw ERR_NO_VALID		- if the modulus is even or negative.
+ */
+void bn_mxp_fixed(bn_t c, const bn_t a, const bn_t b, const bn_t m);
+
 /**
  * Exponentiates a multiple precision integer by a small power modulo a modulus
  * using the binary method.
@@ -1205,7 +1271,8 @@ void bn_smb_jac(bn_t c, const bn_t a, const bn_t b);
 dig_t bn_get_prime(int pos);
 
 /**
- * Tests if a number is a probable prime.
+ * Tests if a number is a probable prime using trial division and the
+ * Baillie-PSW test.
  *
  * @param[in] a				- the multiple precision integer to test.
  * @return 1 if a is prime, 0 otherwise.
@@ -1238,6 +1305,16 @@ int bn_is_prime_rabin(const bn_t a);
  */
 int bn_is_prime_solov(const bn_t a);
 
+/**
+ * Tests if a number is prime using the Baillie-PSW test, a strong probable
+ * prime test to base 2 followed by a strong Lucas test with parameters chosen
+ * by Selfridge's method. No composite is known to pass both tests.
+ *
+ * @param[in] a				- the number to test.
+ * @return 1 if a is a probable prime, 0 otherwise.
+ */
+int bn_is_prime_bpsw(const bn_t a);
+
 /**
  * Generates a probable prime number.
  *
@@ -1410,4 +1487,18 @@ void bn_rec_jsf(int8_t *jsf, int *len, const bn_t k, const bn_t l);
 void bn_rec_glv(bn_t k0, bn_t k1, const bn_t k, const bn_t n, const bn_t v1[],
 		const bn_t v2[]);
 
+/**
+ * Recodes an integer k into four parts k_i of about a quarter of the size of
+ * the group order, such that k = \sum k_i * p^i mod n, where p is the prime of
+ * a BN curve with parameter x. The decomposition follows the lattice basis by
+ * Galbraith and Scott and is useful for any group where the Frobenius acts as
+ * exponentiation by p, such as G_2 and G_T.
+ *
+ * @param[out] k			- the four parts of the result.
+ * @param[in] e				- the integer to recode.
+ * @param[in] x				- the BN curve parameter.
+ * @param[in] n				- the group order.
+ */
+void bn_rec_frb(bn_t *k, const bn_t e, const bn_t x, const bn_t n);
+
 #endif /* !RELIC_BN_H */
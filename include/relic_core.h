@@ -138,6 +138,158 @@
 /* Type definitions                                                           */
 /*============================================================================*/
 
+#ifdef WITH_FP
+/**
+ * Parameters of a prime field and the constants derived from them.
+ *
+ * A field is built once by fp_param_set() or fp_prime_set_*() while selected
+ * with fp_field_set(), and can then be shared by several contexts.
+ */
+struct _fp_field_st {
+	/** Identifier of the prime field. */
+	int id;
+	/** Prime modulus. */
+	bn_st prime;
+#if FP_RDC == MONTY || !defined(STRIP)
+	/** Value (R^2 mod p) for converting small integers to Montgomery form. */
+	bn_st conv;
+	/** Value of constant one in Montgomery form. */
+	bn_st one;
+#endif /* FP_RDC == MONTY */
+	/** Prime modulus modulo 8. */
+	dig_t mod8;
+	/** Value derived from the prime used for modular reduction. */
+	dig_t u;
+	/** Quadratic non-residue. */
+	int qnr;
+	/** Cubic non-residue. */
+	int cnr;
+	/** Largest f such that 2^f divides p - 1, writing p - 1 = e * 2^f. */
+	int ad2;
+	/** Primitive 2^f-th root of unity, a quadratic non-residue raised to e. */
+	fp_st root;
+	/** Window width and recoding of the exponent (e - 1)/2 for square roots. */
+	int srt_wid;
+	uint8_t srt_win[FP_BITS + 1];
+	int srt_len;
+#if FP_RDC == QUICK || !defined(STRIP)
+	/** Sparse representation of prime modulus. */
+	int sps[MAX_TERMS + 1];
+	/** Length of sparse prime representation. */
+	int sps_len;
+#endif /* FP_RDC == QUICK */
+#ifdef WITH_PP
+	/** Constants for computing Frobenius maps in higher extensions. @{ */
+	fp2_st fp2_p[5];
+	fp_st fp2_p2[4];
+	fp2_st fp2_p3[5];
+	/** @} */
+	/** Constants for computing Frobenius maps in higher extensions. @{ */
+	fp_st fp3_base[2];
+	fp_st fp3_p[5];
+	fp_st fp3_p2[5];
+	fp_st fp3_p3[5];
+	fp_st fp3_p4[5];
+	fp_st fp3_p5[5];
+	/** @} */
+#endif /* WITH_PP */
+};
+#endif /* WITH_FP */
+
+#ifdef WITH_FB
+/**
+ * Parameters of a binary field and the tables derived from them.
+ *
+ * A field is built once by fb_param_set() or fb_poly_set_*() while selected
+ * with fb_field_set(), and can then be shared by several contexts.
+ */
+struct _fb_field_st {
+	/** Identifier of the binary field. */
+	int id;
+	/** Irreducible binary polynomial. */
+	fb_st poly;
+	/** Non-zero coefficients of a trinomial or pentanomial. */
+	int pa, pb, pc;
+	/** Positions of the non-zero coefficients of trinomials or pentanomials. */
+	int na, nb, nc;
+#if FB_TRC == QUICK || !defined(STRIP)
+	/** Powers of z with non-zero traces. */
+	int ta, tb, tc;
+#endif /* FB_TRC == QUICK */
+#if FB_SLV == QUICK || !defined(STRIP)
+	/** Table of precomputed half-traces. */
+	fb_st half[(FB_DIGIT / 8 + 1) * FB_DIGS][16];
+#endif /* FB_SLV == QUICK */
+#if FB_SRT == QUICK || !defined(STRIP)
+	/** Square root of z. */
+	fb_st srz;
+#ifdef FB_PRECO
+	/** Multiplication table for the z^(1/2). */
+	fb_st tab_srz[256];
+#endif /* FB_PRECO */
+#endif /* FB_SRT == QUICK */
+#if FB_INV == ITOHT || !defined(STRIP)
+	/** Stores an addition chain for (FB_BITS - 1). */
+	int chain[MAX_TERMS + 1];
+	/** Stores the length of the addition chain. */
+	int chain_len;
+	/** Tables for repeated squarings. */
+	fb_st tab_sqr[MAX_TERMS][FB_TABLE];
+	/** Pointers to the elements in the tables of repeated squarings. */
+	fb_st *tab_ptr[MAX_TERMS][FB_TABLE];
+#endif /* FB_INV == ITOHT */
+};
+#endif /* WITH_FB */
+
+#ifdef WITH_EP
+/**
+ * Parameters of a prime elliptic curve, including the precomputation table.
+ *
+ * A curve is built once by ep_param_set() or ep_curve_set_*() while selected
+ * with ep_curve_set(), and can then be shared by several contexts.
+ */
+struct _ep_curve_st {
+	/** Identifier of the prime elliptic curve. */
+	int id;
+	/** The 'a' coefficient of the elliptic curve. */
+	fp_st a;
+	/** The 'b' coefficient of the elliptic curve. */
+	fp_st b;
+	/** The generator of the elliptic curve. */
+	ep_st g;
+	/** The order of the group of points in the elliptic curve. */
+	bn_st r;
+	/** The cofactor of the group order in the elliptic curve. */
+	bn_st h;
+#ifdef EP_ENDOM
+#if EP_MUL == LWNAF || EP_FIX == COMBS || EP_FIX == LWNAF || EP_SIM == INTER || !defined(STRIP)
+	/** Parameters required by the GLV method. @{ */
+	fp_st beta;
+	bn_st v1[3];
+	bn_st v2[3];
+	/** @} */
+#endif /* EP_ENDOM */
+#endif /* EP_MUL */
+	/** The constant of the deterministic hash: the non-square Z of the
+	 * simplified SWU map, a square root of -3 for the SvdW map, or zero. */
+	fp_st map_z;
+	/** Optimization identifier for the a-coefficient. */
+	int opt_a;
+	/** Optimization identifier for the b-coefficient. */
+	int opt_b;
+	/** Flag that stores if the prime curve has efficient endomorphisms. */
+	int is_endom;
+	/** Flag that stores if the prime curve is supersingular. */
+	int is_super;
+#ifdef EP_PRECO
+	/** Precomputation table for generator multiplication. */
+	ep_st pre[EP_TABLE];
+	/** Array of pointers to the precomputation table. */
+	ep_st *ptr[EP_TABLE];
+#endif /* EP_PRECO */
+};
+#endif /* WITH_EP */
+
 /**
  * Library context.
  */
@@ -156,6 +308,10 @@ typedef struct _ctx_t {
 	char *reason[ERR_MAX];
 	/** A flag to indicate if the last error was already caught. */
 	int caught;
+#ifdef CHECK_FAST
+	/** A flag to indicate if an error was thrown and not caught yet. */
+	int pending;
+#endif
 #endif /* CHECK */
 
 #if defined(CHECK) && defined(TRACE)
@@ -164,47 +320,27 @@ typedef struct _ctx_t {
 #endif /* CHECK && TRACE */
 
 #if ALLOC == STATIC
-	/** The static pool of digit vectors. */
-	pool_t pool[POOL_SIZE];
+	/** The elements of the pool, in the static pool or in an arena. */
+	pool_t *pool_base;
+	/** The arena allocated for the pool by pool_init(), if any. */
+	void *pool_mem;
+	/** The number of elements in the pool. */
+	int pool_size;
 	/** The index of the next free digit vector in the pool. */
 	int next;
+	/** The number of digit vectors currently allocated from the pool. */
+	int pool_used;
+	/** The highest number of digit vectors allocated at the same time. */
+	int pool_peak;
 #endif /* ALLOC == STATIC */
 
 #ifdef WITH_FB
-	/** Identifier of the currently configured binary field. */
-	int fb_id;
-	/** Irreducible binary polynomial. */
-	fb_st fb_poly;
-	/** Non-zero coefficients of a trinomial or pentanomial. */
-	int fb_pa, fb_pb, fb_pc;
-	/** Positions of the non-zero coefficients of trinomials or pentanomials. */
-	int fb_na, fb_nb, fb_nc;
-#if FB_TRC == QUICK || !defined(STRIP)
-	/** Powers of z with non-zero traces. */
-	int fb_ta, fb_tb, fb_tc;
-#endif /* FB_TRC == QUICK */
-#if FB_SLV == QUICK || !defined(STRIP)
-	/** Table of precomputed half-traces. */
-	fb_st fb_half[(FB_DIGIT / 8 + 1) * FB_DIGS][16];
-#endif /* FB_SLV == QUICK */
-#if FB_SRT == QUICK || !defined(STRIP)
-	/** Square root of z. */
-	fb_st fb_srz;
-#ifdef FB_PRECO
-	/** Multiplication table for the z^(1/2). */
-	fb_st fb_tab_srz[256];
-#endif /* FB_PRECO */
-#endif /* FB_SRT == QUICK */
-#if FB_INV == ITOHT || !defined(STRIP)
-	/** Stores an addition chain for (FB_BITS - 1). */
-	int chain[MAX_TERMS + 1];
-	/** Stores the length of the addition chain. */
-	int chain_len;
-	/** Tables for repeated squarings. */
-	fb_st fb_tab_sqr[MAX_TERMS][FB_TABLE];
-	/** Pointers to the elements in the tables of repeated squarings. */
-	fb_st *fb_tab_ptr[MAX_TERMS][FB_TABLE];
-#endif /* FB_INV == ITOHT */
+	/** Storage for the default binary field, allocated by core_init(). */
+	fb_field_t fb_def;
+	/** The currently selected binary field. */
+	fb_field_t fb;
+	/** The shared binary field referenced by this context, if any. */
+	fb_field_t fb_shared;
 #endif /* WITH_FB */
 
 #ifdef WITH_EB
@@ -235,68 +371,19 @@ typedef struct _ctx_t {
 #endif /* WITH_EB */
 
 #ifdef WITH_FP
-	/** Identifier of the currently configured prime field. */
-	int fp_id;
-	/** Prime modulus. */
-	bn_st prime;
-#if FP_RDC == MONTY || !defined(STRIP)
-	/** Value (R^2 mod p) for converting small integers to Montgomery form. */
-	bn_st conv;
-	/** Value of constant one in Montgomery form. */
-	bn_st one;
-#endif /* FP_RDC == MONTY */
-	/** Prime modulus modulo 8. */
-	dig_t mod8;
-	/** Value derived from the prime used for modular reduction. */
-	dig_t u;
-	/** Quadratic non-residue. */
-	int qnr;
-	/** Cubic non-residue. */
-	int cnr;
-#if FP_RDC == QUICK || !defined(STRIP)
-	/** Sparse representation of prime modulus. */
-	int sps[MAX_TERMS + 1];
-	/** Length of sparse prime representation. */
-	int sps_len;
-#endif /* FP_RDC == QUICK */
+	/** Storage for the default prime field. */
+	fp_field_st fp_def;
+	/** The currently selected prime field. */
+	fp_field_t fp;
 #endif /* WITH_FP */
 
 #ifdef WITH_EP
-	/** Identifier of the currently configured prime elliptic curve. */
-	int ep_id;
-	/** The 'a' coefficient of the elliptic curve. */
-	fp_st ep_a;
-	/** The 'b' coefficient of the elliptic curve. */
-	fp_st ep_b;
-	/** The generator of the elliptic curve. */
-	ep_st ep_g;
-	/** The order of the group of points in the elliptic curve. */
-	bn_st ep_r;
-	/** The cofactor of the group order in the elliptic curve. */
-	bn_st ep_h;
-#ifdef EP_ENDOM
-#if EP_MUL == LWNAF || EP_FIX == COMBS || EP_FIX == LWNAF || EP_SIM == INTER || !defined(STRIP)
-	/** Parameters required by the GLV method. @{ */
-	fp_st beta;
-	bn_st ep_v1[3];
-	bn_st ep_v2[3];
-	/** @} */
-#endif /* EP_ENDOM */
-#endif /* EP_MUL */
-	/** Optimization identifier for the a-coefficient. */
-	int ep_opt_a;
-	/** Optimization identifier for the b-coefficient. */
-	int ep_opt_b;
-	/** Flag that stores if the prime curve has efficient endomorphisms. */
-	int ep_is_endom;
-	/** Flag that stores if the prime curve is supersingular. */
-	int ep_is_super;
-#ifdef EP_PRECO
-	/** Precomputation table for generator multiplication. */
-	ep_st ep_pre[EP_TABLE];
-	/** Array of pointers to the precomputation table. */
-	ep_st *ep_ptr[EP_TABLE];
-#endif /* EP_PRECO */
+	/** Storage for the default prime elliptic curve. */
+	ep_curve_st ep_def;
+	/** The currently selected prime elliptic curve. */
+	ep_curve_t ep;
+	/** The shared prime elliptic curve referenced by this context, if any. */
+	ep_curve_t ep_shared;
 #endif /* WITH_EP */
 
 #ifdef WITH_EPX
@@ -354,22 +441,6 @@ typedef struct _ctx_t {
 #endif /* ED_PRECO */
 #endif
 
-#ifdef WITH_PP
-	/** Constants for computing Frobenius maps in higher extensions. @{ */
-	fp2_st fp2_p[5];
-	fp_st fp2_p2[4];
-	fp2_st fp2_p3[5];
-	/** @} */
-	/** Constants for computing Frobenius maps in higher extensions. @{ */
-	fp_st fp3_base[2];
-	fp_st fp3_p[5];
-	fp_st fp3_p2[5];
-	fp_st fp3_p3[5];
-	fp_st fp3_p4[5];
-	fp_st fp3_p5[5];
-	/** @} */
-#endif /* WITH_PP */
-
 #if BENCH > 0
 	/** Stores the time measured before the execution of the benchmark. */
 	bench_t before;
@@ -412,6 +483,14 @@ extern ctx_t *core_ctx;
 
 #endif
 
+/**
+ * Function executed for each index of a parallel operation.
+ *
+ * @param[in,out] args			- the arguments shared by all indices.
+ * @param[in] i					- the index to process.
+ */
+typedef void (*core_job_t)(void *args, int i);
+
 /*============================================================================*/
 /* Function prototypes                                                        */
 /*============================================================================*/
@@ -444,4 +523,32 @@ ctx_t *core_get(void);
  */
 void core_set(ctx_t *ctx);
 
+/**
+ * Returns the number of threads used by parallel operations. This is CORES
+ * when multithreading is enabled and 1 otherwise, including with ALLOC = STATIC
+ * since the pool of digit vectors cannot be shared by other contexts.
+ *
+ * @return the number of threads.
+ */
+int core_par_num(void);
+
+/**
+ * Runs a job for each index from 0 to n - 1 on up to core_par_num() threads.
+ * Threads take the next pending index as soon as they become idle. The other
+ * threads get a light context of their own that references the fields and
+ * curves selected by the caller, so jobs must not reconfigure parameters and
+ * must only write to disjoint outputs. Parallel operations started inside a
+ * job run sequentially.
+ *
+ * Random values generated by a job are not reproducible: the generator of
+ * each other thread is seeded from the caller's generator when the operation
+ * starts, and with RAND = CALL the callback is shared and must be thread-safe.
+ *
+ * @param[in] job				- the job to run.
+ * @param[in,out] args			- the arguments shared by all indices.
+ * @param[in] n					- the number of indices.
+ * @throw ERR_CAUGHT			- if the job fails for some index.
+ */
+void core_par(core_job_t job, void *args, int n);
+
 #endif /* !RELIC_CORE_H */
@@ -70,6 +70,25 @@
  */
 #define CP_PKCS2	2
 
+/**
+ * Number of bits in the random exponents used to batch the verification of
+ * BLS signatures. A batch with invalid signatures passes with probability at
+ * most 2^{-CP_BLS_RLC}.
+ */
+#define CP_BLS_RLC	64
+
+/**
+ * Number of baby steps used to recover BGN plaintexts. Decryption of a
+ * plaintext m takes about m / CP_BGN_STEP group operations, since the tables
+ * of baby steps are built once with the private key.
+ */
+#define CP_BGN_STEP	1024
+
+/**
+ * Maximum number of primes in a multi-prime RSA modulus.
+ */
+#define CP_RSA_PRIMES	4
+
 /*============================================================================*/
 /* Type definitions.                                                          */
 /*============================================================================*/
@@ -94,6 +113,14 @@ typedef struct _rsa_t {
 	bn_t dq;
 	/** The inverse of q modulo p. */
 	bn_t qi;
+	/** The number of primes in the modulus. */
+	int primes;
+	/** The additional primes r_i of a multi-prime modulus. */
+	bn_t r[CP_RSA_PRIMES - 2];
+	/** The inverses of e modulo (r_i - 1). */
+	bn_t dr[CP_RSA_PRIMES - 2];
+	/** The inverses of the product of the preceding primes modulo r_i. */
+	bn_t tr[CP_RSA_PRIMES - 2];
 } rsa_st;
 
 /**
@@ -196,6 +223,12 @@ typedef struct _bgn_t {
 	g2_t hy;
 	/* The third element from the second group. */
 	g2_t hz;
+	/** The baby steps for decryption in the first group. */
+	pc_dlog_t d1;
+	/** The baby steps for decryption in the second group. */
+	pc_dlog_t d2;
+	/** The baby steps for decryption in the target group. */
+	pc_dlog_t dt;
 } bgn_st;
 
 /**
@@ -252,7 +285,23 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
  *
  * @param[out] A			- the key pair to initialize.
  */
-#if ALLOC == AUTO
+#if ALLOC == AUTO && defined(BN_SMALL)
+#define rsa_null(A)															\
+	bn_null((A)->e);														\
+	bn_null((A)->n);														\
+	bn_null((A)->d);														\
+	bn_null((A)->dp);														\
+	bn_null((A)->dq);														\
+	bn_null((A)->p);														\
+	bn_null((A)->q);														\
+	bn_null((A)->qi);														\
+	for (int _i = 0; _i < CP_RSA_PRIMES - 2; _i++) {						\
+		bn_null((A)->r[_i]);												\
+		bn_null((A)->dr[_i]);												\
+		bn_null((A)->tr[_i]);												\
+	}																		\
+
+#elif ALLOC == AUTO
 #define rsa_null(A)				/* empty */
 #else
 #define rsa_null(A)			A = NULL;
@@ -277,6 +326,11 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 	bn_null((A)->p);														\
 	bn_null((A)->q);														\
 	bn_null((A)->qi);														\
+	for (int _i = 0; _i < CP_RSA_PRIMES - 2; _i++) {						\
+		bn_null((A)->r[_i]);												\
+		bn_null((A)->dr[_i]);												\
+		bn_null((A)->tr[_i]);												\
+	}																		\
 	bn_new((A)->e);															\
 	bn_new((A)->n);															\
 	bn_new((A)->d);															\
@@ -285,6 +339,12 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
 	bn_new((A)->qi);														\
+	for (int _i = 0; _i < CP_RSA_PRIMES - 2; _i++) {						\
+		bn_new((A)->r[_i]);													\
+		bn_new((A)->dr[_i]);												\
+		bn_new((A)->tr[_i]);												\
+	}																		\
+	(A)->primes = 2;														\
 
 #elif ALLOC == STATIC
 #define rsa_new(A)															\
@@ -300,6 +360,11 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 	bn_null((A)->p);														\
 	bn_null((A)->q);														\
 	bn_null((A)->qi);														\
+	for (int _i = 0; _i < CP_RSA_PRIMES - 2; _i++) {						\
+		bn_null((A)->r[_i]);												\
+		bn_null((A)->dr[_i]);												\
+		bn_null((A)->tr[_i]);												\
+	}																		\
 	bn_new((A)->e);															\
 	bn_new((A)->n);															\
 	bn_new((A)->d);															\
@@ -308,6 +373,12 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
 	bn_new((A)->qi);														\
+	for (int _i = 0; _i < CP_RSA_PRIMES - 2; _i++) {						\
+		bn_new((A)->r[_i]);													\
+		bn_new((A)->dr[_i]);												\
+		bn_new((A)->tr[_i]);												\
+	}																		\
+	(A)->primes = 2;														\
 
 #elif ALLOC == AUTO
 #define rsa_new(A)															\
@@ -319,6 +390,12 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
 	bn_new((A)->qi);														\
+	for (int _i = 0; _i < CP_RSA_PRIMES - 2; _i++) {						\
+		bn_new((A)->r[_i]);													\
+		bn_new((A)->dr[_i]);												\
+		bn_new((A)->tr[_i]);												\
+	}																		\
+	(A)->primes = 2;														\
 
 #elif ALLOC == STACK
 #define rsa_new(A)															\
@@ -331,6 +408,12 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 	bn_new((A)->p);															\
 	bn_new((A)->q);															\
 	bn_new((A)->qi);														\
+	for (int _i = 0; _i < CP_RSA_PRIMES - 2; _i++) {						\
+		bn_new((A)->r[_i]);													\
+		bn_new((A)->dr[_i]);												\
+		bn_new((A)->tr[_i]);												\
+	}																		\
+	(A)->primes = 2;														\
 
 #endif
 
@@ -350,6 +433,11 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 		bn_free((A)->p);													\
 		bn_free((A)->q);													\
 		bn_free((A)->qi);													\
+		for (int _i = 0; _i < CP_RSA_PRIMES - 2; _i++) {					\
+			bn_free((A)->r[_i]);											\
+			bn_free((A)->dr[_i]);											\
+			bn_free((A)->tr[_i]);											\
+		}																	\
 		free(A);															\
 		A = NULL;															\
 	}
@@ -365,9 +453,30 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 		bn_free((A)->p);													\
 		bn_free((A)->q);													\
 		bn_free((A)->qi);													\
+		for (int _i = 0; _i < CP_RSA_PRIMES - 2; _i++) {					\
+			bn_free((A)->r[_i]);											\
+			bn_free((A)->dr[_i]);											\
+			bn_free((A)->tr[_i]);											\
+		}																	\
 		A = NULL;															\
 	}																		\
 
+#elif ALLOC == AUTO && defined(BN_SMALL)
+#define rsa_free(A)															\
+	bn_free((A)->e);														\
+	bn_free((A)->n);														\
+	bn_free((A)->d);														\
+	bn_free((A)->dp);														\
+	bn_free((A)->dq);														\
+	bn_free((A)->p);														\
+	bn_free((A)->q);														\
+	bn_free((A)->qi);														\
+	for (int _i = 0; _i < CP_RSA_PRIMES - 2; _i++) {						\
+		bn_free((A)->r[_i]);												\
+		bn_free((A)->dr[_i]);												\
+		bn_free((A)->tr[_i]);												\
+	}																		\
+
 #elif ALLOC == AUTO
 #define rsa_free(A)				/* empty */
 
@@ -381,6 +490,11 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 	bn_free((A)->p);														\
 	bn_free((A)->q);														\
 	bn_free((A)->qi);														\
+	for (int _i = 0; _i < CP_RSA_PRIMES - 2; _i++) {						\
+		bn_free((A)->r[_i]);												\
+		bn_free((A)->dr[_i]);												\
+		bn_free((A)->tr[_i]);												\
+	}																		\
 	A = NULL;																\
 
 #endif
@@ -390,7 +504,15 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
  *
  * @param[out] A			- the key pair to initialize.
  */
-#if ALLOC == AUTO
+#if ALLOC == AUTO && defined(BN_SMALL)
+#define rabin_null(A)														\
+	bn_null((A)->n);														\
+	bn_null((A)->dp);														\
+	bn_null((A)->dq);														\
+	bn_null((A)->p);														\
+	bn_null((A)->q);														\
+
+#elif ALLOC == AUTO
 #define rabin_null(A)			/* empty */
 #else
 #define rabin_null(A)		A = NULL;
@@ -472,6 +594,14 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 		A = NULL;															\
 	}																		\
 
+#elif ALLOC == AUTO && defined(BN_SMALL)
+#define rabin_free(A)														\
+	bn_free((A)->n);														\
+	bn_free((A)->dp);														\
+	bn_free((A)->dq);														\
+	bn_free((A)->p);														\
+	bn_free((A)->q);														\
+
 #elif ALLOC == AUTO
 #define rabin_free(A)			/* empty */
 
@@ -491,7 +621,14 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
  *
  * @param[out] A			- the key pair to initialize.
  */
-#if ALLOC == AUTO
+#if ALLOC == AUTO && defined(BN_SMALL)
+#define bdpe_null(A)														\
+	bn_null((A)->n);														\
+	bn_null((A)->p);														\
+	bn_null((A)->q);														\
+	bn_null((A)->y);														\
+
+#elif ALLOC == AUTO
 #define bdpe_null(A)			/* empty */
 #else
 #define bdpe_null(A)			A = NULL;
@@ -572,6 +709,13 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 		A = NULL;															\
 	}																		\
 
+#elif ALLOC == AUTO && defined(BN_SMALL)
+#define bdpe_free(A)														\
+	bn_free((A)->n);														\
+	bn_free((A)->p);														\
+	bn_free((A)->q);														\
+	bn_free((A)->y);														\
+
 #elif ALLOC == AUTO
 #define bdpe_free(A)			/* empty */
 
@@ -669,7 +813,13 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
  *
  * @param[out] A			- the key pair to initialize.
  */
-#if ALLOC == AUTO
+#if ALLOC == AUTO && defined(BN_SMALL)
+#define bgn_null(A)															\
+	bn_null((A)->x);														\
+	bn_null((A)->y);														\
+	bn_null((A)->z);														\
+
+#elif ALLOC == AUTO
 #define bgn_null(A)			/* empty */
 #else
 #define bgn_null(A)			A = NULL;
@@ -695,6 +845,9 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 	g2_new((A)->hx);														\
 	g2_new((A)->hy);														\
 	g2_new((A)->hz);														\
+	pc_dlog_new((A)->d1);													\
+	pc_dlog_new((A)->d2);													\
+	pc_dlog_new((A)->dt);													\
 
 #elif ALLOC == STATIC
 #define bgn_new(A)															\
@@ -711,9 +864,18 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 	g2_new((A)->hx);														\
 	g2_new((A)->hy);														\
 	g2_new((A)->hz);														\
+	pc_dlog_new((A)->d1);													\
+	pc_dlog_new((A)->d2);													\
+	pc_dlog_new((A)->dt);													\
 
 #elif ALLOC == AUTO
-#define bgn_new(A)			/* empty */
+#define bgn_new(A)															\
+	bn_new((A)->x);															\
+	bn_new((A)->y);															\
+	bn_new((A)->z);															\
+	pc_dlog_new((A)->d1);													\
+	pc_dlog_new((A)->d2);													\
+	pc_dlog_new((A)->dt);													\
 
 #elif ALLOC == STACK
 #define bgn_new(A)															\
@@ -727,6 +889,9 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 	g2_new((A)->hx);														\
 	g2_new((A)->hy);														\
 	g2_new((A)->hz);														\
+	pc_dlog_new((A)->d1);													\
+	pc_dlog_new((A)->d2);													\
+	pc_dlog_new((A)->dt);													\
 
 #endif
 
@@ -747,6 +912,9 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 		g2_free((A)->hx);													\
 		g2_free((A)->hy);													\
 		g2_free((A)->hz);													\
+		pc_dlog_free((A)->d1);												\
+		pc_dlog_free((A)->d2);												\
+		pc_dlog_free((A)->dt);												\
 		free(A);															\
 		A = NULL;															\
 	}
@@ -763,11 +931,26 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 		g2_free((A)->hx);													\
 		g2_free((A)->hy);													\
 		g2_free((A)->hz);													\
+		pc_dlog_free((A)->d1);												\
+		pc_dlog_free((A)->d2);												\
+		pc_dlog_free((A)->dt);												\
 		A = NULL;															\
 	}																		\
 
+#elif ALLOC == AUTO && defined(BN_SMALL)
+#define bgn_free(A)															\
+	bn_free((A)->x);														\
+	bn_free((A)->y);														\
+	bn_free((A)->z);														\
+	pc_dlog_free((A)->d1);													\
+	pc_dlog_free((A)->d2);													\
+	pc_dlog_free((A)->dt);													\
+
 #elif ALLOC == AUTO
-#define bgn_free(A)			/* empty */
+#define bgn_free(A)															\
+	pc_dlog_free((A)->d1);													\
+	pc_dlog_free((A)->d2);													\
+	pc_dlog_free((A)->dt);													\
 
 #elif ALLOC == STACK
 #define bgn_free(A)															\
@@ -780,6 +963,9 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 	g2_free((A)->hx);														\
 	g2_free((A)->hy);														\
 	g2_free((A)->hz);														\
+	pc_dlog_free((A)->d1);													\
+	pc_dlog_free((A)->d2);													\
+	pc_dlog_free((A)->dt);													\
 	A = NULL;																\
 
 #endif
@@ -789,7 +975,11 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
  *
  * @param[out] A 			- key generation center to initialize.
  */
-#if ALLOC == AUTO
+#if ALLOC == AUTO && defined(BN_SMALL)
+#define vbnn_ibs_kgc_null(A)												\
+	bn_null((A)->msk);														\
+
+#elif ALLOC == AUTO
 #define vbnn_ibs_kgc_null(A)	/* empty */
 #else
 #define vbnn_ibs_kgc_null(A)	A = NULL;
@@ -854,10 +1044,13 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 	if (A != NULL) {														\
 		ec_free((A)->mpk);													\
 		bn_free((A)->msk);													\
-		free(A);															\
 		A = NULL;															\
 	}																		\
 
+#elif ALLOC == AUTO && defined(BN_SMALL)
+#define vbnn_ibs_kgc_free(A)												\
+	bn_free((A)->msk);														\
+
 #elif ALLOC == AUTO
 #define vbnn_ibs_kgc_free(A)				/* empty */
 
@@ -874,7 +1067,11 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
  *
  * @param[out] A 			- user to initialize.
  */
-#if ALLOC == AUTO
+#if ALLOC == AUTO && defined(BN_SMALL)
+#define vbnn_ibs_user_null(A)												\
+	bn_null((A)->s);														\
+
+#elif ALLOC == AUTO
 #define vbnn_ibs_user_null(A)	/* empty */
 #else
 #define vbnn_ibs_user_null(A)	A = NULL;
@@ -939,10 +1136,13 @@ typedef vbnn_ibs_user_st *vbnn_ibs_user_t;
 	if (A != NULL) {														\
 		ec_free((A)->R);													\
 		bn_free((A)->s);													\
-		free(A);															\
 		A = NULL;															\
 	}																		\
 
+#elif ALLOC == AUTO && defined(BN_SMALL)
+#define vbnn_ibs_user_free(A)												\
+	bn_free((A)->s);														\
+
 #elif ALLOC == AUTO
 #define vbnn_ibs_user_free(A)				/* empty */
 
@@ -1025,6 +1225,19 @@ int cp_rsa_gen_basic(rsa_t pub, rsa_t prv, int bits);
  */
 int cp_rsa_gen_quick(rsa_t pub, rsa_t prv, int bits);
 
+/**
+ * Generates a key pair for fast RSA operations with a multi-prime modulus, as
+ * specified in PKCS #1 v2.2. The private operations of the fast methods use
+ * one exponentiation per prime.
+ *
+ * @param[out] pub			- the public key.
+ * @param[out] prv			- the private key.
+ * @param[in] bits			- the key length in bits.
+ * @param[in] primes		- the number of primes, from 2 to CP_RSA_PRIMES.
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+int cp_rsa_gen_multi(rsa_t pub, rsa_t prv, int bits, int primes);
+
 /**
  * Encrypts using the RSA cryptosystem.
  *
@@ -1411,7 +1624,8 @@ int cp_sokaka_key(uint8_t *key, unsigned int key_len, char *id1, int len1,
 int cp_ibe_gen(bn_t master, g1_t pub);
 
 /**
- * Generates a BGN key pair.
+ * Generates a BGN key pair. The private key keeps the tables of baby steps
+ * used for decryption, so they are built only once per key.
  *
  * @param[out] pub 				- the public key.
  * @param[out] prv 				- the private key.
@@ -1430,7 +1644,8 @@ int cp_bgn_gen(bgn_t pub, bgn_t prv);
 int cp_bgn_enc1(g1_t out[2], dig_t in, bgn_t pub);
 
 /**
- * Decrypts in G_1 using the BGN cryptosystem.
+ * Decrypts in G_1 using the BGN cryptosystem. The table of baby steps is
+ * taken from the private key and built on first use if missing.
  *
  * @param[out] out 				- the decrypted small integer.
  * @param[in] in 				- the ciphertext.
@@ -1450,7 +1665,8 @@ int cp_bgn_dec1(dig_t *out, g1_t in[2], bgn_t prv);
 int cp_bgn_enc2(g2_t out[2], dig_t in, bgn_t pub);
 
 /**
- * Decrypts in G_2 using the BGN cryptosystem.
+ * Decrypts in G_2 using the BGN cryptosystem. The table of baby steps is
+ * taken from the private key and built on first use if missing.
  *
  * @param[out] out 				- the decrypted small integer.
  * @param[in] c 				- the ciphertext.
@@ -1480,7 +1696,9 @@ int cp_bgn_add(gt_t e[4], gt_t c[4], gt_t d[4]);
 int cp_bgn_mul(gt_t e[4], g1_t c[2], g2_t d[2]);
 
 /**
- * Decrypts in G_T using the BGN cryptosystem.
+ * Decrypts in G_T using the BGN cryptosystem. The table of baby steps is
+ * taken from the private key and built on first use if missing.
+ *
  * @param[out] out 				- the decrypted small integer.
  * @param[in] c 				- the ciphertext.
  * @param[in] prv 				- the private key.
@@ -1553,6 +1771,46 @@ int cp_bls_sig(g1_t s, uint8_t *msg, int len, bn_t d);
  */
 int cp_bls_ver(g1_t s, uint8_t *msg, int len, g2_t q);
 
+/**
+ * Aggregates BLS signatures into a single signature.
+ *
+ * @param[out] s				- the aggregate signature.
+ * @param[in] sigs				- the signatures to aggregate.
+ * @param[in] n					- the number of signatures.
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+int cp_bls_agg(g1_t s, g1_t *sigs, int n);
+
+/**
+ * Verifies an aggregate BLS signature on distinct messages. The messages must
+ * be pairwise distinct for the aggregate scheme to be secure.
+ *
+ * @param[in] s					- the aggregate signature.
+ * @param[in] msgs				- the signed messages.
+ * @param[in] lens				- the message lengths in bytes.
+ * @param[in] qs				- the public keys of the signers.
+ * @param[in] n					- the number of signers.
+ * @return a boolean value indicating if the aggregate signature is valid.
+ */
+int cp_bls_ver_agg(g1_t s, uint8_t **msgs, int *lens, g2_t *qs, int n);
+
+/**
+ * Verifies a batch of BLS signatures using random linear combinations, so
+ * that the whole batch costs n + 1 Miller loops and a single final
+ * exponentiation. If the batch fails and the verdict vector is not NULL, the
+ * batch is bisected to locate the invalid signatures.
+ *
+ * @param[out] ver				- the verdict for each signature, or NULL.
+ * @param[in] sigs				- the signatures.
+ * @param[in] msgs				- the signed messages.
+ * @param[in] lens				- the message lengths in bytes.
+ * @param[in] qs				- the public keys.
+ * @param[in] n					- the number of signatures.
+ * @return a boolean value indicating if all the signatures are valid.
+ */
+int cp_bls_ver_batch(int *ver, g1_t *sigs, uint8_t **msgs, int *lens, g2_t *qs,
+		int n);
+
 /**
  * Generates a Boneh-Boyen key pair.
  *
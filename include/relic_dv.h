@@ -68,9 +68,14 @@
  * Size in digits of a temporary vector.
  *
  * A temporary vector has enough size to store a multiplication/squaring result
- * produced by any module.
+ * produced by any module. Integers with inline storage never use temporary
+ * vectors, so these only need to hold field elements.
  */
+#ifdef BN_SMALL
+#define DV_DIGS		MAX(DV_FP, DV_FB)
+#else
 #define DV_DIGS		MAX(MAX(DV_FP, DV_FB), BN_SIZE)
+#endif
 
 /**
  * Size in bytes of a temporary vector.
@@ -113,6 +113,11 @@ enum {
 #define ED_TABLE_MAX MAX(ED_TABLE_BASIC, ED_TABLE_COMBD)
 #endif
 
+/**
+ * Number of digits of scratch space needed by the batch functions on N points.
+ */
+#define ED_BATCH(N)			((N) * FP_DIGS)
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
@@ -447,6 +452,20 @@ void ed_norm(ed_t r, const ed_t p);
  */
 void ed_norm_sim(ed_t *r, const ed_t *t, int n);
 
+/**
+ * Converts an arbitrarily large array of points to affine coordinates with a
+ * single inversion, keeping the intermediate products in a caller-supplied
+ * buffer of ED_BATCH(n) digits. If the buffer is NULL, it is allocated from
+ * the heap.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to convert.
+ * @param[in] n				- the number of points.
+ * @param[in] s				- the scratch buffer, or NULL.
+ * @throw ERR_NO_MEMORY		- if the scratch buffer cannot be allocated.
+ */
+void ed_norm_bat(ed_t *r, const ed_t *p, int n, dig_t *s);
+
 /**
  * Maps a byte array to a point in a prime elliptic twisted Edwards curve.
  *
@@ -784,6 +803,16 @@ void ed_print(const ed_t p);
  */
 int ed_is_valid(const ed_t p);
 
+/**
+ * Tests if all the points in an array are in the curve, without converting
+ * them to affine coordinates.
+ *
+ * @param[in] p       - the points to test.
+ * @param[in] n       - the number of points.
+ * @return 1 if all the points are valid, 0 otherwise.
+ */
+int ed_is_valid_bat(const ed_t *p, int n);
+
 /**
  * Returns the number of bytes necessary to store a prime elliptic twisted Edwards curve point
  * with optional point compression.
@@ -900,4 +929,17 @@ void ed_pck(ed_t r, const ed_t p);
  */
 int ed_upk(ed_t r, const ed_t p);
 
+/**
+ * Decompresses an array of points, sharing a single inversion among all the
+ * recovered x-coordinates.
+ *
+ * @param[out] r			- the results.
+ * @param[in] p				- the points to decompress.
+ * @param[in] n				- the number of points.
+ * @param[in] s				- the scratch buffer of ED_BATCH(n) digits, or NULL.
+ * @return if all the decompressions were successful.
+ * @throw ERR_NO_MEMORY		- if the scratch buffer cannot be allocated.
+ */
+int ed_upk_bat(ed_t *r, const ed_t *p, int n, dig_t *s);
+
 #endif
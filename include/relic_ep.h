@@ -172,6 +172,17 @@ enum {
 #define EP_TABLE_MAX MAX(EP_TABLE_BASIC, EP_TABLE_COMBD)
 #endif
 
+/**
+ * Number of points from which simultaneous multiplication of many points uses
+ * Pippenger's bucket method instead of interleaving.
+ */
+#define EP_LOT_BUCKET		128
+
+/**
+ * Number of digits of scratch space needed by the batch functions on N points.
+ */
+#define EP_BATCH(N)			((N) * FP_DIGS)
+
 /*============================================================================*/
 /* Type definitions                                                           */
 /*============================================================================*/
@@ -208,6 +219,17 @@ typedef ep_st ep_t[1];
 typedef ep_st *ep_t;
 #endif
 
+/**
+ * Represents the parameters of a prime elliptic curve. The members are listed
+ * in relic_core.h, next to the library context.
+ */
+typedef struct _ep_curve_st ep_curve_st;
+
+/**
+ * Pointer to the parameters of a prime elliptic curve.
+ */
+typedef ep_curve_st *ep_curve_t;
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -432,6 +454,23 @@ void ep_curve_init(void);
  */
 void ep_curve_clean(void);
 
+/**
+ * Returns the currently selected prime elliptic curve.
+ *
+ * @return the parameters of the prime elliptic curve.
+ */
+ep_curve_t ep_curve_get(void);
+
+/**
+ * Selects the prime elliptic curve used by the arithmetic functions. The curve
+ * must be initialized by ep_curve_init() the first time it is selected, and is
+ * then configured by the usual parameter-setting functions. The prime field
+ * over which it was configured must be selected with fp_field_set().
+ *
+ * @param[in] curve			- the prime elliptic curve, or NULL for the default.
+ */
+void ep_curve_set(ep_curve_t curve);
+
 /**
  * Returns the 'a' coefficient of the currently configured prime elliptic curve.
  *
@@ -446,6 +485,14 @@ dig_t *ep_curve_get_a(void);
  */
 dig_t *ep_curve_get_b(void);
 
+/**
+ * Returns the constant used by the deterministic hash on the currently
+ * configured prime elliptic curve, or zero if the curve does not support it.
+ *
+ * @return the constant of the deterministic hash.
+ */
+dig_t *ep_curve_get_map(void);
+
 /**
  * Returns the efficient endormorphism associated with the prime curve.
  */
@@ -564,6 +611,24 @@ void ep_curve_set_endom(const fp_t b, const ep_t g, const bn_t r, const bn_t h,
  */
 void ep_param_set(int param);
 
+/**
+ * Configures a prime elliptic curve by its parameter identifier, sharing the
+ * parameters read-only with every other context that selects the same curve.
+ * The first call builds the curve and its prime field once for the whole
+ * process, and later calls from any thread only reference them. The shared
+ * parameters are released by ep_param_release() or core_clean().
+ *
+ * @param[in] param			- the parameter identifier.
+ * @throw ERR_NO_VALID		- if the curve cannot be configured or shared.
+ */
+void ep_param_set_shared(int param);
+
+/**
+ * Releases the shared prime elliptic curve referenced by the current context,
+ * selecting the default curve and prime field if the shared ones were selected.
+ */
+void ep_param_release(void);
+
 /**
  * Configures some set of curve parameters for the current security level.
  */
@@ -679,6 +744,16 @@ void ep_rhs(fp_t rhs, const ep_t p);
  */
 int ep_is_valid(const ep_t p);
 
+/**
+ * Tests if all the points in an array are in the curve, without converting
+ * them to affine coordinates.
+ *
+ * @param[in] p				- the points to test.
+ * @param[in] n				- the number of points.
+ * @return 1 if all the points are valid, 0 otherwise.
+ */
+int ep_is_valid_bat(const ep_t *p, int n);
+
 /**
  * Builds a precomputation table for multiplying a random prime elliptic point.
  *
@@ -1060,6 +1135,20 @@ void ep_mul_sim_joint(ep_t r, const ep_t p, const bn_t k, const ep_t q,
  */
 void ep_mul_sim_gen(ep_t r, const bn_t k, const ep_t q, const bn_t m);
 
+/**
+ * Multiplies and adds many prime elliptic curve points simultaneously.
+ * Computes R = \sum k_iP_i. Interleaves width-w NAFs for a few points and
+ * uses Pippenger's bucket method for EP_LOT_BUCKET points or more. The
+ * integers are reduced modulo the order of the curve, so the points must be
+ * in the subgroup of that order.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to multiply.
+ * @param[in] k				- the integers.
+ * @param[in] n				- the number of points.
+ */
+void ep_mul_sim_lot(ep_t r, const ep_t *p, const bn_t *k, int n);
+
 /**
  * Converts a point to affine coordinates.
  *
@@ -1078,7 +1167,25 @@ void ep_norm(ep_t r, const ep_t p);
 void ep_norm_sim(ep_t *r, const ep_t *t, int n);
 
 /**
- * Maps a byte array to a point in a prime elliptic curve.
+ * Converts an arbitrarily large array of points to affine coordinates with a
+ * single inversion, keeping the intermediate products in a caller-supplied
+ * buffer of EP_BATCH(n) digits instead of the stack. If the buffer is NULL,
+ * it is allocated from the heap.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to convert.
+ * @param[in] n				- the number of points.
+ * @param[in] s				- the scratch buffer, or NULL.
+ * @throw ERR_NO_MEMORY		- if the scratch buffer cannot be allocated.
+ */
+void ep_norm_bat(ep_t *r, const ep_t *p, int n, dig_t *s);
+
+/**
+ * Maps a byte array to a point in a prime elliptic curve. Uses the method
+ * chosen with EP_MAP. With EP_MAP = SWU, uses the deterministic encoding when
+ * the curve supports it and try-and-increment otherwise. The two methods map
+ * the same input to different points, so switching between them changes the
+ * hash of every message.
  *
  * @param[out] p			- the result.
  * @param[in] msg			- the byte array to map.
@@ -1086,6 +1193,28 @@ void ep_norm_sim(ep_t *r, const ep_t *t, int n);
  */
 void ep_map(ep_t p, const uint8_t *msg, int len);
 
+/**
+ * Maps a byte array to a point in a prime elliptic curve using the
+ * try-and-increment method.
+ *
+ * @param[out] p			- the result.
+ * @param[in] msg			- the byte array to map.
+ * @param[in] len			- the array length in bytes.
+ */
+void ep_map_basic(ep_t p, const uint8_t *msg, int len);
+
+/**
+ * Maps a byte array to a point in a prime elliptic curve with a fixed number
+ * of field operations, using the Shallue-van de Woestijne encoding for curves
+ * with A = 0 and the simplified SWU encoding otherwise.
+ *
+ * @param[out] p			- the result.
+ * @param[in] msg			- the byte array to map.
+ * @param[in] len			- the array length in bytes.
+ * @throw ERR_NO_VALID		- if the curve does not support the encodings.
+ */
+void ep_map_swu(ep_t p, const uint8_t *msg, int len);
+
 /**
  * Compresses a point.
  *
@@ -1103,4 +1232,14 @@ void ep_pck(ep_t r, const ep_t p);
  */
 int ep_upk(ep_t r, const ep_t p);
 
+/**
+ * Decompresses an array of points.
+ *
+ * @param[out] r			- the results.
+ * @param[in] p				- the points to decompress.
+ * @param[in] n				- the number of points.
+ * @return a boolean value indicating if all decompressions were successful.
+ */
+int ep_upk_bat(ep_t *r, const ep_t *p, int n);
+
 #endif /* !RELIC_EP_H */
@@ -100,6 +100,12 @@
 #define EPX_TABLE_MAX MAX(EPX_TABLE_BASIC, EPX_TABLE_COMBD)
 #endif
 
+/**
+ * Number of digits of scratch space needed by the batch functions on N points
+ * over a quadratic extension, which only invert elements of the base field.
+ */
+#define EPX_BATCH(N)		((N) * FP_DIGS)
+
 
 /*============================================================================*/
 /* Type definitions                                                           */
@@ -295,6 +301,20 @@ typedef ep3_st *ep3_t;
 #define ep2_dbl(R, P)			ep2_dbl_projc(R, P);
 #endif
 
+/**
+ * Multiplies a prime elliptic point over a quadratic extension by an integer.
+ * Computes R = kP.
+ *
+ * @param[out] R				- the result.
+ * @param[in] P					- the point to multiply.
+ * @param[in] K					- the integer.
+ */
+#if EP2_MUL == BASIC
+#define ep2_mul(R, P, K)		ep2_mul_basic(R, P, K)
+#elif EP2_MUL == LWNAF
+#define ep2_mul(R, P, K)		ep2_mul_lwnaf(R, P, K)
+#endif
+
 /**
  * Builds a precomputation table for multiplying a fixed prime elliptic point
  * over a quadratic extension.
@@ -507,6 +527,16 @@ void ep2_rhs(fp2_t rhs, ep2_t p);
  */
 int ep2_is_valid(ep2_t p);
 
+/**
+ * Tests if all the points in an array are in the curve, without converting
+ * them to affine coordinates.
+ *
+ * @param[in] p				- the points to test.
+ * @param[in] n				- the number of points.
+ * @return 1 if all the points are valid, 0 otherwise.
+ */
+int ep2_is_valid_bat(ep2_t *p, int n);
+
 /**
  * Builds a precomputation table for multiplying a random prime elliptic point.
  *
@@ -656,13 +686,27 @@ void ep2_dbl_projc(ep2_t r, ep2_t p);
 
 /**
  * Multiplies a point in a elliptic curve over a quadratic extension by an
- * integer scalar.
+ * integer scalar using the binary method. The point does not need to lie in
+ * the prime-order subgroup.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] k				- the scalar.
+ */
+void ep2_mul_basic(ep2_t r, ep2_t p, bn_t k);
+
+/**
+ * Multiplies a point in a elliptic curve over a quadratic extension by an
+ * integer scalar using the left-to-right width-w NAF method. The point must
+ * lie in the prime-order subgroup, so that the scalar can be reduced modulo
+ * the order or, on BN curves, decomposed in four parts with the endomorphism
+ * psi.
  *
  * @param[out] r			- the result.
  * @param[in] p				- the point to multiply.
  * @param[in] k				- the scalar.
  */
-void ep2_mul(ep2_t r, ep2_t p, bn_t k);
+void ep2_mul_lwnaf(ep2_t r, ep2_t p, bn_t k);
 
 /**
  * Multiplies the generator of an elliptic curve over a qaudratic extension.
@@ -866,6 +910,20 @@ void ep2_mul_dig(ep2_t r, ep2_t p, dig_t k);
  */
 void ep2_norm(ep2_t r, ep2_t p);
 
+/**
+ * Converts an arbitrarily large array of points to affine coordinates with a
+ * single inversion in the base field, keeping the intermediate products in a
+ * caller-supplied buffer of EPX_BATCH(n) digits. If the buffer is NULL, it is
+ * allocated from the heap.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the points to convert.
+ * @param[in] n				- the number of points.
+ * @param[in] s				- the scratch buffer, or NULL.
+ * @throw ERR_NO_MEMORY		- if the scratch buffer cannot be allocated.
+ */
+void ep2_norm_bat(ep2_t *r, ep2_t *p, int n, dig_t *s);
+
 /**
  * Maps a byte array to a point in an elliptic curve over a quadratic extension.
  *
@@ -906,4 +964,18 @@ void ep2_pck(ep2_t r, ep2_t p);
  */
 int ep2_upk(ep2_t r, ep2_t p);
 
+/**
+ * Decompresses an array of points in an elliptic curve over a quadratic
+ * extension, sharing a single inversion among all the square roots. Points
+ * that fail to decompress are set to the point at infinity.
+ *
+ * @param[out] r			- the results.
+ * @param[in] p				- the points to decompress.
+ * @param[in] n				- the number of points.
+ * @param[in] s				- the scratch buffer of EPX_BATCH(n) digits, or NULL.
+ * @return if all the decompressions were successful.
+ * @throw ERR_NO_MEMORY		- if the scratch buffer cannot be allocated.
+ */
+int ep2_upk_bat(ep2_t *r, ep2_t *p, int n, dig_t *s);
+
 #endif /* !RELIC_EPX_H */
@@ -224,7 +224,54 @@ typedef struct _sts_t {
 		}																\
 	}																	\
 
-#ifdef CHECK
+/**
+ * Implements the TRY clause of the error-handling routines without non-local
+ * jumps.
+ *
+ * Errors are propagated through a sticky flag in the current library context,
+ * so entering the block has no cost. The program block is executed until the
+ * end, as functions return after throwing an error.
+ */
+#define ERR_FAST_TRY		if (1)
+
+/**
+ * Implements the CATCH clause of the error-handling routines without non-local
+ * jumps.
+ *
+ * If an error is pending in the current library context, it is consumed and
+ * the execution continues inside the CATCH block.
+ *
+ * @param[in] ADDR	- the address of the exception being caught
+ */
+#define ERR_FAST_CATCH(ADDR)											\
+	if (core_get()->pending && err_catch(ADDR))							\
+
+/**
+ * Implements the THROW clause of the error-handling routines without non-local
+ * jumps.
+ *
+ * The error is recorded in the current library context and the execution
+ * continues. A rethrown error (ERR_CAUGHT) keeps the original error number.
+ *
+ * @param[in] E		- the exception being caught.
+ */
+#define ERR_FAST_THROW(E)												\
+	{																	\
+		ctx_t *_ctx = core_get();										\
+		_ctx->code = STS_ERR;											\
+		if (E != ERR_CAUGHT) {											\
+			_ctx->number = E;											\
+		}																\
+		_ctx->pending = 1;												\
+		ERR_PRINT(E);													\
+	}																	\
+
+#if defined(CHECK) && defined(CHECK_FAST)
+/**
+ * Implements a TRY clause.
+ */
+#define TRY					ERR_FAST_TRY
+#elif defined(CHECK)
 /**
  * Implements a TRY clause.
  */
@@ -236,7 +283,12 @@ typedef struct _sts_t {
 #define TRY					if (1)
 #endif
 
-#ifdef CHECK
+#if defined(CHECK) && defined(CHECK_FAST)
+/**
+ * Implements a CATCH clause.
+ */
+#define CATCH(E)			ERR_FAST_CATCH(&(E))
+#elif defined(CHECK)
 /**
  * Implements a CATCH clause.
  */
@@ -248,7 +300,12 @@ typedef struct _sts_t {
 #define CATCH(E)			else
 #endif
 
-#ifdef CHECK
+#if defined(CHECK) && defined(CHECK_FAST)
+/**
+ * Implements a CATCH clause for any possible error.
+ */
+#define CATCH_ANY			ERR_FAST_CATCH(NULL)
+#elif defined(CHECK)
 /**
  * Implements a CATCH clause for any possible error.
  *
@@ -263,7 +320,7 @@ typedef struct _sts_t {
 #define CATCH_ANY			if (0)
 #endif
 
-#ifdef CHECK
+#if defined(CHECK) && !defined(CHECK_FAST)
 /**
  * Implements a FINALLY clause.
  */
@@ -272,7 +329,12 @@ typedef struct _sts_t {
 #define FINALLY				if (1)
 #endif
 
-#ifdef CHECK
+#if defined(CHECK) && defined(CHECK_FAST)
+/**
+ * Implements a THROW clause.
+ */
+#define THROW				ERR_FAST_THROW
+#elif defined(CHECK)
 /**
  * Implements a THROW clause.
  */
@@ -352,6 +414,18 @@ void err_full_msg(const char *function, const char *file,
  */
 void err_get_msg(err_t *e, char **msg);
 
+#ifdef CHECK_FAST
+
+/**
+ * Consumes the error pending in the current library context, if any.
+ *
+ * @param[out] e			- the error occurred, or NULL.
+ * @returns 1 if an error was pending, 0 otherwise.
+ */
+int err_catch(err_t *e);
+
+#endif
+
 #endif
 
 /**
@@ -179,6 +179,17 @@ typedef dig_t *fb_t;
  */
 typedef align dig_t fb_st[FB_DIGS + PADDING(FB_BYTES)/(FB_DIGIT / 8)];
 
+/**
+ * Represents the parameters of a binary field. The members are listed in
+ * relic_core.h, next to the library context.
+ */
+typedef struct _fb_field_st fb_field_st;
+
+/**
+ * Pointer to the parameters of a binary field.
+ */
+typedef fb_field_st *fb_field_t;
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -405,6 +416,22 @@ void fb_poly_init(void);
  */
 void fb_poly_clean(void);
 
+/**
+ * Returns the currently selected binary field.
+ *
+ * @return the parameters of the binary field.
+ */
+fb_field_t fb_field_get(void);
+
+/**
+ * Selects the binary field used by the arithmetic functions. The field must be
+ * initialized by fb_poly_init() the first time it is selected, and is then
+ * configured by the usual parameter-setting functions.
+ *
+ * @param[in] field			- the binary field, or NULL for the default field.
+ */
+void fb_field_set(fb_field_t field);
+
 /**
  * Returns the irreducible polynomial f(z) configured for the binary field.
  *
@@ -497,6 +524,13 @@ void fb_poly_get_trc(int *a, int *b, int *c);
  */
 const dig_t *fb_poly_get_slv(void);
 
+/**
+ * Returns the binary field parameter identifier.
+ *
+ * @return the parameter identifier.
+ */
+int fb_param_get(void);
+
 /**
  * Assigns a standard irreducible polynomial as modulo of the binary field.
  *
@@ -504,6 +538,24 @@ const dig_t *fb_poly_get_slv(void);
  */
 void fb_param_set(int param);
 
+/**
+ * Assigns a standard irreducible polynomial as modulo of the binary field,
+ * sharing the field and its precomputed tables read-only with every other
+ * context that selects the same polynomial. The first call builds the field
+ * once for the whole process, and later calls from any thread only reference
+ * it. The shared field is released by fb_param_release() or core_clean().
+ *
+ * @param[in] param			- the standardized polynomial identifier.
+ * @throw ERR_NO_VALID		- if the field cannot be configured or shared.
+ */
+void fb_param_set_shared(int param);
+
+/**
+ * Releases the shared binary field referenced by the current context,
+ * selecting the default field if the shared one was selected.
+ */
+void fb_param_release(void);
+
 /**
  * Configures some finite field parameters for the current security level.
  */
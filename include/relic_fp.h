@@ -159,6 +159,17 @@ typedef dig_t *fp_t;
  */
 typedef align dig_t fp_st[FP_DIGS + PADDING(FP_BYTES)/(FP_DIGIT / 8)];
 
+/**
+ * Represents the parameters of a prime field. The members are listed in
+ * relic_core.h, next to the library context.
+ */
+typedef struct _fp_field_st fp_field_st;
+
+/**
+ * Pointer to the parameters of a prime field.
+ */
+typedef fp_field_st *fp_field_t;
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -346,6 +357,8 @@ typedef align dig_t fp_st[FP_DIGS + PADDING(FP_BYTES)/(FP_DIGIT / 8)];
 #define fp_inv(C, A)	fp_inv_monty(C, A)
 #elif FP_INV == EXGCD
 #define fp_inv(C, A)	fp_inv_exgcd(C, A)
+#elif FP_INV == DIVST
+#define fp_inv(C, A)	fp_inv_divst(C, A)
 #elif FP_INV == LOWER
 #define fp_inv(C, A)	fp_inv_lower(C, A)
 #endif
@@ -379,6 +392,22 @@ void fp_prime_init(void);
  */
 void fp_prime_clean(void);
 
+/**
+ * Returns the currently selected prime field.
+ *
+ * @return the parameters of the prime field.
+ */
+fp_field_t fp_field_get(void);
+
+/**
+ * Selects the prime field used by the arithmetic functions. The field must be
+ * initialized by fp_prime_init() the first time it is selected, and is then
+ * configured by the usual parameter-setting functions.
+ *
+ * @param[in] field			- the prime field, or NULL for the default field.
+ */
+void fp_field_set(fp_field_t field);
+
 /**
  * Returns the order of the prime field.
  *
@@ -985,6 +1014,15 @@ void fp_inv_monty(fp_t c, const fp_t a);
  */
 void fp_inv_exgcd(fp_t c, const fp_t a);
 
+/**
+ * Inverts a prime field element in constant time using the divsteps of
+ * Bernstein and Yang.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the prime field element to invert.
+ */
+void fp_inv_divst(fp_t c, const fp_t a);
+
 /**
  * Inverts a prime field element using a direct call to the lower layer.
  *
@@ -1031,9 +1069,19 @@ void fp_exp_slide(fp_t c, const fp_t a, const bn_t b);
  */
 void fp_exp_monty(fp_t c, const fp_t a, const bn_t b);
 
+/**
+ * Tests if a prime field element is a quadratic residue.
+ *
+ * @param[in] a				- the prime field element to test.
+ * @return 1 if a is a square, 0 otherwise.
+ */
+int fp_is_sqr(const fp_t a);
+
 /**
  * Extracts the square root of a prime field element. Computes c = sqrt(a). The
- * other square root is the negation of c.
+ * other square root is the negation of c. The test for a root and the root
+ * itself come from the same exponentiation, so no separate call to fp_is_sqr()
+ * is needed.
  *
  * @param[out] c			- the result.
  * @param[in] a				- the prime field element.
@@ -1776,6 +1776,23 @@ void fp12_exp(fp12_t c, fp12_t a, bn_t b);
  */
 void fp12_exp_cyc(fp12_t c, fp12_t a, bn_t b);
 
+/**
+ * Computes a power of a dodecic extension field element in the order-n
+ * subgroup of a BN pairing target group. Decomposes the exponent into four
+ * parts using the Frobenius map and interleaves their width-w NAFs with
+ * cyclotomic squarings. Falls back to fp12_exp_cyc() for other curves.
+ *
+ * The basis must be in the order-n subgroup, as pairing values are: the
+ * decomposition is wrong for other elements of the cyclotomic subgroup and
+ * only membership in the cyclotomic subgroup is checked.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the basis.
+ * @param[in] b				- the exponent.
+ * @throw ERR_NO_VALID		- if the basis is not in the cyclotomic subgroup.
+ */
+void fp12_exp_cyc_gls(fp12_t c, fp12_t a, bn_t b);
+
 /**
  * Computes a power of a cyclotomic dodecic extension field element.
  *
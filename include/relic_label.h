@@ -50,11 +50,15 @@
 #undef core_clean
 #undef core_get
 #undef core_set
+#undef core_par_num
+#undef core_par
 
 #define core_init 	PREFIX(core_init)
 #define core_clean 	PREFIX(core_clean)
 #define core_get 	PREFIX(core_get)
 #define core_set 	PREFIX(core_set)
+#define core_par_num 	PREFIX(core_par_num)
+#define core_par 	PREFIX(core_par)
 
 #undef arch_init
 #undef arch_clean
@@ -86,11 +90,13 @@
 #undef err_full_msg
 #undef err_get_msg
 #undef err_get_code
+#undef err_catch
 
 #define err_simple_msg 	PREFIX(err_simple_msg)
 #define err_full_msg 	PREFIX(err_full_msg)
 #define err_get_msg 	PREFIX(err_get_msg)
 #define err_get_code 	PREFIX(err_get_code)
+#define err_catch 		PREFIX(err_catch)
 
 #undef rand_init
 #undef rand_clean
@@ -104,9 +110,17 @@
 #define rand_seed 	PREFIX(rand_seed)
 #define rand_bytes 	PREFIX(rand_bytes)
 
+#undef pool_init
+#undef pool_clean
+#undef pool_arena
+#undef pool_stats
 #undef pool_get
 #undef pool_put
 
+#define pool_init 	PREFIX(pool_init)
+#define pool_clean 	PREFIX(pool_clean)
+#define pool_arena 	PREFIX(pool_arena)
+#define pool_stats 	PREFIX(pool_stats)
 #define pool_get 	PREFIX(pool_get)
 #define pool_put 	PREFIX(pool_put)
 
@@ -230,6 +244,7 @@
 #undef bn_mod_2b
 #undef bn_mod_dig
 #undef bn_mod_basic
+#undef bn_mod_inv
 #undef bn_mod_pre_barrt
 #undef bn_mod_barrt
 #undef bn_mod_pre_monty
@@ -242,6 +257,7 @@
 #undef bn_mxp_basic
 #undef bn_mxp_slide
 #undef bn_mxp_monty
+#undef bn_mxp_fixed
 #undef bn_mxp_dig
 #undef bn_srt
 #undef bn_gcd_basic
@@ -261,6 +277,7 @@
 #undef bn_is_prime_basic
 #undef bn_is_prime_rabin
 #undef bn_is_prime_solov
+#undef bn_is_prime_bpsw
 #undef bn_gen_prime_basic
 #undef bn_gen_prime_safep
 #undef bn_gen_prime_stron
@@ -276,6 +293,7 @@
 #undef bn_rec_reg
 #undef bn_rec_jsf
 #undef bn_rec_glv
+#undef bn_rec_frb
 
 #define bn_init 	PREFIX(bn_init)
 #define bn_clean 	PREFIX(bn_clean)
@@ -332,6 +350,7 @@
 #define bn_mod_2b 	PREFIX(bn_mod_2b)
 #define bn_mod_dig 	PREFIX(bn_mod_dig)
 #define bn_mod_basic 	PREFIX(bn_mod_basic)
+#define bn_mod_inv 	PREFIX(bn_mod_inv)
 #define bn_mod_pre_barrt 	PREFIX(bn_mod_pre_barrt)
 #define bn_mod_barrt 	PREFIX(bn_mod_barrt)
 #define bn_mod_pre_monty 	PREFIX(bn_mod_pre_monty)
@@ -344,6 +363,7 @@
 #define bn_mxp_basic 	PREFIX(bn_mxp_basic)
 #define bn_mxp_slide 	PREFIX(bn_mxp_slide)
 #define bn_mxp_monty 	PREFIX(bn_mxp_monty)
+#define bn_mxp_fixed 	PREFIX(bn_mxp_fixed)
 #define bn_mxp_dig 	PREFIX(bn_mxp_dig)
 #define bn_srt 	PREFIX(bn_srt)
 #define bn_gcd_basic 	PREFIX(bn_gcd_basic)
@@ -363,6 +383,7 @@
 #define bn_is_prime_basic 	PREFIX(bn_is_prime_basic)
 #define bn_is_prime_rabin 	PREFIX(bn_is_prime_rabin)
 #define bn_is_prime_solov 	PREFIX(bn_is_prime_solov)
+#define bn_is_prime_bpsw 	PREFIX(bn_is_prime_bpsw)
 #define bn_gen_prime_basic 	PREFIX(bn_gen_prime_basic)
 #define bn_gen_prime_safep 	PREFIX(bn_gen_prime_safep)
 #define bn_gen_prime_stron 	PREFIX(bn_gen_prime_stron)
@@ -378,6 +399,7 @@
 #define bn_rec_reg 	PREFIX(bn_rec_reg)
 #define bn_rec_jsf 	PREFIX(bn_rec_jsf)
 #define bn_rec_glv 	PREFIX(bn_rec_glv)
+#define bn_rec_frb 	PREFIX(bn_rec_frb)
 
 #undef bn_add1_low
 #undef bn_addn_low
@@ -430,6 +452,8 @@
 
 #undef fp_prime_init
 #undef fp_prime_clean
+#undef fp_field_get
+#undef fp_field_set
 #undef fp_prime_get
 #undef fp_prime_get_rdc
 #undef fp_prime_get_conv
@@ -502,14 +526,18 @@
 #undef fp_inv_monty
 #undef fp_inv_exgcd
 #undef fp_inv_lower
+#undef fp_inv_divst
 #undef fp_inv_sim
 #undef fp_exp_basic
 #undef fp_exp_slide
 #undef fp_exp_monty
+#undef fp_is_sqr
 #undef fp_srt
 
 #define fp_prime_init 	PREFIX(fp_prime_init)
 #define fp_prime_clean 	PREFIX(fp_prime_clean)
+#define fp_field_get 	PREFIX(fp_field_get)
+#define fp_field_set 	PREFIX(fp_field_set)
 #define fp_prime_get 	PREFIX(fp_prime_get)
 #define fp_prime_get_rdc 	PREFIX(fp_prime_get_rdc)
 #define fp_prime_get_conv 	PREFIX(fp_prime_get_conv)
@@ -582,10 +610,12 @@
 #define fp_inv_monty 	PREFIX(fp_inv_monty)
 #define fp_inv_exgcd 	PREFIX(fp_inv_exgcd)
 #define fp_inv_lower 	PREFIX(fp_inv_lower)
+#define fp_inv_divst 	PREFIX(fp_inv_divst)
 #define fp_inv_sim 	PREFIX(fp_inv_sim)
 #define fp_exp_basic 	PREFIX(fp_exp_basic)
 #define fp_exp_slide 	PREFIX(fp_exp_slide)
 #define fp_exp_monty 	PREFIX(fp_exp_monty)
+#define fp_is_sqr 	PREFIX(fp_is_sqr)
 #define fp_srt 	PREFIX(fp_srt)
 
 #undef fp_add1_low
@@ -662,6 +692,8 @@
 #undef fb_poly_init
 #undef fb_poly_clean
 #undef fb_poly_get
+#undef fb_field_get
+#undef fb_field_set
 #undef fb_poly_set_dense
 #undef fb_poly_set_trino
 #undef fb_poly_set_penta
@@ -672,7 +704,10 @@
 #undef fb_poly_get_rdc
 #undef fb_poly_get_trc
 #undef fb_poly_get_slv
+#undef fb_param_get
 #undef fb_param_set
+#undef fb_param_set_shared
+#undef fb_param_release
 #undef fb_param_set_any
 #undef fb_param_print
 #undef fb_poly_add
@@ -737,6 +772,8 @@
 #define fb_poly_init 	PREFIX(fb_poly_init)
 #define fb_poly_clean 	PREFIX(fb_poly_clean)
 #define fb_poly_get 	PREFIX(fb_poly_get)
+#define fb_field_get 	PREFIX(fb_field_get)
+#define fb_field_set 	PREFIX(fb_field_set)
 #define fb_poly_set_dense 	PREFIX(fb_poly_set_dense)
 #define fb_poly_set_trino 	PREFIX(fb_poly_set_trino)
 #define fb_poly_set_penta 	PREFIX(fb_poly_set_penta)
@@ -747,7 +784,10 @@
 #define fb_poly_get_rdc 	PREFIX(fb_poly_get_rdc)
 #define fb_poly_get_trc 	PREFIX(fb_poly_get_trc)
 #define fb_poly_get_slv 	PREFIX(fb_poly_get_slv)
+#define fb_param_get 	PREFIX(fb_param_get)
 #define fb_param_set 	PREFIX(fb_param_set)
+#define fb_param_set_shared 	PREFIX(fb_param_set_shared)
+#define fb_param_release 	PREFIX(fb_param_release)
 #define fb_param_set_any 	PREFIX(fb_param_set_any)
 #define fb_param_print 	PREFIX(fb_param_print)
 #define fb_poly_add 	PREFIX(fb_poly_add)
@@ -870,8 +910,11 @@
 
 #undef ep_curve_init
 #undef ep_curve_clean
+#undef ep_curve_get
+#undef ep_curve_set
 #undef ep_curve_get_a
 #undef ep_curve_get_b
+#undef ep_curve_get_map
 #undef ep_curve_get_beta
 #undef ep_curve_get_v1
 #undef ep_curve_get_v2
@@ -887,6 +930,8 @@
 #undef ep_curve_set_super
 #undef ep_curve_set_endom
 #undef ep_param_set
+#undef ep_param_set_shared
+#undef ep_param_release
 #undef ep_param_set_any
 #undef ep_param_set_any_plain
 #undef ep_param_set_any_endom
@@ -903,6 +948,7 @@
 #undef ep_rand
 #undef ep_rhs
 #undef ep_is_valid
+#undef ep_is_valid_bat
 #undef ep_tab
 #undef ep_print
 #undef ep_size_bin
@@ -942,16 +988,24 @@
 #undef ep_mul_sim_inter
 #undef ep_mul_sim_joint
 #undef ep_mul_sim_gen
+#undef ep_mul_sim_lot
 #undef ep_norm
 #undef ep_norm_sim
+#undef ep_norm_bat
 #undef ep_map
+#undef ep_map_basic
+#undef ep_map_swu
 #undef ep_pck
 #undef ep_upk
+#undef ep_upk_bat
 
 #define ep_curve_init 	PREFIX(ep_curve_init)
 #define ep_curve_clean 	PREFIX(ep_curve_clean)
+#define ep_curve_get 	PREFIX(ep_curve_get)
+#define ep_curve_set 	PREFIX(ep_curve_set)
 #define ep_curve_get_a 	PREFIX(ep_curve_get_a)
 #define ep_curve_get_b 	PREFIX(ep_curve_get_b)
+#define ep_curve_get_map 	PREFIX(ep_curve_get_map)
 #define ep_curve_get_beta 	PREFIX(ep_curve_get_beta)
 #define ep_curve_get_v1 	PREFIX(ep_curve_get_v1)
 #define ep_curve_get_v2 	PREFIX(ep_curve_get_v2)
@@ -967,6 +1021,8 @@
 #define ep_curve_set_super 	PREFIX(ep_curve_set_super)
 #define ep_curve_set_endom 	PREFIX(ep_curve_set_endom)
 #define ep_param_set 	PREFIX(ep_param_set)
+#define ep_param_set_shared 	PREFIX(ep_param_set_shared)
+#define ep_param_release 	PREFIX(ep_param_release)
 #define ep_param_set_any 	PREFIX(ep_param_set_any)
 #define ep_param_set_any_plain 	PREFIX(ep_param_set_any_plain)
 #define ep_param_set_any_endom 	PREFIX(ep_param_set_any_endom)
@@ -983,6 +1039,7 @@
 #define ep_rand 	PREFIX(ep_rand)
 #define ep_rhs 	PREFIX(ep_rhs)
 #define ep_is_valid 	PREFIX(ep_is_valid)
+#define ep_is_valid_bat 	PREFIX(ep_is_valid_bat)
 #define ep_tab 	PREFIX(ep_tab)
 #define ep_print 	PREFIX(ep_print)
 #define ep_size_bin 	PREFIX(ep_size_bin)
@@ -1022,11 +1079,16 @@
 #define ep_mul_sim_inter 	PREFIX(ep_mul_sim_inter)
 #define ep_mul_sim_joint 	PREFIX(ep_mul_sim_joint)
 #define ep_mul_sim_gen 	PREFIX(ep_mul_sim_gen)
+#define ep_mul_sim_lot 	PREFIX(ep_mul_sim_lot)
 #define ep_norm 	PREFIX(ep_norm)
 #define ep_norm_sim 	PREFIX(ep_norm_sim)
+#define ep_norm_bat 	PREFIX(ep_norm_bat)
 #define ep_map 	PREFIX(ep_map)
+#define ep_map_basic 	PREFIX(ep_map_basic)
+#define ep_map_swu 	PREFIX(ep_map_swu)
 #define ep_pck 	PREFIX(ep_pck)
 #define ep_upk 	PREFIX(ep_upk)
+#define ep_upk_bat 	PREFIX(ep_upk_bat)
 
 #undef eb_st
 #undef eb_t
@@ -1201,6 +1263,7 @@
 #undef ep2_rand
 #undef ep2_rhs
 #undef ep2_is_valid
+#undef ep2_is_valid_bat
 #undef ep2_tab
 #undef ep2_print
 #undef ep2_size_bin
@@ -1216,7 +1279,8 @@
 #undef ep2_dbl_basic
 #undef ep2_dbl_slp_basic
 #undef ep2_dbl_projc
-#undef ep2_mul
+#undef ep2_mul_basic
+#undef ep2_mul_lwnaf
 #undef ep2_mul_gen
 #undef ep2_mul_pre_basic
 #undef ep2_mul_pre_yaowi
@@ -1237,10 +1301,12 @@
 #undef ep2_mul_sim_gen
 #undef ep2_mul_dig
 #undef ep2_norm
+#undef ep2_norm_bat
 #undef ep2_map
 #undef ep2_frb
 #undef ep2_pck
 #undef ep2_upk
+#undef ep2_upk_bat
 
 #define ep2_curve_init 	PREFIX(ep2_curve_init)
 #define ep2_curve_clean 	PREFIX(ep2_curve_clean)
@@ -1261,6 +1327,7 @@
 #define ep2_rand 	PREFIX(ep2_rand)
 #define ep2_rhs 	PREFIX(ep2_rhs)
 #define ep2_is_valid 	PREFIX(ep2_is_valid)
+#define ep2_is_valid_bat 	PREFIX(ep2_is_valid_bat)
 #define ep2_tab 	PREFIX(ep2_tab)
 #define ep2_print 	PREFIX(ep2_print)
 #define ep2_size_bin 	PREFIX(ep2_size_bin)
@@ -1276,7 +1343,8 @@
 #define ep2_dbl_basic 	PREFIX(ep2_dbl_basic)
 #define ep2_dbl_slp_basic 	PREFIX(ep2_dbl_slp_basic)
 #define ep2_dbl_projc 	PREFIX(ep2_dbl_projc)
-#define ep2_mul 	PREFIX(ep2_mul)
+#define ep2_mul_basic 	PREFIX(ep2_mul_basic)
+#define ep2_mul_lwnaf 	PREFIX(ep2_mul_lwnaf)
 #define ep2_mul_gen 	PREFIX(ep2_mul_gen)
 #define ep2_mul_pre_basic 	PREFIX(ep2_mul_pre_basic)
 #define ep2_mul_pre_yaowi 	PREFIX(ep2_mul_pre_yaowi)
@@ -1297,10 +1365,12 @@
 #define ep2_mul_sim_gen 	PREFIX(ep2_mul_sim_gen)
 #define ep2_mul_dig 	PREFIX(ep2_mul_dig)
 #define ep2_norm 	PREFIX(ep2_norm)
+#define ep2_norm_bat 	PREFIX(ep2_norm_bat)
 #define ep2_map 	PREFIX(ep2_map)
 #define ep2_frb 	PREFIX(ep2_frb)
 #define ep2_pck 	PREFIX(ep2_pck)
 #define ep2_upk 	PREFIX(ep2_upk)
+#define ep2_upk_bat 	PREFIX(ep2_upk_bat)
 
 #undef fp2_st
 #undef fp2_t
@@ -1609,6 +1679,7 @@
 #undef fp12_frb
 #undef fp12_exp
 #undef fp12_exp_cyc
+#undef fp12_exp_cyc_gls
 #undef fp12_exp_cyc_sps
 #undef fp12_pck
 #undef fp12_upk
@@ -1648,6 +1719,7 @@
 #define fp12_frb 	PREFIX(fp12_frb)
 #define fp12_exp 	PREFIX(fp12_exp)
 #define fp12_exp_cyc 	PREFIX(fp12_exp_cyc)
+#define fp12_exp_cyc_gls 	PREFIX(fp12_exp_cyc_gls)
 #define fp12_exp_cyc_sps 	PREFIX(fp12_exp_cyc_sps)
 #define fp12_pck 	PREFIX(fp12_pck)
 #define fp12_upk 	PREFIX(fp12_upk)
@@ -1753,6 +1825,13 @@
 #undef pp_map_tatep_k12
 #undef pp_map_weilp_k12
 #undef pp_map_oatep_k12
+#undef pp_map_sim_tatep_k2
+#undef pp_map_sim_weilp_k2
+#undef pp_map_sim_tatep_k12
+#undef pp_map_sim_weilp_k12
+#undef pp_map_sim_oatep_k12
+#undef pp_map_pre_oatep_k12
+#undef pp_map_fix_oatep_k12
 
 #define pp_map_init 	PREFIX(pp_map_init)
 #define pp_map_clean 	PREFIX(pp_map_clean)
@@ -1779,6 +1858,33 @@
 #define pp_map_tatep_k12 	PREFIX(pp_map_tatep_k12)
 #define pp_map_weilp_k12 	PREFIX(pp_map_weilp_k12)
 #define pp_map_oatep_k12 	PREFIX(pp_map_oatep_k12)
+#define pp_map_sim_tatep_k2 	PREFIX(pp_map_sim_tatep_k2)
+#define pp_map_sim_weilp_k2 	PREFIX(pp_map_sim_weilp_k2)
+#define pp_map_sim_tatep_k12 	PREFIX(pp_map_sim_tatep_k12)
+#define pp_map_sim_weilp_k12 	PREFIX(pp_map_sim_weilp_k12)
+#define pp_map_sim_oatep_k12 	PREFIX(pp_map_sim_oatep_k12)
+#define pp_map_pre_oatep_k12 	PREFIX(pp_map_pre_oatep_k12)
+#define pp_map_fix_oatep_k12 	PREFIX(pp_map_fix_oatep_k12)
+
+#undef g1_dlog_pre
+#undef g2_dlog_pre
+#undef gt_dlog_pre
+#undef g1_dlog
+#undef g2_dlog
+#undef gt_dlog
+#undef pc_dlog_size_bin
+#undef pc_dlog_read_bin
+#undef pc_dlog_write_bin
+
+#define g1_dlog_pre 	PREFIX(g1_dlog_pre)
+#define g2_dlog_pre 	PREFIX(g2_dlog_pre)
+#define gt_dlog_pre 	PREFIX(gt_dlog_pre)
+#define g1_dlog 	PREFIX(g1_dlog)
+#define g2_dlog 	PREFIX(g2_dlog)
+#define gt_dlog 	PREFIX(gt_dlog)
+#define pc_dlog_size_bin 	PREFIX(pc_dlog_size_bin)
+#define pc_dlog_read_bin 	PREFIX(pc_dlog_read_bin)
+#define pc_dlog_write_bin 	PREFIX(pc_dlog_write_bin)
 
 #undef rsa_t
 #undef rabin_t
@@ -1791,6 +1897,7 @@
 
 #undef cp_rsa_gen_basic
 #undef cp_rsa_gen_quick
+#undef cp_rsa_gen_multi
 #undef cp_rsa_enc
 #undef cp_rsa_dec_basic
 #undef cp_rsa_dec_quick
@@ -1837,9 +1944,15 @@
 #undef cp_bls_gen
 #undef cp_bls_sig
 #undef cp_bls_ver
+#undef cp_bls_agg
+#undef cp_bls_ver_agg
+#undef cp_bls_ver_batch
 #undef cp_bbs_gen
 #undef cp_bbs_sig
 #undef cp_bbs_ver
+#undef cp_zss_gen
+#undef cp_zss_sig
+#undef cp_zss_ver
 #undef cp_vbnn_ibs_kgc_gen
 #undef cp_vbnn_ibs_kgc_extract_key
 #undef cp_vbnn_ibs_user_sign
@@ -1847,6 +1960,7 @@
 
 #define cp_rsa_gen_basic 	PREFIX(cp_rsa_gen_basic)
 #define cp_rsa_gen_quick 	PREFIX(cp_rsa_gen_quick)
+#define cp_rsa_gen_multi 	PREFIX(cp_rsa_gen_multi)
 #define cp_rsa_enc 	PREFIX(cp_rsa_enc)
 #define cp_rsa_dec_basic 	PREFIX(cp_rsa_dec_basic)
 #define cp_rsa_dec_quick 	PREFIX(cp_rsa_dec_quick)
@@ -1893,9 +2007,15 @@
 #define cp_bls_gen 	PREFIX(cp_bls_gen)
 #define cp_bls_sig 	PREFIX(cp_bls_sig)
 #define cp_bls_ver 	PREFIX(cp_bls_ver)
+#define cp_bls_agg 	PREFIX(cp_bls_agg)
+#define cp_bls_ver_agg 	PREFIX(cp_bls_ver_agg)
+#define cp_bls_ver_batch 	PREFIX(cp_bls_ver_batch)
 #define cp_bbs_gen 	PREFIX(cp_bbs_gen)
 #define cp_bbs_sig 	PREFIX(cp_bbs_sig)
 #define cp_bbs_ver 	PREFIX(cp_bbs_ver)
+#define cp_zss_gen 	PREFIX(cp_zss_gen)
+#define cp_zss_sig 	PREFIX(cp_zss_sig)
+#define cp_zss_ver 	PREFIX(cp_zss_ver)
 #define cp_vbnn_ibs_kgc_gen 	PREFIX(cp_vbnn_ibs_kgc_gen)
 #define cp_vbnn_ibs_kgc_extract_key 	PREFIX(cp_vbnn_ibs_kgc_extract_key)
 #define cp_vbnn_ibs_user_sign 	PREFIX(cp_vbnn_ibs_user_sign)
@@ -79,6 +79,32 @@ enum {
 #define MD_LEN					MD_LEN_BLAKE2s_256
 #endif
 
+/**
+ * Size in bytes of the internal state of an incremental hash computation,
+ * large enough for any of the supported hash functions.
+ */
+#define MD_CTX_BYTES			256
+
+/*============================================================================*/
+/* Type definitions                                                           */
+/*============================================================================*/
+
+/**
+ * Represents the internal state of an incremental hash computation.
+ */
+typedef struct _md_ctx_st {
+	/** The state of the underlying hash function, aligned to 64 bits. */
+	union {
+		uint64_t word;
+		uint8_t state[MD_CTX_BYTES];
+	} u;
+} md_ctx_st;
+
+/**
+ * Pointer to the internal state of an incremental hash computation.
+ */
+typedef md_ctx_st md_ctx_t[1];
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -107,6 +133,73 @@ enum {
 #define md_map(H, M, L)			md_map_blake2s_256(H, M, L)
 #endif
 
+/**
+ * Initializes an incremental hash computation using the chosen hash function.
+ *
+ * @param[out] C				- the hash state.
+ */
+#if MD_MAP == SHONE
+#define md_init(C)				md_init_shone(C)
+#elif MD_MAP == SH224
+#define md_init(C)				md_init_sh224(C)
+#elif MD_MAP == SH256
+#define md_init(C)				md_init_sh256(C)
+#elif MD_MAP == SH384
+#define md_init(C)				md_init_sh384(C)
+#elif MD_MAP == SH512
+#define md_init(C)				md_init_sh512(C)
+#elif MD_MAP == BLAKE2S_160
+#define md_init(C)				md_init_blake2s_160(C)
+#elif MD_MAP == BLAKE2S_256
+#define md_init(C)				md_init_blake2s_256(C)
+#endif
+
+/**
+ * Appends a byte vector to an incremental hash computation using the chosen
+ * hash function.
+ *
+ * @param[in,out] C				- the hash state.
+ * @param[in] M					- the message to hash.
+ * @param[in] L					- the message length in bytes.
+ */
+#if MD_MAP == SHONE
+#define md_update(C, M, L)		md_update_shone(C, M, L)
+#elif MD_MAP == SH224
+#define md_update(C, M, L)		md_update_sh224(C, M, L)
+#elif MD_MAP == SH256
+#define md_update(C, M, L)		md_update_sh256(C, M, L)
+#elif MD_MAP == SH384
+#define md_update(C, M, L)		md_update_sh384(C, M, L)
+#elif MD_MAP == SH512
+#define md_update(C, M, L)		md_update_sh512(C, M, L)
+#elif MD_MAP == BLAKE2S_160
+#define md_update(C, M, L)		md_update_blake2s_160(C, M, L)
+#elif MD_MAP == BLAKE2S_256
+#define md_update(C, M, L)		md_update_blake2s_256(C, M, L)
+#endif
+
+/**
+ * Finishes an incremental hash computation using the chosen hash function.
+ *
+ * @param[out] H				- the digest.
+ * @param[in,out] C				- the hash state.
+ */
+#if MD_MAP == SHONE
+#define md_final(H, C)			md_final_shone(H, C)
+#elif MD_MAP == SH224
+#define md_final(H, C)			md_final_sh224(H, C)
+#elif MD_MAP == SH256
+#define md_final(H, C)			md_final_sh256(H, C)
+#elif MD_MAP == SH384
+#define md_final(H, C)			md_final_sh384(H, C)
+#elif MD_MAP == SH512
+#define md_final(H, C)			md_final_sh512(H, C)
+#elif MD_MAP == BLAKE2S_160
+#define md_final(H, C)			md_final_blake2s_160(H, C)
+#elif MD_MAP == BLAKE2S_256
+#define md_final(H, C)			md_final_blake2s_256(H, C)
+#endif
+
 /*============================================================================*/
 /* Function prototypes                                                        */
 /*============================================================================*/
@@ -182,6 +275,181 @@ void md_map_blake2s_160(uint8_t *hash, const uint8_t *msg, int len);
  */
 void md_map_blake2s_256(uint8_t *hash, const uint8_t *msg, int len);
 
+/**
+ * Initializes an incremental computation of the SHA-1 hash function.
+ *
+ * @param[out] ctx				- the hash state.
+ */
+void md_init_shone(md_ctx_t ctx);
+
+/**
+ * Appends a byte vector to an incremental computation of the SHA-1 hash
+ * function.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message to hash.
+ * @param[in] len				- the message length in bytes.
+ */
+void md_update_shone(md_ctx_t ctx, const uint8_t *msg, int len);
+
+/**
+ * Finishes an incremental computation of the SHA-1 hash function.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ */
+void md_final_shone(uint8_t *hash, md_ctx_t ctx);
+
+/**
+ * Initializes an incremental computation of the SHA-224 hash function.
+ *
+ * @param[out] ctx				- the hash state.
+ */
+void md_init_sh224(md_ctx_t ctx);
+
+/**
+ * Appends a byte vector to an incremental computation of the SHA-224 hash
+ * function.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message to hash.
+ * @param[in] len				- the message length in bytes.
+ */
+void md_update_sh224(md_ctx_t ctx, const uint8_t *msg, int len);
+
+/**
+ * Finishes an incremental computation of the SHA-224 hash function.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ */
+void md_final_sh224(uint8_t *hash, md_ctx_t ctx);
+
+/**
+ * Initializes an incremental computation of the SHA-256 hash function.
+ *
+ * @param[out] ctx				- the hash state.
+ */
+void md_init_sh256(md_ctx_t ctx);
+
+/**
+ * Appends a byte vector to an incremental computation of the SHA-256 hash
+ * function.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message to hash.
+ * @param[in] len				- the message length in bytes.
+ */
+void md_update_sh256(md_ctx_t ctx, const uint8_t *msg, int len);
+
+/**
+ * Finishes an incremental computation of the SHA-256 hash function.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ */
+void md_final_sh256(uint8_t *hash, md_ctx_t ctx);
+
+/**
+ * Initializes an incremental computation of the SHA-384 hash function.
+ *
+ * @param[out] ctx				- the hash state.
+ */
+void md_init_sh384(md_ctx_t ctx);
+
+/**
+ * Appends a byte vector to an incremental computation of the SHA-384 hash
+ * function.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message to hash.
+ * @param[in] len				- the message length in bytes.
+ */
+void md_update_sh384(md_ctx_t ctx, const uint8_t *msg, int len);
+
+/**
+ * Finishes an incremental computation of the SHA-384 hash function.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ */
+void md_final_sh384(uint8_t *hash, md_ctx_t ctx);
+
+/**
+ * Initializes an incremental computation of the SHA-512 hash function.
+ *
+ * @param[out] ctx				- the hash state.
+ */
+void md_init_sh512(md_ctx_t ctx);
+
+/**
+ * Appends a byte vector to an incremental computation of the SHA-512 hash
+ * function.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message to hash.
+ * @param[in] len				- the message length in bytes.
+ */
+void md_update_sh512(md_ctx_t ctx, const uint8_t *msg, int len);
+
+/**
+ * Finishes an incremental computation of the SHA-512 hash function.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ */
+void md_final_sh512(uint8_t *hash, md_ctx_t ctx);
+
+/**
+ * Initializes an incremental computation of the BLAKE2s-160 hash function.
+ *
+ * @param[out] ctx				- the hash state.
+ */
+void md_init_blake2s_160(md_ctx_t ctx);
+
+/**
+ * Appends a byte vector to an incremental computation of the BLAKE2s-160 hash
+ * function.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message to hash.
+ * @param[in] len				- the message length in bytes.
+ */
+void md_update_blake2s_160(md_ctx_t ctx, const uint8_t *msg, int len);
+
+/**
+ * Finishes an incremental computation of the BLAKE2s-160 hash function.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ */
+void md_final_blake2s_160(uint8_t *hash, md_ctx_t ctx);
+
+/**
+ * Initializes an incremental computation of the BLAKE2s-256 hash function.
+ *
+ * @param[out] ctx				- the hash state.
+ */
+void md_init_blake2s_256(md_ctx_t ctx);
+
+/**
+ * Appends a byte vector to an incremental computation of the BLAKE2s-256 hash
+ * function.
+ *
+ * @param[in,out] ctx			- the hash state.
+ * @param[in] msg				- the message to hash.
+ * @param[in] len				- the message length in bytes.
+ */
+void md_update_blake2s_256(md_ctx_t ctx, const uint8_t *msg, int len);
+
+/**
+ * Finishes an incremental computation of the BLAKE2s-256 hash function.
+ *
+ * @param[out] hash				- the digest.
+ * @param[in,out] ctx			- the hash state.
+ */
+void md_final_blake2s_256(uint8_t *hash, md_ctx_t ctx);
+
 /**
  * Derives a key from shared secret material through the standardized KDF1
  * function.
@@ -118,10 +118,105 @@ typedef CAT(G2_LOWER, st) g2_st;
  */
 typedef CAT(GT_LOWER, t) gt_t;
 
+/**
+ * Represents a table of baby steps for computing bounded discrete logarithms.
+ */
+typedef struct _pc_dlog_st {
+	/** The number of baby steps. */
+	int step;
+	/** The number of slots in the hash table, a power of two. */
+	int size;
+	/** The fingerprints of the compressed baby steps. */
+	uint64_t *key;
+	/** The indices of the baby steps, zero for empty slots. */
+	int *idx;
+} pc_dlog_st;
+
+/**
+ * Pointer to a table of baby steps.
+ */
+#if ALLOC == AUTO
+typedef pc_dlog_st pc_dlog_t[1];
+#else
+typedef pc_dlog_st *pc_dlog_t;
+#endif
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
 
+/**
+ * Initializes a table of baby steps with a null value.
+ *
+ * @param[out] A			- the table to initialize.
+ */
+#if ALLOC == AUTO
+#define pc_dlog_null(A)		/* empty */
+#else
+#define pc_dlog_null(A)		A = NULL;
+#endif
+
+/**
+ * Calls a function to allocate an empty table of baby steps.
+ *
+ * @param[out] A			- the new table.
+ */
+#if ALLOC == DYNAMIC
+#define pc_dlog_new(A)														\
+	A = (pc_dlog_t)calloc(1, sizeof(pc_dlog_st));							\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+
+#elif ALLOC == STATIC || ALLOC == STACK
+#define pc_dlog_new(A)														\
+	A = (pc_dlog_t)alloca(sizeof(pc_dlog_st));								\
+	if (A == NULL) {														\
+		THROW(ERR_NO_MEMORY);												\
+	}																		\
+	(A)->step = (A)->size = 0;												\
+	(A)->key = NULL;														\
+	(A)->idx = NULL;														\
+
+#elif ALLOC == AUTO
+#define pc_dlog_new(A)														\
+	(A)->step = (A)->size = 0;												\
+	(A)->key = NULL;														\
+	(A)->idx = NULL;														\
+
+#endif
+
+/**
+ * Calls a function to clean and free a table of baby steps.
+ *
+ * @param[out] A			- the table to clean and free.
+ */
+#if ALLOC == DYNAMIC
+#define pc_dlog_free(A)														\
+	if (A != NULL) {														\
+		free((A)->key);														\
+		free((A)->idx);														\
+		free(A);															\
+		A = NULL;															\
+	}
+
+#elif ALLOC == STATIC || ALLOC == STACK
+#define pc_dlog_free(A)														\
+	if (A != NULL) {														\
+		free((A)->key);														\
+		free((A)->idx);														\
+		A = NULL;															\
+	}
+
+#elif ALLOC == AUTO
+#define pc_dlog_free(A)														\
+	free((A)->key);															\
+	free((A)->idx);															\
+	(A)->key = NULL;														\
+	(A)->idx = NULL;														\
+
+#endif
+
 /**
  * Initializes a G_1 element with a null value.
  *
@@ -657,7 +752,11 @@ typedef CAT(GT_LOWER, t) gt_t;
  * @param[in] P				- the element to exponentiate.
  * @param[in] K				- the integer.
  */
+#if FP_PRIME < 1536
+#define gt_exp(R, P, K)		fp12_exp_cyc_gls(R, P, K)
+#else
 #define gt_exp(R, P, K)		CAT(GT_LOWER, exp)(R, P, K)
+#endif
 
 /**
  * Multiplies the generator of G_1 by an integer.
@@ -787,6 +886,22 @@ typedef CAT(GT_LOWER, t) gt_t;
 #define pc_map(R, P, Q);	CAT(PC_LOWER, map_k2)(R, P, Q)
 #endif
 
+/**
+ * Computes the product of the bilinear pairings of pairs of G_1 and G_2
+ * elements, sharing the Miller loop and the final exponentiation. Computes
+ * R = \prod e(P_i, Q_i).
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first elements.
+ * @param[in] Q				- the second elements.
+ * @param[in] M				- the number of pairings to evaluate.
+ */
+#if FP_PRIME < 1536
+#define pc_map_sim(R, P, Q, M)	CAT(PC_LOWER, map_sim_k12)(R, P, Q, M)
+#else
+#define pc_map_sim(R, P, Q, M)	CAT(PC_LOWER, map_sim_k2)(R, P, Q, M)
+#endif
+
 /**
  * Computes the final exponentiation of the pairing.
  *
@@ -817,4 +932,106 @@ void gt_rand(gt_t a);
   */
 void gt_get_gen(gt_t a);
 
+/**
+ * Precomputes a table of baby steps iG for 1 <= i <= m to compute discrete
+ * logarithms to the base G in G_1.
+ *
+ * @param[out] t			- the table.
+ * @param[in] g				- the base.
+ * @param[in] m				- the number of baby steps.
+ * @throw ERR_NO_MEMORY		- if the table cannot be allocated.
+ */
+void g1_dlog_pre(pc_dlog_t t, g1_t g, int m);
+
+/**
+ * Precomputes a table of baby steps iG for 1 <= i <= m to compute discrete
+ * logarithms to the base G in G_2.
+ *
+ * @param[out] t			- the table.
+ * @param[in] g				- the base.
+ * @param[in] m				- the number of baby steps.
+ * @throw ERR_NO_MEMORY		- if the table cannot be allocated.
+ */
+void g2_dlog_pre(pc_dlog_t t, g2_t g, int m);
+
+/**
+ * Precomputes a table of baby steps g^i for 1 <= i <= m to compute discrete
+ * logarithms to the base g in G_T.
+ *
+ * @param[out] t			- the table.
+ * @param[in] g				- the base.
+ * @param[in] m				- the number of baby steps.
+ * @throw ERR_NO_MEMORY		- if the table cannot be allocated.
+ */
+void gt_dlog_pre(pc_dlog_t t, gt_t g, int m);
+
+/**
+ * Computes a bounded discrete logarithm in G_1 with the baby-step giant-step
+ * method. Finds 0 <= k <= max such that A = kG using about max/m giant steps.
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] t				- the table of baby steps precomputed for G.
+ * @param[in] g				- the base.
+ * @param[in] a				- the element to find the logarithm of.
+ * @param[in] max			- the bound on the logarithm.
+ * @return STS_OK if the logarithm was found, STS_ERR otherwise.
+ */
+int g1_dlog(dig_t *k, pc_dlog_t t, g1_t g, g1_t a, dig_t max);
+
+/**
+ * Computes a bounded discrete logarithm in G_2 with the baby-step giant-step
+ * method. Finds 0 <= k <= max such that A = kG using about max/m giant steps.
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] t				- the table of baby steps precomputed for G.
+ * @param[in] g				- the base.
+ * @param[in] a				- the element to find the logarithm of.
+ * @param[in] max			- the bound on the logarithm.
+ * @return STS_OK if the logarithm was found, STS_ERR otherwise.
+ */
+int g2_dlog(dig_t *k, pc_dlog_t t, g2_t g, g2_t a, dig_t max);
+
+/**
+ * Computes a bounded discrete logarithm in G_T with the baby-step giant-step
+ * method. Finds 0 <= k <= max such that a = g^k using about max/m giant steps.
+ *
+ * @param[out] k			- the discrete logarithm.
+ * @param[in] t				- the table of baby steps precomputed for g.
+ * @param[in] g				- the base.
+ * @param[in] a				- the element to find the logarithm of.
+ * @param[in] max			- the bound on the logarithm.
+ * @return STS_OK if the logarithm was found, STS_ERR otherwise.
+ */
+int gt_dlog(dig_t *k, pc_dlog_t t, gt_t g, gt_t a, dig_t max);
+
+/**
+ * Returns the number of bytes necessary to store a table of baby steps.
+ *
+ * @param[in] t				- the table.
+ * @return the number of bytes.
+ */
+int pc_dlog_size_bin(pc_dlog_t t);
+
+/**
+ * Reads a table of baby steps from a byte vector.
+ *
+ * @param[out] t			- the table.
+ * @param[in] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is not correct.
+ * @throw ERR_NO_VALID		- if the encoded table is invalid.
+ * @throw ERR_NO_MEMORY		- if the table cannot be allocated.
+ */
+void pc_dlog_read_bin(pc_dlog_t t, const uint8_t *bin, int len);
+
+/**
+ * Writes a table of baby steps to a byte vector.
+ *
+ * @param[out] bin			- the byte vector.
+ * @param[in] len			- the buffer capacity.
+ * @param[in] t				- the table.
+ * @throw ERR_NO_BUFFER		- if the buffer capacity is not correct.
+ */
+void pc_dlog_write_bin(uint8_t *bin, int len, pc_dlog_t t);
+
 #endif /* !RELIC_PC_H */
@@ -62,6 +62,17 @@
 /** Indicates that the pool is empty. */
 #define POOL_EMPTY (-1)
 
+/**
+ * Alignment of the pool elements carved from an arena.
+ */
+#define POOL_ALIGN	(MAX(ALIGN, sizeof(dig_t)))
+
+/**
+ * Size in bytes of an arena holding N pool elements, including the slack
+ * needed to align its start.
+ */
+#define POOL_BYTES(N)	((N) * sizeof(pool_t) + POOL_ALIGN)
+
 #endif
 
 /*============================================================================*/
@@ -72,9 +83,15 @@
  * Type that represents a element of a pool of digit vectors.
  */
 typedef struct {
-	/** Indicates if this pool element is being used. */
+#ifdef CHECK
+	/** Indicates if this pool element is being used, to catch double frees. */
 	int state;
-	/** The pool element. The extra digit stores the pool position. */
+#endif
+	/**
+	 * The pool element. While the element is free, its first digit stores
+	 * the position of the next free element. The extra digit stores the pool
+	 * position.
+	 */
 	align dig_t elem[DV_DIGS + 1];
 } pool_t;
 
@@ -84,6 +101,46 @@ typedef struct {
 
 #if ALLOC == STATIC
 
+/**
+ * Initializes the pool of the current library context, linking all its
+ * elements in the free list. The pool is carved from the arena supplied by
+ * the last call to pool_arena(), if any. Otherwise, the first context of each
+ * thread takes the static pool and the other contexts allocate an arena of
+ * POOL_SIZE elements.
+ *
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+int pool_init(void);
+
+/**
+ * Finalizes the pool of the current library context, releasing the static
+ * pool or the arena allocated by pool_init().
+ */
+void pool_clean(void);
+
+/**
+ * Supplies an arena from which the pool of the next library context
+ * initialized by the calling thread is carved. This allows several contexts
+ * to share a single allocation, by passing disjoint parts of it before each
+ * call to core_init(). The arena is aligned internally and at most POOL_SIZE
+ * elements are used; POOL_BYTES() gives the size needed for a number of
+ * elements. A null arena reverts to the default pool.
+ *
+ * @param[in] arena			- the memory region used by the pool.
+ * @param[in] len			- the number of bytes in the memory region.
+ * @return STS_OK if the arena holds at least one element, STS_ERR otherwise.
+ */
+int pool_arena(void *arena, int len);
+
+/**
+ * Reads the usage statistics of the pool of the current library context.
+ *
+ * @param[out] used			- the number of elements currently allocated.
+ * @param[out] peak			- the highest number of elements allocated at once.
+ * @param[out] size			- the number of elements in the pool.
+ */
+void pool_stats(int *used, int *peak, int *size);
+
 /**
  * Gets a new element from the static pool.
  *
@@ -95,6 +152,7 @@ dig_t *pool_get(void);
  * Restores an element to the static pool.
  *
  * @param[in] a			- the address to free.
+ * @throw ERR_NO_VALID		- if the element is not in use, with CHECK on.
  */
 void pool_put(dig_t *a);
 
@@ -40,6 +40,18 @@
 #include "relic_epx.h"
 #include "relic_types.h"
 
+/*============================================================================*/
+/* Constant definitions                                                       */
+/*============================================================================*/
+
+/**
+ * Size of a precomputation table of line functions for pairings with a fixed
+ * argument. The loop parameter of the supported curves has about a quarter of
+ * the bits of the prime, and each bit needs a doubling line and possibly an
+ * addition line. Each line is stored as its three nonzero coefficients.
+ */
+#define PP_TABLE		(3 * (FP_BITS / 4 + 16))
+
 /*============================================================================*/
 /* Macro definitions                                                          */
 /*============================================================================*/
@@ -200,6 +212,63 @@
 #define pp_map_k12(R, P, Q)				pp_map_oatep_k12(R, P, Q)
 #endif
 
+/**
+ * Computes a multi-pairing of elliptic curve points defined on an elliptic
+ * curve of embedding degree 2. Computes \prod e(P_i, Q_i).
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first pairing arguments.
+ * @param[in] Q				- the second pairing arguments.
+ * @param[in] M				- the number of pairings to evaluate.
+ */
+#if PP_MAP == TATEP
+#define pp_map_sim_k2(R, P, Q, M)		pp_map_sim_tatep_k2(R, P, Q, M)
+#elif PP_MAP == WEILP
+#define pp_map_sim_k2(R, P, Q, M)		pp_map_sim_weilp_k2(R, P, Q, M)
+#elif PP_MAP == OATEP
+#define pp_map_sim_k2(R, P, Q, M)		pp_map_sim_tatep_k2(R, P, Q, M)
+#endif
+
+/**
+ * Computes a multi-pairing of elliptic curve points defined on an elliptic
+ * curve of embedding degree 12. Computes \prod e(P_i, Q_i).
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first pairing arguments.
+ * @param[in] Q				- the second pairing arguments.
+ * @param[in] M				- the number of pairings to evaluate.
+ */
+#if PP_MAP == TATEP
+#define pp_map_sim_k12(R, P, Q, M)		pp_map_sim_tatep_k12(R, P, Q, M)
+#elif PP_MAP == WEILP
+#define pp_map_sim_k12(R, P, Q, M)		pp_map_sim_weilp_k12(R, P, Q, M)
+#elif PP_MAP == OATEP
+#define pp_map_sim_k12(R, P, Q, M)		pp_map_sim_oatep_k12(R, P, Q, M)
+#endif
+
+/**
+ * Precomputes the line functions of a pairing with a fixed second argument
+ * defined over a curve of embedding degree 12.
+ *
+ * @param[out] T			- the table of precomputed line functions.
+ * @param[in] Q				- the fixed elliptic curve point.
+ */
+#if PP_MAP == OATEP
+#define pp_map_pre_k12(T, Q)			pp_map_pre_oatep_k12(T, Q)
+#endif
+
+/**
+ * Computes a pairing with a fixed second argument defined over a curve of
+ * embedding degree 12 using precomputed line functions. Computes e(P, Q).
+ *
+ * @param[out] R			- the result.
+ * @param[in] P				- the first elliptic curve point.
+ * @param[in] T				- the line functions precomputed for Q.
+ */
+#if PP_MAP == OATEP
+#define pp_map_fix_k12(R, P, T)			pp_map_fix_oatep_k12(R, P, T)
+#endif
+
 /*============================================================================*/
 /* Function prototypes                                                        */
 /*============================================================================*/
@@ -466,4 +535,80 @@ void pp_map_weilp_k12(fp12_t r, ep_t p, ep2_t q);
  */
 void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q);
 
+/**
+ * Computes the Tate multi-pairing in a parameterized elliptic curve with
+ * embedding degree 2.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
+ * @param[in] m				- the number of pairings to evaluate.
+ */
+void pp_map_sim_tatep_k2(fp2_t r, ep_t *p, ep_t *q, int m);
+
+/**
+ * Computes the Weil multi-pairing in a parameterized elliptic curve with
+ * embedding degree 2.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
+ * @param[in] m				- the number of pairings to evaluate.
+ */
+void pp_map_sim_weilp_k2(fp2_t r, ep_t *p, ep_t *q, int m);
+
+/**
+ * Computes the Tate multi-pairing in a parameterized elliptic curve with
+ * embedding degree 12.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
+ * @param[in] m				- the number of pairings to evaluate.
+ */
+void pp_map_sim_tatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
+
+/**
+ * Computes the Weil multi-pairing in a parameterized elliptic curve with
+ * embedding degree 12.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
+ * @param[in] m				- the number of pairings to evaluate.
+ */
+void pp_map_sim_weilp_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
+
+/**
+ * Computes the optimal ate multi-pairing in a parameterized elliptic
+ * curve with embedding degree 12.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first pairing arguments.
+ * @param[in] q				- the second pairing arguments.
+ * @param[in] m				- the number of pairings to evaluate.
+ */
+void pp_map_sim_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m);
+
+/**
+ * Precomputes the line functions of the optimal ate pairing with a fixed second
+ * argument in a parameterized elliptic curve with embedding degree 12.
+ *
+ * @param[out] t			- the table of PP_TABLE line coefficients.
+ * @param[in] q				- the fixed elliptic curve point.
+ * @throw ERR_NO_BUFFER		- if the table cannot hold all the line functions.
+ */
+void pp_map_pre_oatep_k12(fp2_t *t, ep2_t q);
+
+/**
+ * Computes the optimal ate pairing with a fixed second argument in a
+ * parameterized elliptic curve with embedding degree 12 using precomputed
+ * line functions.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the first elliptic curve point.
+ * @param[in] t				- the line functions precomputed for the second point.
+ */
+void pp_map_fix_oatep_k12(fp12_t r, ep_t p, fp2_t *t);
+
 #endif /* !RELIC_PP_H */
@@ -41,6 +41,11 @@
 /* Constant definitions                                                       */
 /*============================================================================*/
 
+/**
+ * Number of pre-generated bytes kept by the CTR-DRBG generator.
+ */
+#define RAND_BUF		512
+
 /**
  * Size of the PRNG internal state in bytes.
  */
@@ -52,6 +57,8 @@
 #define RAND_SIZE		(1 + 2*888/8)
 #endif
 
+#elif RAND == CTR
+#define RAND_SIZE		(RAND_BUF + 32 + 16)
 #elif RAND == UDEV
 #define RAND_SIZE		(sizeof(int))
 #elif RAND == FIPS
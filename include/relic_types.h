@@ -39,6 +39,14 @@
 #include <gmp.h>
 #endif
 
+#if ALLOC == STATIC || ALLOC == STACK
+#if OPSYS == WINDOWS
+#include <malloc.h>
+#else
+#include <alloca.h>
+#endif
+#endif
+
 /*============================================================================*/
 /* Constant definitions                                                       */
 /*============================================================================*/
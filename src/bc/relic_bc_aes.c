@@ -20,11 +20,17 @@
  * along with RELIC. If not, see <http://www.gnu.org/licenses/>.
  */
 
+
 /**
  * @file
  *
  * Implementation of the AES block cipher.
  *
+ * The cipher is computed with the AES-NI instructions when the processor
+ * supports them, and otherwise with a constant-time software implementation
+ * that evaluates the S-box bitsliced over up to four blocks at once. Neither
+ * implementation uses secret-dependent table lookups.
+ *
  * @ingroup bc
  */
 
@@ -32,55 +38,936 @@
 
 #include "relic_core.h"
 #include "relic_err.h"
+#include "relic_util.h"
 #include "relic_bc.h"
-#include "rijndael-api-fst.h"
+
+#if ARCH == X64 && defined(__GNUC__)
+#include <cpuid.h>
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+#define BC_AESNI
+#endif
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Maximum number of rounds, reached by AES-256.
+ */
+#define BC_ROUNDS	14
+
+/**
+ * Number of blocks encrypted in parallel with AES-NI.
+ */
+#define BC_WAY		8
+
+/**
+ * Number of blocks encrypted in parallel by the bitsliced implementation, such
+ * that each bit of the 64 state bytes fits in a 64-bit slice.
+ */
+#define BC_CT		4
+
+/**
+ * Represents an expanded AES key.
+ */
+typedef struct _bc_key_t {
+	/** The encryption round keys. */
+	uint8_t ek[BC_LEN * (BC_ROUNDS + 1)];
+	/** The decryption round keys for AES-NI, in reverse order. */
+	uint8_t dk[BC_LEN * (BC_ROUNDS + 1)];
+	/** The number of rounds. */
+	int nr;
+} bc_key_t;
+
+/**
+ * Increments the rightmost bytes of a counter block, interpreted as a
+ * big-endian integer.
+ *
+ * @param[in,out] ctr		- the counter block.
+ * @param[in] len			- the number of bytes to increment.
+ */
+static void bc_inc(uint8_t *ctr, int len) {
+	for (int i = BC_LEN - 1; i >= BC_LEN - len; i--) {
+		if (++ctr[i] != 0) {
+			break;
+		}
+	}
+}
+
+/**
+ * Multiplies a byte by x in GF(2^8) in constant time.
+ *
+ * @param[in] b				- the byte.
+ * @return the product.
+ */
+static uint8_t bc_xt(uint8_t b) {
+	return (uint8_t)((b << 1) ^ (0x1B & -(b >> 7)));
+}
+
+/**
+ * Multiplies two bitsliced vectors of elements of GF(2^8), where slice i
+ * holds bit i of each element.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first vector.
+ * @param[in] b				- the second vector.
+ */
+static void bc_gf_mul(uint64_t *c, const uint64_t *a, const uint64_t *b) {
+	uint64_t p[15] = { 0 };
+	int i, j;
+
+	for (i = 0; i < 8; i++) {
+		for (j = 0; j < 8; j++) {
+			p[i + j] ^= a[i] & b[j];
+		}
+	}
+	/* Reduce modulo x^8 + x^4 + x^3 + x + 1. */
+	for (i = 14; i >= 8; i--) {
+		p[i - 4] ^= p[i];
+		p[i - 5] ^= p[i];
+		p[i - 7] ^= p[i];
+		p[i - 8] ^= p[i];
+	}
+	memcpy(c, p, 8 * sizeof(uint64_t));
+}
+
+/**
+ * Applies the S-box or its inverse to a sequence of at most 64 bytes, in
+ * constant time. The inversion in GF(2^8) is computed as x^254 over bitsliced
+ * elements.
+ *
+ * @param[in,out] s			- the bytes.
+ * @param[in] len			- the number of bytes.
+ * @param[in] inv			- the flag to apply the inverse S-box.
+ */
+static void bc_sub(uint8_t *s, int len, int inv) {
+	uint64_t x[8] = { 0 }, t[8], u[8];
+	int i, j;
+
+	for (i = 0; i < len; i++) {
+		for (j = 0; j < 8; j++) {
+			x[j] |= (uint64_t)((s[i] >> j) & 1) << i;
+		}
+	}
+
+	if (inv) {
+		/* Undo the affine transformation. */
+		for (j = 0; j < 8; j++) {
+			t[j] = x[(j + 2) % 8] ^ x[(j + 5) % 8] ^ x[(j + 7) % 8];
+			t[j] ^= -(uint64_t)((0x05 >> j) & 1);
+		}
+		memcpy(x, t, sizeof(x));
+	}
+
+	/* u = x^(2^7 - 1), then x^254 = u^2. */
+	memcpy(u, x, sizeof(u));
+	for (i = 0; i < 6; i++) {
+		bc_gf_mul(u, u, u);
+		bc_gf_mul(u, u, x);
+	}
+	bc_gf_mul(u, u, u);
+
+	if (!inv) {
+		/* Apply the affine transformation. */
+		for (j = 0; j < 8; j++) {
+			t[j] = u[j] ^ u[(j + 4) % 8] ^ u[(j + 5) % 8] ^ u[(j + 6) % 8] ^
+					u[(j + 7) % 8];
+			t[j] ^= -(uint64_t)((0x63 >> j) & 1);
+		}
+	} else {
+		memcpy(t, u, sizeof(t));
+	}
+
+	for (i = 0; i < len; i++) {
+		s[i] = 0;
+		for (j = 0; j < 8; j++) {
+			s[i] |= ((t[j] >> i) & 1) << j;
+		}
+	}
+}
+
+/**
+ * Applies the ShiftRows transformation or its inverse to a block.
+ *
+ * @param[in,out] b			- the block.
+ * @param[in] inv			- the flag to apply the inverse.
+ */
+static void bc_shift(uint8_t *b, int inv) {
+	uint8_t t[BC_LEN];
+
+	memcpy(t, b, BC_LEN);
+	for (int r = 1; r < 4; r++) {
+		for (int c = 0; c < 4; c++) {
+			if (inv) {
+				b[r + 4 * ((c + r) % 4)] = t[r + 4 * c];
+			} else {
+				b[r + 4 * c] = t[r + 4 * ((c + r) % 4)];
+			}
+		}
+	}
+}
+
+/**
+ * Applies the MixColumns transformation or its inverse to a block.
+ *
+ * @param[in,out] b			- the block.
+ * @param[in] inv			- the flag to apply the inverse.
+ */
+static void bc_mix(uint8_t *b, int inv) {
+	uint8_t *a, t, u, v, a0;
+
+	for (int c = 0; c < 4; c++) {
+		a = b + 4 * c;
+		if (inv) {
+			/* The inverse matrix factors as the direct one times a sparse one. */
+			u = bc_xt(bc_xt(a[0] ^ a[2]));
+			v = bc_xt(bc_xt(a[1] ^ a[3]));
+			a[0] ^= u;
+			a[1] ^= v;
+			a[2] ^= u;
+			a[3] ^= v;
+		}
+		t = a[0] ^ a[1] ^ a[2] ^ a[3];
+		a0 = a[0];
+		a[0] ^= t ^ bc_xt(a[0] ^ a[1]);
+		a[1] ^= t ^ bc_xt(a[1] ^ a[2]);
+		a[2] ^= t ^ bc_xt(a[2] ^ a[3]);
+		a[3] ^= t ^ bc_xt(a[3] ^ a0);
+	}
+}
+
+/**
+ * Encrypts up to BC_CT blocks with the constant-time implementation.
+ *
+ * @param[out] out			- the ciphertext blocks.
+ * @param[in] in			- the plaintext blocks.
+ * @param[in] n				- the number of blocks.
+ * @param[in] k				- the expanded key.
+ */
+static void bc_enc_ct(uint8_t *out, const uint8_t *in, int n,
+		const bc_key_t *k) {
+	uint8_t s[BC_CT * BC_LEN];
+	int i, j, r, l = n * BC_LEN;
+
+	for (i = 0; i < l; i++) {
+		s[i] = in[i] ^ k->ek[i % BC_LEN];
+	}
+	for (r = 1; r <= k->nr; r++) {
+		bc_sub(s, l, 0);
+		for (j = 0; j < n; j++) {
+			bc_shift(s + j * BC_LEN, 0);
+			if (r < k->nr) {
+				bc_mix(s + j * BC_LEN, 0);
+			}
+		}
+		for (i = 0; i < l; i++) {
+			s[i] ^= k->ek[r * BC_LEN + i % BC_LEN];
+		}
+	}
+	memcpy(out, s, l);
+}
+
+/**
+ * Decrypts up to BC_CT blocks with the constant-time implementation.
+ *
+ * @param[out] out			- the plaintext blocks.
+ * @param[in] in			- the ciphertext blocks.
+ * @param[in] n				- the number of blocks.
+ * @param[in] k				- the expanded key.
+ */
+static void bc_dec_ct(uint8_t *out, const uint8_t *in, int n,
+		const bc_key_t *k) {
+	uint8_t s[BC_CT * BC_LEN];
+	int i, j, r, l = n * BC_LEN;
+
+	for (i = 0; i < l; i++) {
+		s[i] = in[i] ^ k->ek[k->nr * BC_LEN + i % BC_LEN];
+	}
+	for (r = k->nr - 1; r >= 0; r--) {
+		for (j = 0; j < n; j++) {
+			bc_shift(s + j * BC_LEN, 1);
+		}
+		bc_sub(s, l, 1);
+		for (i = 0; i < l; i++) {
+			s[i] ^= k->ek[r * BC_LEN + i % BC_LEN];
+		}
+		for (j = 0; r > 0 && j < n; j++) {
+			bc_mix(s + j * BC_LEN, 1);
+		}
+	}
+	memcpy(out, s, l);
+}
+
+/**
+ * Multiplies an element of GF(2^128) by the hash key in constant time, with
+ * the bit-reflected convention of GCM.
+ *
+ * @param[in,out] x			- the element.
+ * @param[in] h				- the hash key.
+ */
+static void bc_gf_mul128(uint8_t *x, const uint8_t *h) {
+	uint64_t m, w, zh = 0, zl = 0, vh = 0, vl = 0, xh = 0, xl = 0;
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		vh = (vh << 8) | h[i];
+		vl = (vl << 8) | h[i + 8];
+		xh = (xh << 8) | x[i];
+		xl = (xl << 8) | x[i + 8];
+	}
+	for (i = 0; i < 128; i++) {
+		w = (i < 64 ? xh : xl);
+		m = -((w >> (63 - (i & 63))) & 1);
+		zh ^= vh & m;
+		zl ^= vl & m;
+		m = -(vl & 1);
+		vl = (vl >> 1) | (vh << 63);
+		vh = (vh >> 1) ^ (0xE100000000000000ULL & m);
+	}
+	for (i = 7; i >= 0; i--) {
+		x[i] = (uint8_t)zh;
+		x[i + 8] = (uint8_t)zl;
+		zh >>= 8;
+		zl >>= 8;
+	}
+}
+
+/**
+ * Absorbs a sequence of bytes into the GHASH state with the constant-time
+ * implementation. The last block is padded with zeros.
+ *
+ * @param[in,out] y			- the GHASH state.
+ * @param[in] h				- the hash key.
+ * @param[in] in			- the bytes to absorb.
+ * @param[in] len			- the number of bytes.
+ */
+static void bc_ghash_ct(uint8_t *y, const uint8_t *h, const uint8_t *in,
+		int len) {
+	int i, l;
+
+	while (len > 0) {
+		l = MIN(len, BC_LEN);
+		for (i = 0; i < l; i++) {
+			y[i] ^= in[i];
+		}
+		bc_gf_mul128(y, h);
+		in += l;
+		len -= l;
+	}
+}
+
+/**
+ * Flag indicating if the instruction set extensions may be used.
+ */
+static int bc_ext = 1;
+
+#ifdef BC_AESNI
+
+/**
+ * Checks if the processor supports an instruction set extension, given by a
+ * bit of the ECX register returned by CPUID leaf 1. The register is cached
+ * after the first call.
+ *
+ * @param[in] bit			- the feature bit.
+ * @return 1 if the extension is supported and enabled, 0 otherwise.
+ */
+static int bc_cpu(int bit) {
+	static int init = 0;
+	static unsigned int ecx = 0;
+	unsigned int a, b, d;
+
+	if (!init) {
+		if (!__get_cpuid(1, &a, &b, &ecx, &d)) {
+			ecx = 0;
+		}
+		init = 1;
+	}
+	return bc_ext & (ecx >> bit) & 1;
+}
+
+/**
+ * Checks if AES-NI can be used, that is, bit 25 of ECX.
+ */
+#define bc_aes_ni()		bc_cpu(25)
+
+/**
+ * Checks if the carry-less multiplier can be used, that is, the PCLMULQDQ and
+ * SSSE3 bits 1 and 9 of ECX.
+ */
+#define bc_clmul()		(bc_cpu(1) && bc_cpu(9))
+
+/**
+ * Applies the S-box to a word of the key schedule with AESKEYGENASSIST.
+ *
+ * @param[in,out] t			- the word.
+ */
+__attribute__((target("aes,sse2")))
+static void bc_sub_ni(uint8_t *t) {
+	uint32_t w;
+	__m128i x;
+
+	memcpy(&w, t, sizeof(uint32_t));
+	/* The first word of the result is the S-box applied to the second one. */
+	x = _mm_aeskeygenassist_si128(_mm_set_epi32(0, 0, (int)w, 0), 0);
+	w = (uint32_t)_mm_cvtsi128_si32(x);
+	memcpy(t, &w, sizeof(uint32_t));
+}
+
+/**
+ * Computes the decryption round keys for AES-NI.
+ *
+ * @param[in,out] k			- the expanded key.
+ */
+__attribute__((target("aes,sse2")))
+static void bc_dkey_ni(bc_key_t *k) {
+	__m128i t;
+
+	memcpy(k->dk, k->ek + k->nr * BC_LEN, BC_LEN);
+	for (int i = 1; i < k->nr; i++) {
+		t = _mm_loadu_si128((__m128i *)(k->ek + (k->nr - i) * BC_LEN));
+		_mm_storeu_si128((__m128i *)(k->dk + i * BC_LEN), _mm_aesimc_si128(t));
+	}
+	memcpy(k->dk + k->nr * BC_LEN, k->ek, BC_LEN);
+}
+
+/**
+ * Encrypts up to BC_WAY blocks with AES-NI, interleaving the rounds of the
+ * independent blocks to fill the pipeline.
+ *
+ * @param[out] out			- the ciphertext blocks.
+ * @param[in] in			- the plaintext blocks.
+ * @param[in] n				- the number of blocks.
+ * @param[in] k				- the expanded key.
+ */
+__attribute__((target("aes,sse2")))
+static void bc_enc_ni(uint8_t *out, const uint8_t *in, int n,
+		const bc_key_t *k) {
+	__m128i r[BC_ROUNDS + 1], b[BC_WAY];
+	int i, j;
+
+	for (i = 0; i <= BC_ROUNDS; i++) {
+		r[i] = _mm_loadu_si128((__m128i *)(k->ek + i * BC_LEN));
+	}
+	for (j = 0; j < n; j++) {
+		b[j] = _mm_loadu_si128((__m128i *)(in + j * BC_LEN));
+		b[j] = _mm_xor_si128(b[j], r[0]);
+	}
+	for (i = 1; i < k->nr; i++) {
+		for (j = 0; j < n; j++) {
+			b[j] = _mm_aesenc_si128(b[j], r[i]);
+		}
+	}
+	for (j = 0; j < n; j++) {
+		b[j] = _mm_aesenclast_si128(b[j], r[k->nr]);
+		_mm_storeu_si128((__m128i *)(out + j * BC_LEN), b[j]);
+	}
+}
+
+/**
+ * Decrypts up to BC_WAY blocks with AES-NI.
+ *
+ * @param[out] out			- the plaintext blocks.
+ * @param[in] in			- the ciphertext blocks.
+ * @param[in] n				- the number of blocks.
+ * @param[in] k				- the expanded key.
+ */
+__attribute__((target("aes,sse2")))
+static void bc_dec_ni(uint8_t *out, const uint8_t *in, int n,
+		const bc_key_t *k) {
+	__m128i r[BC_ROUNDS + 1], b[BC_WAY];
+	int i, j;
+
+	for (i = 0; i <= BC_ROUNDS; i++) {
+		r[i] = _mm_loadu_si128((__m128i *)(k->dk + i * BC_LEN));
+	}
+	for (j = 0; j < n; j++) {
+		b[j] = _mm_loadu_si128((__m128i *)(in + j * BC_LEN));
+		b[j] = _mm_xor_si128(b[j], r[0]);
+	}
+	for (i = 1; i < k->nr; i++) {
+		for (j = 0; j < n; j++) {
+			b[j] = _mm_aesdec_si128(b[j], r[i]);
+		}
+	}
+	for (j = 0; j < n; j++) {
+		b[j] = _mm_aesdeclast_si128(b[j], r[k->nr]);
+		_mm_storeu_si128((__m128i *)(out + j * BC_LEN), b[j]);
+	}
+}
+
+/**
+ * Absorbs a sequence of bytes into the GHASH state with PCLMULQDQ. The
+ * operands are byte-reversed so that the carry-less product can be shifted
+ * and reduced as in the Intel white paper on GCM.
+ *
+ * @param[in,out] y			- the GHASH state.
+ * @param[in] h				- the hash key.
+ * @param[in] in			- the bytes to absorb.
+ * @param[in] len			- the number of bytes.
+ */
+__attribute__((target("pclmul,ssse3,sse2")))
+static void bc_ghash_ni(uint8_t *y, const uint8_t *h, const uint8_t *in,
+		int len) {
+	__m128i a, b, c, d, e, f, g, rev;
+	uint8_t t[BC_LEN];
+	int l;
+
+	rev = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	a = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)y), rev);
+	b = _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)h), rev);
+
+	while (len > 0) {
+		l = MIN(len, BC_LEN);
+		memset(t, 0, BC_LEN);
+		memcpy(t, in, l);
+		a = _mm_xor_si128(a, _mm_shuffle_epi8(_mm_loadu_si128((__m128i *)t),
+						rev));
+
+		/* Compute the 256-bit carry-less product (f, c). */
+		c = _mm_clmulepi64_si128(a, b, 0x00);
+		d = _mm_clmulepi64_si128(a, b, 0x10);
+		e = _mm_clmulepi64_si128(a, b, 0x01);
+		f = _mm_clmulepi64_si128(a, b, 0x11);
+		d = _mm_xor_si128(d, e);
+		e = _mm_slli_si128(d, 8);
+		d = _mm_srli_si128(d, 8);
+		c = _mm_xor_si128(c, e);
+		f = _mm_xor_si128(f, d);
+
+		/* Shift the product left by one bit due to the reflection. */
+		d = _mm_srli_epi32(c, 31);
+		e = _mm_srli_epi32(f, 31);
+		c = _mm_slli_epi32(c, 1);
+		f = _mm_slli_epi32(f, 1);
+		g = _mm_srli_si128(d, 12);
+		e = _mm_slli_si128(e, 4);
+		d = _mm_slli_si128(d, 4);
+		c = _mm_or_si128(c, d);
+		f = _mm_or_si128(f, e);
+		f = _mm_or_si128(f, g);
+
+		/* Reduce modulo x^128 + x^7 + x^2 + x + 1. */
+		d = _mm_slli_epi32(c, 31);
+		e = _mm_slli_epi32(c, 30);
+		g = _mm_slli_epi32(c, 25);
+		d = _mm_xor_si128(d, e);
+		d = _mm_xor_si128(d, g);
+		e = _mm_srli_si128(d, 4);
+		d = _mm_slli_si128(d, 12);
+		c = _mm_xor_si128(c, d);
+		d = _mm_srli_epi32(c, 1);
+		g = _mm_srli_epi32(c, 2);
+		d = _mm_xor_si128(d, g);
+		g = _mm_srli_epi32(c, 7);
+		d = _mm_xor_si128(d, g);
+		d = _mm_xor_si128(d, e);
+		c = _mm_xor_si128(c, d);
+		a = _mm_xor_si128(f, c);
+
+		in += l;
+		len -= l;
+	}
+	_mm_storeu_si128((__m128i *)y, _mm_shuffle_epi8(a, rev));
+}
+
+#endif /* BC_AESNI */
+
+/**
+ * Applies the S-box to a word of the key schedule.
+ *
+ * @param[in,out] t			- the word.
+ */
+static void bc_sub_word(uint8_t *t) {
+#ifdef BC_AESNI
+	if (bc_aes_ni()) {
+		bc_sub_ni(t);
+	} else {
+		bc_sub(t, 4, 0);
+	}
+#else
+	bc_sub(t, 4, 0);
+#endif
+}
+
+/**
+ * Expands an AES key.
+ *
+ * @param[out] k			- the expanded key.
+ * @param[in] key			- the key.
+ * @param[in] key_len		- the key size in bits.
+ * @return STS_OK if no errors occurred, STS_ERR otherwise.
+ */
+static int bc_aes_key(bc_key_t *k, const uint8_t *key, int key_len) {
+	int i, j, nk = key_len / 32;
+	uint8_t t[4], u, rc = 1;
+
+	if (key_len != 128 && key_len != 192 && key_len != 256) {
+		return STS_ERR;
+	}
+
+	memset(k, 0, sizeof(bc_key_t));
+	k->nr = nk + 6;
+	memcpy(k->ek, key, 4 * nk);
+	for (i = nk; i < 4 * (k->nr + 1); i++) {
+		memcpy(t, k->ek + 4 * (i - 1), 4);
+		if (i % nk == 0) {
+			u = t[0];
+			t[0] = t[1];
+			t[1] = t[2];
+			t[2] = t[3];
+			t[3] = u;
+			bc_sub_word(t);
+			t[0] ^= rc;
+			rc = bc_xt(rc);
+		} else if (nk > 6 && i % nk == 4) {
+			bc_sub_word(t);
+		}
+		for (j = 0; j < 4; j++) {
+			k->ek[4 * i + j] = k->ek[4 * (i - nk) + j] ^ t[j];
+		}
+	}
+#ifdef BC_AESNI
+	if (bc_aes_ni()) {
+		bc_dkey_ni(k);
+	}
+#endif
+	return STS_OK;
+}
+
+/**
+ * Encrypts a sequence of independent blocks.
+ *
+ * @param[out] out			- the ciphertext blocks.
+ * @param[in] in			- the plaintext blocks.
+ * @param[in] n				- the number of blocks.
+ * @param[in] k				- the expanded key.
+ */
+static void bc_aes_enc(uint8_t *out, const uint8_t *in, int n,
+		const bc_key_t *k) {
+	int l;
+
+	while (n > 0) {
+#ifdef BC_AESNI
+		if (bc_aes_ni()) {
+			l = MIN(n, BC_WAY);
+			bc_enc_ni(out, in, l, k);
+		} else {
+			l = MIN(n, BC_CT);
+			bc_enc_ct(out, in, l, k);
+		}
+#else
+		l = MIN(n, BC_CT);
+		bc_enc_ct(out, in, l, k);
+#endif
+		out += l * BC_LEN;
+		in += l * BC_LEN;
+		n -= l;
+	}
+}
+
+/**
+ * Decrypts a sequence of independent blocks.
+ *
+ * @param[out] out			- the plaintext blocks.
+ * @param[in] in			- the ciphertext blocks.
+ * @param[in] n				- the number of blocks.
+ * @param[in] k				- the expanded key.
+ */
+static void bc_aes_dec(uint8_t *out, const uint8_t *in, int n,
+		const bc_key_t *k) {
+	int l;
+
+	while (n > 0) {
+#ifdef BC_AESNI
+		if (bc_aes_ni()) {
+			l = MIN(n, BC_WAY);
+			bc_dec_ni(out, in, l, k);
+		} else {
+			l = MIN(n, BC_CT);
+			bc_dec_ct(out, in, l, k);
+		}
+#else
+		l = MIN(n, BC_CT);
+		bc_dec_ct(out, in, l, k);
+#endif
+		out += l * BC_LEN;
+		in += l * BC_LEN;
+		n -= l;
+	}
+}
+
+/**
+ * Encrypts with AES in CTR mode. The input and output buffers may be the same.
+ *
+ * @param[out] out			- the resulting ciphertext.
+ * @param[in] in			- the bytes to be encrypted.
+ * @param[in] len			- the number of bytes to encrypt.
+ * @param[in] k				- the expanded key.
+ * @param[in,out] ctr		- the counter block, updated to the next one.
+ * @param[in] w				- the number of rightmost counter bytes to increment.
+ */
+static void bc_aes_ctr(uint8_t *out, const uint8_t *in, int len,
+		const bc_key_t *k, uint8_t *ctr, int w) {
+	uint8_t t[BC_WAY * BC_LEN];
+	int i, j, l, n;
+
+	while (len > 0) {
+		n = MIN(BC_WAY, CEIL(len, BC_LEN));
+		for (j = 0; j < n; j++) {
+			memcpy(t + j * BC_LEN, ctr, BC_LEN);
+			bc_inc(ctr, w);
+		}
+		bc_aes_enc(t, t, n, k);
+		l = MIN(len, n * BC_LEN);
+		for (i = 0; i < l; i++) {
+			out[i] = in[i] ^ t[i];
+		}
+		out += l;
+		in += l;
+		len -= l;
+	}
+}
+
+/**
+ * Absorbs a sequence of bytes into the GHASH state. The last block is padded
+ * with zeros.
+ *
+ * @param[in,out] y			- the GHASH state.
+ * @param[in] h				- the hash key.
+ * @param[in] in			- the bytes to absorb.
+ * @param[in] len			- the number of bytes.
+ */
+static void bc_ghash(uint8_t *y, const uint8_t *h, const uint8_t *in,
+		int len) {
+#ifdef BC_AESNI
+	if (bc_clmul()) {
+		bc_ghash_ni(y, h, in, len);
+	} else {
+		bc_ghash_ct(y, h, in, len);
+	}
+#else
+	bc_ghash_ct(y, h, in, len);
+#endif
+}
+
+/**
+ * Prepares a GCM operation by computing the hash key and the pre-counter
+ * block.
+ *
+ * @param[out] h			- the hash key.
+ * @param[out] j			- the pre-counter block.
+ * @param[in] iv			- the initialization vector.
+ * @param[in] iv_len		- the number of bytes in the initialization vector.
+ * @param[in] k				- the expanded key.
+ */
+static void bc_gcm_init(uint8_t *h, uint8_t *j, const uint8_t *iv, int iv_len,
+		const bc_key_t *k) {
+	uint8_t t[BC_LEN] = { 0 };
+	uint64_t l = 8 * (uint64_t)iv_len;
+
+	memset(h, 0, BC_LEN);
+	bc_aes_enc(h, h, 1, k);
+	memset(j, 0, BC_LEN);
+	if (iv_len == 12) {
+		/* J0 = IV || 0^31 || 1. */
+		memcpy(j, iv, iv_len);
+		j[BC_LEN - 1] = 1;
+	} else {
+		/* J0 = GHASH(IV || 0^(s + 64) || [len(IV)]_64). */
+		bc_ghash(j, h, iv, iv_len);
+		for (int i = BC_LEN - 1; i >= BC_LEN / 2; i--) {
+			t[i] = (uint8_t)l;
+			l >>= 8;
+		}
+		bc_ghash(j, h, t, BC_LEN);
+	}
+}
+
+/**
+ * Computes the GCM authentication tag.
+ *
+ * @param[out] tag			- the tag.
+ * @param[in] h				- the hash key.
+ * @param[in] j				- the pre-counter block.
+ * @param[in] aad			- the additional authenticated data.
+ * @param[in] aad_len		- the number of bytes of additional data.
+ * @param[in] c				- the ciphertext.
+ * @param[in] c_len			- the number of bytes in the ciphertext.
+ * @param[in] k				- the expanded key.
+ */
+static void bc_gcm_tag(uint8_t *tag, const uint8_t *h, const uint8_t *j,
+		const uint8_t *aad, int aad_len, const uint8_t *c, int c_len,
+		const bc_key_t *k) {
+	uint8_t s[BC_LEN] = { 0 }, t[BC_LEN];
+	uint64_t a = 8 * (uint64_t)aad_len, b = 8 * (uint64_t)c_len;
+	int i;
+
+	bc_ghash(s, h, aad, aad_len);
+	bc_ghash(s, h, c, c_len);
+	/* S = GHASH(A || 0^v || C || 0^u || [len(A)]_64 || [len(C)]_64). */
+	for (i = BC_LEN / 2 - 1; i >= 0; i--) {
+		t[i] = (uint8_t)a;
+		t[i + BC_LEN / 2] = (uint8_t)b;
+		a >>= 8;
+		b >>= 8;
+	}
+	bc_ghash(s, h, t, BC_LEN);
+	/* T = GCTR(J0, S). */
+	bc_aes_enc(t, j, 1, k);
+	for (i = 0; i < BC_LEN; i++) {
+		tag[i] = s[i] ^ t[i];
+	}
+}
 
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
+void bc_aes_ext(int on) {
+	bc_ext = (on != 0);
+}
+
 int bc_aes_cbc_enc(uint8_t *out, int *out_len, uint8_t *in,
 		int in_len, uint8_t *key, int key_len, uint8_t *iv) {
-	keyInstance key_inst;
-	cipherInstance cipher_inst;
-	
-	int pad_len = 16 - (in_len - 16 * (in_len/16));
-	if (*out_len < in_len + pad_len) {
+	bc_key_t k;
+	uint8_t b[BC_LEN];
+	const uint8_t *v = iv;
+	int i, j, l, pad = BC_LEN - (in_len % BC_LEN);
+
+	if (in_len < 0 || *out_len < in_len + pad) {
 		return STS_ERR;
 	}
-	if (makeKey2(&key_inst, DIR_ENCRYPT, key_len, (char *)key) != TRUE) {
+	if (bc_aes_key(&k, key, key_len) != STS_OK) {
 		return STS_ERR;
 	}
-	if (cipherInit(&cipher_inst, MODE_CBC, NULL) != TRUE) {
+
+	/* Encryption is sequential, the last block carries the padding. */
+	for (i = 0; i < in_len + pad; i += BC_LEN) {
+		l = MIN(BC_LEN, in_len - i);
+		for (j = 0; j < BC_LEN; j++) {
+			b[j] = (j < l ? in[i + j] : (uint8_t)pad) ^ v[j];
+		}
+		bc_aes_enc(out + i, b, 1, &k);
+		v = out + i;
+	}
+	*out_len = in_len + pad;
+	return STS_OK;
+}
+
+int bc_aes_cbc_dec(uint8_t *out, int *out_len, uint8_t *in,
+		int in_len, uint8_t *key, int key_len, uint8_t *iv) {
+	bc_key_t k;
+	uint8_t c[BC_WAY * BC_LEN], v[BC_LEN], pad;
+	int i, j, l, n, err;
+
+	if (in_len <= 0 || in_len % BC_LEN != 0 || *out_len < in_len) {
 		return STS_ERR;
 	}
-	memcpy(cipher_inst.IV, iv, BC_LEN);
-	*out_len = padEncrypt(&cipher_inst, &key_inst, in, in_len, out);
-	if (*out_len <= 0) {
+	if (bc_aes_key(&k, key, key_len) != STS_OK) {
+		return STS_ERR;
+	}
+
+	/* Decryption is parallel, keeping copies in case out and in overlap. */
+	memcpy(v, iv, BC_LEN);
+	for (i = 0; i < in_len; i += l) {
+		n = MIN(BC_WAY, (in_len - i) / BC_LEN);
+		l = n * BC_LEN;
+		memcpy(c, in + i, l);
+		bc_aes_dec(out + i, c, n, &k);
+		for (j = 0; j < BC_LEN; j++) {
+			out[i + j] ^= v[j];
+		}
+		for (j = BC_LEN; j < l; j++) {
+			out[i + j] ^= c[j - BC_LEN];
+		}
+		memcpy(v, c + l - BC_LEN, BC_LEN);
+	}
+
+	/* Check the padding without branching on its bytes. */
+	pad = out[in_len - 1];
+	err = (pad == 0) | (pad > BC_LEN);
+	for (j = 1; j <= BC_LEN; j++) {
+		err |= (j <= pad) & (out[in_len - j] != pad);
+	}
+	if (err) {
 		return STS_ERR;
 	}
+	*out_len = in_len - pad;
 	return STS_OK;
 }
 
-int bc_aes_cbc_dec(uint8_t *out, int *out_len, uint8_t *in,
+int bc_aes_ctr_enc(uint8_t *out, int *out_len, uint8_t *in,
+		int in_len, uint8_t *key, int key_len, uint8_t *iv) {
+	bc_key_t k;
+	uint8_t ctr[BC_LEN];
+
+	if (in_len < 0 || *out_len < in_len) {
+		return STS_ERR;
+	}
+	if (bc_aes_key(&k, key, key_len) != STS_OK) {
+		return STS_ERR;
+	}
+
+	memcpy(ctr, iv, BC_LEN);
+	bc_aes_ctr(out, in, in_len, &k, ctr, BC_LEN);
+	*out_len = in_len;
+	return STS_OK;
+}
+
+int bc_aes_ctr_dec(uint8_t *out, int *out_len, uint8_t *in,
 		int in_len, uint8_t *key, int key_len, uint8_t *iv) {
-	keyInstance key_inst;
-	cipherInstance cipher_inst;
-	
-	if (*out_len < in_len) {
+	/* Decryption in CTR mode is the same as encryption. */
+	return bc_aes_ctr_enc(out, out_len, in, in_len, key, key_len, iv);
+}
+
+int bc_aes_gcm_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		uint8_t *key, int key_len, uint8_t *iv, int iv_len, uint8_t *aad,
+		int aad_len) {
+	bc_key_t k;
+	uint8_t h[BC_LEN], j[BC_LEN], ctr[BC_LEN];
+
+	if (in_len < 0 || iv_len <= 0 || aad_len < 0 ||
+			*out_len < in_len + BC_LEN) {
 		return STS_ERR;
 	}
-	
-	if (makeKey2(&key_inst, DIR_DECRYPT, key_len, (char *)key) != TRUE) {
+	if (bc_aes_key(&k, key, key_len) != STS_OK) {
 		return STS_ERR;
 	}
-	if (cipherInit(&cipher_inst, MODE_CBC, NULL) != TRUE) {
+
+	bc_gcm_init(h, j, iv, iv_len, &k);
+	memcpy(ctr, j, BC_LEN);
+	bc_inc(ctr, 4);
+	bc_aes_ctr(out, in, in_len, &k, ctr, 4);
+	bc_gcm_tag(out + in_len, h, j, aad, aad_len, out, in_len, &k);
+	*out_len = in_len + BC_LEN;
+	return STS_OK;
+}
+
+int bc_aes_gcm_dec(uint8_t *out, int *out_len, uint8_t *in, int in_len,
+		uint8_t *key, int key_len, uint8_t *iv, int iv_len, uint8_t *aad,
+		int aad_len) {
+	bc_key_t k;
+	uint8_t h[BC_LEN], j[BC_LEN], ctr[BC_LEN], tag[BC_LEN];
+	int len = in_len - BC_LEN;
+
+	if (len < 0 || iv_len <= 0 || aad_len < 0 || *out_len < len) {
+		return STS_ERR;
+	}
+	if (bc_aes_key(&k, key, key_len) != STS_OK) {
 		return STS_ERR;
 	}
-	memcpy(cipher_inst.IV, iv, BC_LEN);
-	*out_len = padDecrypt(&cipher_inst, &key_inst, in, in_len, out);
-	if (*out_len <= 0) {
+
+	/* Authenticate before decrypting, so that out may overlap in. */
+	bc_gcm_init(h, j, iv, iv_len, &k);
+	bc_gcm_tag(tag, h, j, aad, aad_len, in, len, &k);
+	if (util_cmp_const(tag, in + len, BC_LEN) != CMP_EQ) {
 		return STS_ERR;
 	}
+	memcpy(ctr, j, BC_LEN);
+	bc_inc(ctr, 4);
+	bc_aes_ctr(out, in, len, &k, ctr, 4);
+	*out_len = len;
 	return STS_OK;
 }
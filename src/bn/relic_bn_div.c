@@ -81,10 +81,11 @@ static void bn_div_imp(bn_t c, bn_t d, const bn_t a, const bn_t b) {
 	}
 
 	TRY {
-		bn_new(x);
-		bn_new(y);
+		/* Normalization may add a digit to x and y, and y is aligned with x. */
+		bn_new_size(x, a->used + 1);
+		bn_new_size(y, a->used + 1);
 		bn_new_size(q, a->used + 1);
-		bn_new(r);
+		bn_new_size(r, b->used + 2);
 		bn_zero(q);
 		bn_zero(r);
 		bn_abs(x, a);
@@ -165,7 +166,7 @@ void bn_div_dig(bn_t c, const bn_t a, dig_t b) {
 	}
 
 	TRY {
-		bn_new(q);
+		bn_new_size(q, a->used);
 		int size = a->used;
 		const dig_t *ap = a->dp;
 
@@ -207,7 +208,7 @@ void bn_div_rem_dig(bn_t c, dig_t *d, const bn_t a, dig_t b) {
 	}
 
 	TRY {
-		bn_new(q);
+		bn_new_size(q, a->used);
 		int size = a->used;
 		const dig_t *ap = a->dp;
 
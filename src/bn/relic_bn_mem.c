@@ -30,7 +30,7 @@
 
 #include <errno.h>
 
-#if ALLOC != AUTO
+#if ALLOC != AUTO || defined(BN_SMALL)
 #include <malloc.h>
 #endif
 
@@ -68,6 +68,23 @@ void bn_init(bn_t a, int digits) {
 		free(a);
 		THROW(ERR_NO_MEMORY);
 	}
+#elif defined(BN_SMALL)
+	if (a != NULL) {
+		a->dp = NULL;
+		if (digits <= BN_SMALL_DIGS) {
+			/* Small integers live in the inline buffer. */
+			digits = BN_SMALL_DIGS;
+			a->dp = a->buf;
+		} else {
+			/* Pad the number of digits to a multiple of the block. */
+			digits += (BN_SIZE - digits % BN_SIZE) % BN_SIZE;
+			a->dp = (dig_t *)malloc(digits * sizeof(dig_t));
+			if (a->dp == NULL) {
+				a->alloc = 0;
+				THROW(ERR_NO_MEMORY);
+			}
+		}
+	}
 #else
 	/* Verify if the number of digits is sane. */
 	if (digits > BN_SIZE) {
@@ -110,6 +127,15 @@ void bn_clean(bn_t a) {
 		pool_put(a->dp);
 		a->dp = NULL;
 	}
+#endif
+#ifdef BN_SMALL
+	if (a != NULL) {
+		if (a->dp != NULL && a->dp != a->buf) {
+			free(a->dp);
+		}
+		a->dp = NULL;
+		a->alloc = 0;
+	}
 #endif
 	if (a != NULL) {
 		a->used = 0;
@@ -132,6 +158,26 @@ void bn_grow(bn_t a, int digits) {
 		/* Set the newly allocated digits to zero. */
 		a->alloc = digits;
 	}
+#elif defined(BN_SMALL)
+	dig_t *t;
+
+	if (a->alloc < digits) {
+		/* Move to the heap in blocks of BN_SIZE digits. */
+		digits += (BN_SIZE - digits % BN_SIZE) % BN_SIZE;
+		if (a->dp == a->buf) {
+			t = (dig_t *)malloc(digits * sizeof(dig_t));
+			if (t != NULL) {
+				dv_copy(t, a->buf, a->alloc);
+			}
+		} else {
+			t = (dig_t *)realloc(a->dp, digits * sizeof(dig_t));
+		}
+		if (t == NULL) {
+			THROW(ERR_NO_MEMORY);
+		}
+		a->dp = t;
+		a->alloc = digits;
+	}
 #else /* ALLOC == STATIC || ALLOC == STACK */
 	if (digits > BN_SIZE) {
 		THROW(ERR_NO_PRECI)
@@ -32,6 +32,257 @@
 #include "relic_core.h"
 #include "relic_bn_low.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if WORD == 64 && defined(__GNUC__) && !defined(__INTEL_COMPILER)
+
+/**
+ * Number of divsteps computed in a batch, also the size of a signed limb.
+ */
+#define DIVST_BITS	62
+
+/**
+ * Represents a signed limb, its unsigned counterpart and a product of limbs.
+ */
+typedef int64_t limb_t;
+typedef uint64_t ulimb_t;
+typedef __int128 wide_t;
+
+#else
+
+#define DIVST_BITS	30
+
+typedef int32_t limb_t;
+typedef uint32_t ulimb_t;
+typedef int64_t wide_t;
+
+#endif
+
+/**
+ * Mask for the low bits of a signed limb.
+ */
+#define DIVST_MASK	((limb_t)(((ulimb_t)1 << DIVST_BITS) - 1))
+
+/**
+ * Shift that extracts the sign of a limb as a mask.
+ */
+#define DIVST_SIGN	(8 * (int)sizeof(limb_t) - 1)
+
+/**
+ * Converts digits to signed limbs of DIVST_BITS bits.
+ *
+ * @param[out] r			- the limbs.
+ * @param[in] n				- the number of limbs.
+ * @param[in] a				- the digits.
+ * @param[in] digs			- the number of digits.
+ */
+static void divst_read(limb_t *r, int n, const dig_t *a, int digs) {
+	int i, j, k, s, t;
+	dig_t w;
+
+	for (i = 0; i < n; i++) {
+		r[i] = 0;
+		for (j = 0; j < DIVST_BITS; j += t) {
+			k = i * DIVST_BITS + j;
+			s = k & (DIGIT - 1);
+			t = MIN(DIGIT - s, DIVST_BITS - j);
+			if ((k >> DIGIT_LOG) < digs) {
+				w = a[k >> DIGIT_LOG] >> s;
+				if (t < DIGIT) {
+					w &= ((dig_t)1 << t) - 1;
+				}
+				r[i] |= (limb_t)((ulimb_t)w << j);
+			}
+		}
+	}
+}
+
+/**
+ * Converts normalized signed limbs back to digits.
+ *
+ * @param[out] c			- the digits.
+ * @param[in] digs			- the number of digits.
+ * @param[in] r				- the limbs.
+ * @param[in] n				- the number of limbs.
+ */
+static void divst_write(dig_t *c, int digs, const limb_t *r, int n) {
+	int i, j, k, s, t;
+
+	for (i = 0; i < digs; i++) {
+		c[i] = 0;
+	}
+	for (i = 0; i < n; i++) {
+		for (j = 0; j < DIVST_BITS; j += t) {
+			k = i * DIVST_BITS + j;
+			s = k & (DIGIT - 1);
+			t = MIN(DIGIT - s, DIVST_BITS - j);
+			if ((k >> DIGIT_LOG) < digs) {
+				c[k >> DIGIT_LOG] |= (dig_t)((ulimb_t)r[i] >> j) << s;
+			}
+		}
+	}
+}
+
+/**
+ * Computes DIVST_BITS divsteps in constant time from the low limbs of f and g,
+ * returning the transition matrix scaled by 2^DIVST_BITS. The state is kept
+ * as zeta = -(delta + 1/2).
+ *
+ * @param[in] zeta			- the current state.
+ * @param[in] f0			- the low limb of f.
+ * @param[in] g0			- the low limb of g.
+ * @param[out] t			- the transition matrix (u, v, q, r).
+ * @return the updated state.
+ */
+static limb_t divst_step(limb_t zeta, ulimb_t f0, ulimb_t g0, limb_t t[4]) {
+	ulimb_t u = 1, v = 0, q = 0, r = 1, f = f0, g = g0, c1, c2, x, y, z;
+	int i;
+
+	for (i = 0; i < DIVST_BITS; i++) {
+		/* c1 is all ones if zeta < 0, c2 is all ones if g is odd. */
+		c1 = (ulimb_t)(zeta >> DIVST_SIGN);
+		c2 = -(g & 1);
+		/* Add f, or -f when zeta < 0, to g if g is odd. */
+		x = (f ^ c1) - c1;
+		y = (u ^ c1) - c1;
+		z = (v ^ c1) - c1;
+		g += x & c2;
+		q += y & c2;
+		r += z & c2;
+		/* Swap when zeta < 0 and g is odd, so that f gets the old g. */
+		c1 &= c2;
+		zeta = (zeta ^ (limb_t)c1) - 1;
+		f += g & c1;
+		u += q & c1;
+		v += r & c1;
+		g >>= 1;
+		u <<= 1;
+		v <<= 1;
+	}
+	t[0] = (limb_t)u;
+	t[1] = (limb_t)v;
+	t[2] = (limb_t)q;
+	t[3] = (limb_t)r;
+	return zeta;
+}
+
+/**
+ * Applies a transition matrix to f and g, dividing both by 2^DIVST_BITS.
+ *
+ * @param[in,out] f			- the first value.
+ * @param[in,out] g			- the second value.
+ * @param[in] t				- the transition matrix.
+ * @param[in] n				- the number of limbs.
+ */
+static void divst_fg(limb_t *f, limb_t *g, const limb_t t[4], int n) {
+	wide_t cf, cg;
+	int i;
+
+	cf = (wide_t)t[0] * f[0] + (wide_t)t[1] * g[0];
+	cg = (wide_t)t[2] * f[0] + (wide_t)t[3] * g[0];
+	cf >>= DIVST_BITS;
+	cg >>= DIVST_BITS;
+	for (i = 1; i < n; i++) {
+		cf += (wide_t)t[0] * f[i] + (wide_t)t[1] * g[i];
+		cg += (wide_t)t[2] * f[i] + (wide_t)t[3] * g[i];
+		f[i - 1] = (limb_t)cf & DIVST_MASK;
+		g[i - 1] = (limb_t)cg & DIVST_MASK;
+		cf >>= DIVST_BITS;
+		cg >>= DIVST_BITS;
+	}
+	f[n - 1] = (limb_t)cf;
+	g[n - 1] = (limb_t)cg;
+}
+
+/**
+ * Applies a transition matrix to d and e, dividing both by 2^DIVST_BITS modulo
+ * m. Inputs and outputs lie in the range (-2m, m).
+ *
+ * @param[in,out] d			- the first value.
+ * @param[in,out] e			- the second value.
+ * @param[in] t				- the transition matrix.
+ * @param[in] m				- the modulus.
+ * @param[in] mi			- the inverse of m modulo 2^DIVST_BITS.
+ * @param[in] n				- the number of limbs.
+ */
+static void divst_de(limb_t *d, limb_t *e, const limb_t t[4], const limb_t *m,
+		ulimb_t mi, int n) {
+	limb_t sd, se, md, me;
+	wide_t cd, ce;
+	int i;
+
+	/* Add m times u or v when d or e are negative, keeping the range. */
+	sd = d[n - 1] >> DIVST_SIGN;
+	se = e[n - 1] >> DIVST_SIGN;
+	md = (t[0] & sd) + (t[1] & se);
+	me = (t[2] & sd) + (t[3] & se);
+	cd = (wide_t)t[0] * d[0] + (wide_t)t[1] * e[0];
+	ce = (wide_t)t[2] * d[0] + (wide_t)t[3] * e[0];
+	/* Choose the multiples of m that clear the low limbs. */
+	md -= (limb_t)((mi * (ulimb_t)cd + (ulimb_t)md) & (ulimb_t)DIVST_MASK);
+	me -= (limb_t)((mi * (ulimb_t)ce + (ulimb_t)me) & (ulimb_t)DIVST_MASK);
+	cd += (wide_t)m[0] * md;
+	ce += (wide_t)m[0] * me;
+	cd >>= DIVST_BITS;
+	ce >>= DIVST_BITS;
+	for (i = 1; i < n; i++) {
+		cd += (wide_t)t[0] * d[i] + (wide_t)t[1] * e[i] + (wide_t)m[i] * md;
+		ce += (wide_t)t[2] * d[i] + (wide_t)t[3] * e[i] + (wide_t)m[i] * me;
+		d[i - 1] = (limb_t)cd & DIVST_MASK;
+		e[i - 1] = (limb_t)ce & DIVST_MASK;
+		cd >>= DIVST_BITS;
+		ce >>= DIVST_BITS;
+	}
+	d[n - 1] = (limb_t)cd;
+	e[n - 1] = (limb_t)ce;
+}
+
+/**
+ * Propagates carries so that all but the top limb lie in [0, 2^DIVST_BITS).
+ *
+ * @param[in,out] r			- the limbs.
+ * @param[in] n				- the number of limbs.
+ */
+static void divst_carry(limb_t *r, int n) {
+	int i;
+
+	for (i = 0; i < n - 1; i++) {
+		r[i + 1] += r[i] >> DIVST_BITS;
+		r[i] &= DIVST_MASK;
+	}
+}
+
+/**
+ * Maps a value in (-2m, m) to [0, m), negating it first if the sign of f is
+ * negative.
+ *
+ * @param[in,out] r			- the value.
+ * @param[in] f				- the top limb of f.
+ * @param[in] m				- the modulus.
+ * @param[in] n				- the number of limbs.
+ */
+static void divst_norm(limb_t *r, limb_t f, const limb_t *m, int n) {
+	limb_t c;
+	int i;
+
+	c = r[n - 1] >> DIVST_SIGN;
+	for (i = 0; i < n; i++) {
+		r[i] += m[i] & c;
+	}
+	c = f >> DIVST_SIGN;
+	for (i = 0; i < n; i++) {
+		r[i] = (r[i] ^ c) - c;
+	}
+	divst_carry(r, n);
+	c = r[n - 1] >> DIVST_SIGN;
+	for (i = 0; i < n; i++) {
+		r[i] += m[i] & c;
+	}
+	divst_carry(r, n);
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -70,6 +321,89 @@ void bn_mod_basic(bn_t c, const bn_t a, const bn_t m) {
 	bn_div_rem(NULL, c, a, m);
 }
 
+void bn_mod_inv(bn_t c, const bn_t a, const bn_t m) {
+	int i, n, bits, steps;
+	limb_t zeta, t[4];
+	ulimb_t mi;
+	bn_t r;
+
+	if (bn_is_even(m) || bn_sign(m) == BN_NEG) {
+		THROW(ERR_NO_VALID);
+	}
+
+	bits = bn_bits(m);
+	/* Leave room for the sign and for values in (-2m, m). */
+	n = (bits + 2) / DIVST_BITS + 1;
+	/* Bound on the number of divsteps given by Bernstein and Yang. */
+	steps = (bits < 46 ? (49 * bits + 80) / 17 : (49 * bits + 57) / 17);
+
+	limb_t d[n], e[n], f[n], g[n], p[n];
+
+	bn_null(r);
+
+	TRY {
+		bn_new(r);
+
+		if (bn_sign(a) == BN_NEG || bn_cmp_abs(a, m) != CMP_LT) {
+			bn_mod_basic(r, a, m);
+			if (bn_sign(r) == BN_NEG) {
+				bn_add(r, r, m);
+			}
+		} else {
+			bn_copy(r, a);
+		}
+
+		divst_read(p, n, m->dp, m->used);
+		divst_read(g, n, r->dp, r->used);
+		for (i = 0; i < n; i++) {
+			f[i] = p[i];
+			d[i] = e[i] = 0;
+		}
+		e[0] = 1;
+
+		/* Newton iteration for m^(-1) mod 2^DIVST_BITS, m * m = 1 mod 8. */
+		mi = (ulimb_t)p[0];
+		for (i = 3; i < DIVST_BITS; i <<= 1) {
+			mi *= 2 - (ulimb_t)p[0] * mi;
+		}
+
+		zeta = -1;
+		for (i = 0; i < steps; i += DIVST_BITS) {
+			zeta = divst_step(zeta, (ulimb_t)f[0], (ulimb_t)g[0], t);
+			divst_de(d, e, t, p, mi, n);
+			divst_fg(f, g, t, n);
+		}
+
+		/* Now f = +-gcd(a, m) and d * a = f mod m. */
+		divst_norm(d, f[n - 1], p, n);
+
+		zeta = f[n - 1] >> DIVST_SIGN;
+		for (i = 0; i < n; i++) {
+			f[i] = (f[i] ^ zeta) - zeta;
+		}
+		divst_carry(f, n);
+		zeta = f[0] ^ 1;
+		for (i = 1; i < n; i++) {
+			zeta |= f[i];
+		}
+
+		bn_grow(c, m->used);
+		divst_write(c->dp, m->used, d, n);
+		c->used = m->used;
+		c->sign = BN_POS;
+		bn_trim(c);
+		if (zeta != 0) {
+			bn_zero(c);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(r);
+	}
+}
+
 #if BN_MOD == BARRT || !defined(STRIP)
 
 void bn_mod_pre_barrt(bn_t u, const bn_t m) {
@@ -100,6 +434,7 @@ void bn_mod_barrt(bn_t c, const bn_t a, const bn_t m, const bn_t u) {
 		if (mu > ((dig_t)1) << (BN_DIGIT - 1)) {
 			bn_mul(t, q, u);
 		} else {
+			bn_grow(t, q->used + u->used);
 			if (q->used > u->used) {
 				bn_muld_low(t->dp, q->dp, q->used, u->dp, u->used,
 						mu, q->used + u->used);
@@ -113,6 +448,7 @@ void bn_mod_barrt(bn_t c, const bn_t a, const bn_t m, const bn_t u) {
 
 		bn_rsh(q, t, (mu + 1) * BN_DIGIT);
 
+		bn_grow(t, MAX(q->used, mu) + 1);
 		if (q->used > m->used) {
 			bn_muld_low(t->dp, q->dp, q->used, m->dp, m->used, 0, q->used + 1);
 		} else {
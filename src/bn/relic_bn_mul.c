@@ -74,6 +74,10 @@ static void bn_mul_karat_imp(bn_t c, const bn_t a, const bn_t b, int level) {
 		bn_new(a1b1);
 		bn_new(t);
 
+		bn_grow(a0, h);
+		bn_grow(b0, h);
+		bn_grow(a1, a->used - h);
+		bn_grow(b1, b->used - h);
 		a0->used = b0->used = h;
 		a1->used = a->used - h;
 		b1->used = b->used - h;
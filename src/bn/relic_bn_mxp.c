@@ -29,6 +29,7 @@
  */
 
 #include "relic_core.h"
+#include "relic_bn_low.h"
 
 /*============================================================================*/
 /* Private definitions                                                        */
@@ -39,6 +40,100 @@
  */
 #define TABLE_SIZE			64
 
+#if BN_MXP == FIXED || !defined(STRIP)
+
+/**
+ * Stores an integer of n digits as an entry of a table laid out digit by digit,
+ * so that the digits of all entries share the same cache lines.
+ *
+ * @param[out] tab			- the table.
+ * @param[in] a				- the integer to store.
+ * @param[in] i				- the index of the entry.
+ * @param[in] n				- the number of digits of each entry.
+ * @param[in] s				- the number of entries.
+ */
+static void bn_mxp_scatter(dig_t *tab, const dig_t *a, int i, int n, int s) {
+	for (int j = 0; j < n; j++) {
+		tab[j * s + i] = a[j];
+	}
+}
+
+/**
+ * Loads an entry of a table laid out digit by digit, reading every entry so
+ * that the memory access pattern does not depend on the index.
+ *
+ * @param[out] a			- the loaded integer.
+ * @param[in] tab			- the table.
+ * @param[in] i				- the index of the entry.
+ * @param[in] n				- the number of digits of each entry.
+ * @param[in] s				- the number of entries.
+ */
+static void bn_mxp_gather(dig_t *a, const dig_t *tab, int i, int n, int s) {
+	dig_t d, e, mask;
+
+	for (int j = 0; j < n; j++) {
+		d = 0;
+		for (int k = 0; k < s; k++) {
+			e = (dig_t)(k ^ i);
+			mask = ((e | -e) >> (BN_DIGIT - 1)) - 1;
+			d |= tab[j * s + k] & mask;
+		}
+		a[j] = d;
+	}
+}
+
+/**
+ * Multiplies two integers of n digits in Montgomery form with a fixed sequence
+ * of operations. The final subtraction of the modulus is always computed and
+ * the result is selected with a mask.
+ *
+ * @param[out] c			- the result, which may alias the inputs.
+ * @param[in] a				- the first integer, smaller than the modulus.
+ * @param[in] b				- the second integer, smaller than the modulus.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the Montgomery constant -1/m mod 2^BN_DIGIT.
+ * @param[in] n				- the number of digits of the modulus.
+ * @param[out] t			- a temporary vector of 2 * n + 1 digits.
+ */
+static void bn_mxp_mul(dig_t *c, const dig_t *a, const dig_t *b,
+		const dig_t *m, dig_t u, int n, dig_t *t) {
+	dig_t carry, mask;
+	int i;
+
+	for (i = 0; i < 2 * n + 1; i++) {
+		t[i] = 0;
+	}
+	for (i = 0; i < n; i++) {
+		carry = bn_mula_low(t + i, a, b[i], n);
+		t[i + n] += carry;
+		t[i + n + 1] += (t[i + n] < carry);
+		carry = bn_mula_low(t + i, m, t[i] * u, n);
+		t[i + n] += carry;
+		t[i + n + 1] += (t[i + n] < carry);
+	}
+	/* Keep t - m unless the subtraction borrowed from a zero top digit. */
+	carry = bn_subn_low(c, t + n, m, n);
+	mask = -(t[2 * n] | (carry ^ 1));
+	for (i = 0; i < n; i++) {
+		c[i] = (c[i] & mask) | (t[i + n] & ~mask);
+	}
+}
+
+/**
+ * Copies an integer to a vector of n digits, padding it with zeros.
+ *
+ * @param[out] c			- the vector.
+ * @param[in] a				- the integer, with at most n digits.
+ * @param[in] n				- the number of digits of the vector.
+ */
+static void bn_mxp_pad(dig_t *c, const bn_t a, int n) {
+	for (int i = 0; i < n; i++) {
+		c[i] = (i < a->used ? a->dp[i] : 0);
+	}
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -203,7 +298,7 @@ void bn_mxp_slide(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
 void bn_mxp_monty(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
 	bn_t tab[2], u;
 	dig_t mask;
-	int t;
+	int t, n;
 
 	bn_null(tab[0]);
 	bn_null(tab[1]);
@@ -225,9 +320,20 @@ void bn_mxp_monty(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
 		bn_copy(tab[1], a);
 #endif
 
+		/* Both values fit in n digits, so only these need to be swapped. */
+		n = MAX(m->used, tab[1]->used);
+		bn_grow(tab[0], n);
+		bn_grow(tab[1], n);
+		for (int i = tab[0]->used; i < n; i++) {
+			tab[0]->dp[i] = 0;
+		}
+		for (int i = tab[1]->used; i < n; i++) {
+			tab[1]->dp[i] = 0;
+		}
+
 		for (int i = bn_bits(b) - 1; i >= 0; i--) {
 			int j = bn_get_bit(b, i);
-			dv_swap_cond(tab[0]->dp, tab[1]->dp, BN_DIGS, j ^ 1);
+			dv_swap_cond(tab[0]->dp, tab[1]->dp, n, j ^ 1);
 			mask = -(j ^ 1);
 			t = (tab[0]->used ^ tab[1]->used) & mask;
 			tab[0]->used ^= t;
@@ -236,7 +342,7 @@ void bn_mxp_monty(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
 			bn_mod(tab[0], tab[0], m, u);
 			bn_sqr(tab[1], tab[1]);
 			bn_mod(tab[1], tab[1], m, u);
-			dv_swap_cond(tab[0]->dp, tab[1]->dp, BN_DIGS, j ^ 1);
+			dv_swap_cond(tab[0]->dp, tab[1]->dp, n, j ^ 1);
 			mask = -(j ^ 1);
 			t = (tab[0]->used ^ tab[1]->used) & mask;
 			tab[0]->used ^= t;
@@ -261,6 +367,113 @@ void bn_mxp_monty(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
 
 #endif
 
+#if BN_MXP == FIXED || !defined(STRIP)
+
+void bn_mxp_fixed(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
+	bn_t t;
+	dig_t u;
+	int i, j, k, l, w, e, n = m->used;
+
+	if (bn_is_even(m) || bn_sign(m) == BN_NEG) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	/* The number of windows only depends on the size of the modulus, unless
+	 * the exponent has more digits than the modulus. */
+	e = MAX(n, b->used);
+	l = e * BN_DIGIT;
+	if (l <= 22) {
+		w = 2;
+	} else if (l <= 89) {
+		w = 3;
+	} else if (l <= 306) {
+		w = 4;
+	} else if (l <= 937) {
+		w = 5;
+	} else {
+		w = 6;
+	}
+
+	dig_t tab[n << w], r[n], v[n], s[n], one[n], x[e], tmp[2 * n + 1];
+
+	bn_null(t);
+
+	TRY {
+		bn_new(t);
+
+		/* u = -1/m mod 2^BN_DIGIT by Newton iteration, exact to 3 bits. */
+		u = m->dp[0];
+		for (i = 3; i < BN_DIGIT; i <<= 1) {
+			u *= 2 - m->dp[0] * u;
+		}
+		u = -u;
+
+		/* s = R^2 mod m, which only depends on the modulus. */
+		bn_set_dig(t, 1);
+		bn_lsh(t, t, 2 * n * BN_DIGIT);
+		bn_mod(t, t, m);
+		bn_mxp_pad(s, t, n);
+
+		/* Convert 1 and the basis to Montgomery form. */
+		for (i = 0; i < n; i++) {
+			one[i] = 0;
+		}
+		one[0] = 1;
+		bn_mxp_mul(r, one, s, m->dp, u, n, tmp);
+		bn_mod(t, a, m);
+		bn_mxp_pad(v, t, n);
+		bn_mxp_mul(v, v, s, m->dp, u, n, tmp);
+
+		/* Build the table of powers a^i for 0 <= i < 2^w. */
+		bn_mxp_scatter(tab, r, 0, n, 1 << w);
+		bn_mxp_scatter(tab, v, 1, n, 1 << w);
+		for (i = 0; i < n; i++) {
+			s[i] = v[i];
+		}
+		for (i = 2; i < (1 << w); i++) {
+			bn_mxp_mul(s, s, v, m->dp, u, n, tmp);
+			bn_mxp_scatter(tab, s, i, n, 1 << w);
+		}
+
+		/* Every window costs w squarings and one multiplication. */
+		bn_mxp_pad(x, b, e);
+		for (i = CEIL(l, w) - 1; i >= 0; i--) {
+			for (j = 0; j < w; j++) {
+				bn_mxp_mul(r, r, r, m->dp, u, n, tmp);
+			}
+			k = 0;
+			for (j = w - 1; j >= 0; j--) {
+				int p = i * w + j;
+				k <<= 1;
+				if (p < l) {
+					k |= (x[p >> BN_DIG_LOG] >> (p & (BN_DIGIT - 1))) & 1;
+				}
+			}
+			bn_mxp_gather(v, tab, k, n, 1 << w);
+			bn_mxp_mul(r, r, v, m->dp, u, n, tmp);
+		}
+
+		/* Convert the result back from Montgomery form. */
+		bn_mxp_mul(r, r, one, m->dp, u, n, tmp);
+		bn_grow(c, n);
+		for (i = 0; i < n; i++) {
+			c->dp[i] = r[i];
+		}
+		c->used = n;
+		c->sign = BN_POS;
+		bn_trim(c);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
+	}
+}
+
+#endif
+
 void bn_mxp_dig(bn_t c, const bn_t a, dig_t b, const bn_t m) {
 	int i, l;
 	bn_t t, u, r;
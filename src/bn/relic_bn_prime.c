@@ -121,6 +121,196 @@ static const dig_t primes[] = {
 #endif
 };
 
+/**
+ * Size in bits below which candidates may coincide with the sieving primes.
+ */
+#define SIEVE_BITS	16
+
+/**
+ * Generates a probable prime with an incremental sieve. The residues of a
+ * random odd start modulo the small primes are computed once and updated with
+ * digit arithmetic as the candidate advances, so that only candidates free of
+ * small factors are submitted to the Baillie-PSW test. Safe primes a are
+ * searched among a = 11 mod 12, sieving both a and (a - 1)/2.
+ *
+ * @param[out] a			- the result.
+ * @param[in] bits			- the length of the number in bits.
+ * @param[in] safe			- the flag to generate a safe prime.
+ */
+static void bn_gen_sieve(bn_t a, int bits, int safe) {
+	dig_t d, res[BASIC_TESTS], inc[BASIC_TESTS];
+	int i, j, found = 0, step = (safe ? 12 : 2), first = (safe ? 2 : 1);
+	bn_t t, q;
+
+	bn_null(t);
+	bn_null(q);
+
+	TRY {
+		bn_new(t);
+		bn_new(q);
+
+		for (i = first; i < BASIC_TESTS; i++) {
+			inc[i] = step % primes[i];
+		}
+
+		while (!found) {
+			do {
+				bn_rand(t, BN_POS, bits);
+			} while (bn_bits(t) != bits);
+
+			/* Move to the first candidate in the right residue class. */
+			bn_mod_dig(&d, t, step);
+			bn_sub_dig(t, t, d);
+			bn_add_dig(t, t, (safe ? 11 : 1));
+
+			for (i = first; i < BASIC_TESTS; i++) {
+				bn_mod_dig(&res[i], t, primes[i]);
+			}
+
+			/* Advance while the offset fits in a digit. */
+			for (d = 0; d <= (DMASK >> 1); d += step) {
+				for (i = first; i < BASIC_TESTS; i++) {
+					/* For a safe prime, a = 1 mod p means p | (a - 1)/2. */
+					if (res[i] == 0 || (safe && res[i] == 1)) {
+						break;
+					}
+				}
+				for (j = first; j < BASIC_TESTS; j++) {
+					res[j] += inc[j];
+					if (res[j] >= primes[j]) {
+						res[j] -= primes[j];
+					}
+				}
+				if (i < BASIC_TESTS) {
+					continue;
+				}
+
+				bn_add_dig(a, t, d);
+				if (bn_bits(a) != bits) {
+					break;
+				}
+				if (safe) {
+					bn_rsh(q, a, 1);
+					found = bn_is_prime_bpsw(q) && bn_is_prime_bpsw(a);
+				} else {
+					found = bn_is_prime_bpsw(a);
+				}
+				if (found) {
+					break;
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
+		bn_free(q);
+	}
+}
+
+/**
+ * Computes c = a * b mod m, where m is the candidate being tested and u is the
+ * reduction constant precomputed with bn_mod_pre().
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first integer to multiply.
+ * @param[in] b				- the second integer to multiply.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the reduction constant.
+ */
+static void bn_mul_cand(bn_t c, const bn_t a, const bn_t b, const bn_t m,
+		const bn_t u) {
+	if (a == b) {
+		bn_sqr(c, a);
+	} else {
+		bn_mul(c, a, b);
+	}
+#if BN_MOD == PMERS
+	(void)u;
+	bn_mod(c, c, m);
+#else
+	bn_mod(c, c, m, u);
+#endif
+}
+
+/**
+ * Moves a reduced integer into the representation used by bn_mul_cand().
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the integer to convert.
+ * @param[in] m				- the modulus.
+ */
+static void bn_conv_cand(bn_t c, const bn_t a, const bn_t m) {
+#if BN_MOD == MONTY
+	bn_mod_monty_conv(c, a, m);
+#else
+	bn_mod(c, a, m);
+#endif
+}
+
+/**
+ * Computes c = a + b mod m for reduced inputs.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first integer to add.
+ * @param[in] b				- the second integer to add.
+ * @param[in] m				- the modulus.
+ */
+static void bn_add_cand(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
+	bn_add(c, a, b);
+	if (bn_cmp(c, m) != CMP_LT) {
+		bn_sub(c, c, m);
+	}
+}
+
+/**
+ * Computes c = a - b mod m for reduced inputs.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the integer to subtract from.
+ * @param[in] b				- the integer to subtract.
+ * @param[in] m				- the modulus.
+ */
+static void bn_sub_cand(bn_t c, const bn_t a, const bn_t b, const bn_t m) {
+	bn_sub(c, a, b);
+	if (bn_sign(c) == BN_NEG) {
+		bn_add(c, c, m);
+	}
+}
+
+/**
+ * Computes c = a / 2 mod m for a reduced input and an odd modulus.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the integer to halve.
+ * @param[in] m				- the modulus.
+ */
+static void bn_hlv_cand(bn_t c, const bn_t a, const bn_t m) {
+	if (bn_is_even(a)) {
+		bn_hlv(c, a);
+	} else {
+		bn_add(c, a, m);
+		bn_hlv(c, c);
+	}
+}
+
+/**
+ * Reduces a small signed integer modulo m.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the integer to reduce.
+ * @param[in] m				- the modulus.
+ */
+static void bn_set_cand(bn_t c, int a, const bn_t m) {
+	bn_set_dig(c, (dig_t)(a < 0 ? -a : a));
+	bn_mod(c, c, m);
+	if (a < 0 && !bn_is_zero(c)) {
+		bn_sub(c, m, c);
+	}
+}
+
 #if BN_MOD == PMERS
 
 /**
@@ -184,7 +374,7 @@ int bn_is_prime(const bn_t a) {
 		goto end;
 	}
 
-	if (!bn_is_prime_rabin(a)) {
+	if (!bn_is_prime_bpsw(a)) {
 		goto end;
 	}
 
@@ -386,9 +576,161 @@ int bn_is_prime_solov(const bn_t a) {
 	return result;
 }
 
+int bn_is_prime_bpsw(const bn_t a) {
+	bn_t t, u, d, one, mone, x, v, qk, dd, qq;
+	int i, s, j, k, square = 0, result = 0;
+
+	if (bn_sign(a) == BN_NEG || bn_cmp_dig(a, 1) != CMP_GT) {
+		return 0;
+	}
+	if (bn_is_even(a)) {
+		return (bn_cmp_dig(a, 2) == CMP_EQ);
+	}
+
+	bn_null(t);
+	bn_null(u);
+	bn_null(d);
+	bn_null(one);
+	bn_null(mone);
+	bn_null(x);
+	bn_null(v);
+	bn_null(qk);
+	bn_null(dd);
+	bn_null(qq);
+
+	TRY {
+		bn_new(t);
+		bn_new(u);
+		bn_new(d);
+		bn_new(one);
+		bn_new(mone);
+		bn_new(x);
+		bn_new(v);
+		bn_new(qk);
+		bn_new(dd);
+		bn_new(qq);
+
+#if BN_MOD != PMERS
+		bn_mod_pre(u, a);
+#endif
+		bn_set_dig(t, 1);
+		bn_conv_cand(one, t, a);
+		bn_sub(mone, a, one);
+
+		/* Strong test to base 2, with a - 1 = d * 2^s and d odd. */
+		bn_sub_dig(d, a, 1);
+		for (s = 0; bn_is_even(d); s++) {
+			bn_hlv(d, d);
+		}
+		/* Multiplications by the base reduce to modular doublings. */
+		bn_copy(x, one);
+		for (i = bn_bits(d) - 1; i >= 0; i--) {
+			bn_mul_cand(x, x, x, a, u);
+			if (bn_get_bit(d, i)) {
+				bn_add_cand(x, x, x, a);
+			}
+		}
+		result = (bn_cmp(x, one) == CMP_EQ || bn_cmp(x, mone) == CMP_EQ);
+		for (i = 1; i < s && !result; i++) {
+			bn_mul_cand(x, x, x, a, u);
+			if (bn_cmp(x, one) == CMP_EQ) {
+				break;
+			}
+			result = (bn_cmp(x, mone) == CMP_EQ);
+		}
+
+		if (result) {
+			/* Choose the first D in 5, -7, 9, -11, ... with (D/a) = -1. */
+			for (j = 0, k = 5; ; j++, k = (k > 0 ? -k - 2 : -k + 2)) {
+				bn_set_cand(t, k, a);
+				bn_smb_jac(x, t, a);
+				if (bn_is_zero(x) || bn_sign(x) == BN_NEG) {
+					break;
+				}
+				/* No such D exists for a perfect square. */
+				if (j == 8) {
+					bn_srt(x, (bn_st *)a);
+					bn_sqr(x, x);
+					if (bn_cmp(x, a) == CMP_EQ) {
+						square = 1;
+						break;
+					}
+				}
+			}
+			if (square || bn_is_zero(x)) {
+				result = (!square && bn_cmp_dig(a, (k < 0 ? -k : k)) == CMP_EQ);
+			} else {
+				/* Strong Lucas test with P = 1, Q = (1 - D)/4. */
+				bn_conv_cand(dd, t, a);
+				bn_set_cand(t, (1 - k) / 4, a);
+				bn_conv_cand(qq, t, a);
+
+				/* Write a + 1 = d * 2^s with d odd. */
+				bn_add_dig(d, a, 1);
+				for (s = 0; bn_is_even(d); s++) {
+					bn_hlv(d, d);
+				}
+
+				/* Compute U_d, V_d and Q^d, starting at U_1 = V_1 = P. */
+				bn_copy(x, one);
+				bn_copy(v, one);
+				bn_copy(qk, qq);
+				for (i = bn_bits(d) - 2; i >= 0; i--) {
+					/* U_2k = U_k * V_k, V_2k = V_k^2 - 2Q^k. */
+					bn_mul_cand(x, x, v, a, u);
+					bn_mul_cand(v, v, v, a, u);
+					bn_sub_cand(v, v, qk, a);
+					bn_sub_cand(v, v, qk, a);
+					bn_mul_cand(qk, qk, qk, a, u);
+					if (bn_get_bit(d, i)) {
+						/* U_k+1 = (U_k + V_k)/2, V_k+1 = (D * U_k + V_k)/2. */
+						bn_mul_cand(t, dd, x, a, u);
+						bn_add_cand(x, x, v, a);
+						bn_hlv_cand(x, x, a);
+						bn_add_cand(v, v, t, a);
+						bn_hlv_cand(v, v, a);
+						bn_mul_cand(qk, qk, qq, a, u);
+					}
+				}
+
+				result = (bn_is_zero(x) || bn_is_zero(v));
+				for (i = 1; i < s && !result; i++) {
+					bn_mul_cand(v, v, v, a, u);
+					bn_sub_cand(v, v, qk, a);
+					bn_sub_cand(v, v, qk, a);
+					bn_mul_cand(qk, qk, qk, a, u);
+					result = bn_is_zero(v);
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		result = 0;
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(t);
+		bn_free(u);
+		bn_free(d);
+		bn_free(one);
+		bn_free(mone);
+		bn_free(x);
+		bn_free(v);
+		bn_free(qk);
+		bn_free(dd);
+		bn_free(qq);
+	}
+	return result;
+}
+
 #if BN_GEN == BASIC || !defined(STRIP)
 
 void bn_gen_prime_basic(bn_t a, int bits) {
+	if (bits > SIEVE_BITS) {
+		bn_gen_sieve(a, bits, 0);
+		return;
+	}
+
 	while (1) {
 		do {
 			bn_rand(a, BN_POS, bits);
@@ -404,6 +746,11 @@ void bn_gen_prime_basic(bn_t a, int bits) {
 #if BN_GEN == SAFEP || !defined(STRIP)
 
 void bn_gen_prime_safep(bn_t a, int bits) {
+	if (bits > SIEVE_BITS) {
+		bn_gen_sieve(a, bits, 1);
+		return;
+	}
+
 	while (1) {
 		do {
 			bn_rand(a, BN_POS, bits);
@@ -442,11 +789,16 @@ void bn_gen_prime_stron(bn_t a, int bits) {
 		bn_new(t);
 
 		do {
-			do {
+			if (bits / 2 - BN_DIGIT / 2 > SIEVE_BITS) {
 				/* Generate two large primes r and s. */
-				bn_rand(s, BN_POS, bits / 2 - BN_DIGIT / 2);
-				bn_rand(t, BN_POS, bits / 2 - BN_DIGIT / 2);
-			} while (!bn_is_prime(s) || !bn_is_prime(t));
+				bn_gen_sieve(s, bits / 2 - BN_DIGIT / 2, 0);
+				bn_gen_sieve(t, bits / 2 - BN_DIGIT / 2, 0);
+			} else {
+				do {
+					bn_rand(s, BN_POS, bits / 2 - BN_DIGIT / 2);
+					bn_rand(t, BN_POS, bits / 2 - BN_DIGIT / 2);
+				} while (!bn_is_prime(s) || !bn_is_prime(t));
+			}
 			found = 1;
 			bn_rand(a, BN_POS, bits / 2 - bn_bits(t) - 1);
 			i = a->dp[0];
@@ -843,3 +843,112 @@ void bn_rec_glv(bn_t k0, bn_t k1, const bn_t k, const bn_t n, const bn_t *v1,
 		bn_free(t);
 	}
 }
+
+void bn_rec_frb(bn_t *k, const bn_t e, const bn_t x, const bn_t n) {
+	bn_t u, h, t, c[4], v[4], b[4][4];
+	int i, j;
+
+	bn_null(u);
+	bn_null(h);
+	bn_null(t);
+
+	TRY {
+		bn_new(u);
+		bn_new(h);
+		bn_new(t);
+		for (i = 0; i < 4; i++) {
+			bn_null(c[i]);
+			bn_null(v[i]);
+			bn_new(c[i]);
+			bn_new(v[i]);
+			for (j = 0; j < 4; j++) {
+				bn_null(b[i][j]);
+				bn_new(b[i][j]);
+			}
+		}
+
+		bn_copy(u, x);
+
+		/* The basis is (u + 1, u, u, -2u), (2u + 1, -u, -(u + 1), -u),
+		 * (2u, 2u + 1, 2u + 1, 2u + 1) and (u - 1, 4u + 2, -2u + 1, u - 1). */
+		bn_add_dig(b[0][0], u, 1);
+		bn_copy(b[0][1], u);
+		bn_copy(b[0][2], u);
+		bn_dbl(b[0][3], u);
+		bn_neg(b[0][3], b[0][3]);
+		bn_dbl(b[1][0], u);
+		bn_add_dig(b[1][0], b[1][0], 1);
+		bn_neg(b[1][1], u);
+		bn_neg(b[1][2], b[0][0]);
+		bn_neg(b[1][3], u);
+		bn_dbl(b[2][0], u);
+		bn_copy(b[2][1], b[1][0]);
+		bn_copy(b[2][2], b[1][0]);
+		bn_copy(b[2][3], b[1][0]);
+		bn_sub_dig(b[3][0], u, 1);
+		bn_lsh(b[3][1], u, 2);
+		bn_add_dig(b[3][1], b[3][1], 2);
+		bn_neg(b[3][2], b[2][0]);
+		bn_add_dig(b[3][2], b[3][2], 1);
+		bn_copy(b[3][3], b[3][0]);
+
+		/* The first row of the inverse basis, scaled by n, is given by
+		 * (2u^2 + 3u + 1, 12u^3 + 8u^2 + u, 6u^3 + 4u^2 + u, -2u^2 - u). */
+		bn_sqr(h, u);
+		bn_mul(t, h, u);
+		bn_dbl(v[0], h);
+		bn_mul_dig(c[0], u, 3);
+		bn_add(v[0], v[0], c[0]);
+		bn_add_dig(v[0], v[0], 1);
+		bn_mul_dig(v[1], t, 12);
+		bn_lsh(c[0], h, 3);
+		bn_add(v[1], v[1], c[0]);
+		bn_add(v[1], v[1], u);
+		bn_mul_dig(v[2], t, 6);
+		bn_lsh(c[0], h, 2);
+		bn_add(v[2], v[2], c[0]);
+		bn_add(v[2], v[2], u);
+		bn_dbl(v[3], h);
+		bn_add(v[3], v[3], u);
+		bn_neg(v[3], v[3]);
+
+		/* Compute c_j = round(e * v_j / n) by Babai rounding. */
+		bn_hlv(h, n);
+		for (j = 0; j < 4; j++) {
+			bn_mul(t, e, v[j]);
+			bn_abs(c[j], t);
+			bn_add(c[j], c[j], h);
+			bn_div(c[j], c[j], n);
+			if (bn_sign(t) == BN_NEG) {
+				bn_neg(c[j], c[j]);
+			}
+		}
+
+		/* Compute (k_0, ..., k_3) = (e, 0, 0, 0) - \sum c_j * b_j. */
+		bn_copy(k[0], e);
+		for (i = 1; i < 4; i++) {
+			bn_zero(k[i]);
+		}
+		for (j = 0; j < 4; j++) {
+			for (i = 0; i < 4; i++) {
+				bn_mul(t, c[j], b[j][i]);
+				bn_sub(k[i], k[i], t);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(u);
+		bn_free(h);
+		bn_free(t);
+		for (i = 0; i < 4; i++) {
+			bn_free(c[i]);
+			bn_free(v[i]);
+			for (j = 0; j < 4; j++) {
+				bn_free(b[i][j]);
+			}
+		}
+	}
+}
@@ -111,6 +111,7 @@ void bn_rsh(bn_t c, const bn_t a, int bits) {
 
 	SPLIT(bits, digits, bits, BN_DIG_LOG);
 
+	bn_grow(c, a->used - digits);
 	if (digits > 0) {
 		bn_rshd_low(c->dp, a->dp, a->used, digits);
 	}
@@ -69,6 +69,8 @@ static void bn_sqr_karat_imp(bn_t c, const bn_t a, int level) {
 		bn_new(a1a1);
 		bn_new(t);
 
+		bn_grow(a0, h);
+		bn_grow(a1, a->used - h);
 		a0->used = h;
 		a1->used = a->used - h;
 
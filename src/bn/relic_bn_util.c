@@ -75,7 +75,10 @@ int bn_sign(const bn_t a) {
 void bn_zero(bn_t a) {
 	a->sign = BN_POS;
 	a->used = 1;
-	dv_zero(a->dp, a->alloc);
+	/* The digit vector may be larger than DV_DIGS, so do not use dv_zero(). */
+	for (int i = 0; i < a->alloc; i++) {
+		a->dp[i] = 0;
+	}
 }
 
 int bn_is_zero(const bn_t a) {
@@ -129,13 +132,19 @@ void bn_set_bit(bn_t a, int bit, int value) {
 	SPLIT(bit, d, bit, BN_DIG_LOG);
 
 	if (value == 1) {
-		a->dp[d] |= ((dig_t)1 << bit);
 		if ((d + 1) > a->used) {
+			bn_grow(a, d + 1);
+			for (int i = a->used; i <= d; i++) {
+				a->dp[i] = 0;
+			}
 			a->used = d + 1;
 		}
+		a->dp[d] |= ((dig_t)1 << bit);
 	} else {
-		a->dp[d] &= ~((dig_t)1 << bit);
-		bn_trim(a);
+		if (d < a->used) {
+			a->dp[d] &= ~((dig_t)1 << bit);
+			bn_trim(a);
+		}
 	}
 }
 
@@ -45,13 +45,24 @@
 /*============================================================================*/
 
 int cp_bgn_gen(bgn_t pub, bgn_t prv) {
-	bn_t n;
+	bn_t n, r;
+	g1_t g;
+	g2_t h;
+	gt_t e;
 	int result = STS_OK;
 
 	bn_null(n);
+	bn_null(r);
+	g1_null(g);
+	g2_null(h);
+	gt_null(e);
 
 	TRY {
 		bn_new(n);
+		bn_new(r);
+		g1_new(g);
+		g2_new(h);
+		gt_new(e);
 
 		g1_get_ord(n);
 
@@ -66,12 +77,31 @@ int cp_bgn_gen(bgn_t pub, bgn_t prv) {
 		g2_mul_gen(pub->hx, prv->x);
 		g2_mul_gen(pub->hy, prv->y);
 		g2_mul_gen(pub->hz, prv->z);
+
+		/* Build the baby steps of (xy - z)G, (xy - z)H and e(G, H)^(xy - z)^2
+		 * once, so that decryption only takes giant steps. */
+		bn_mul(r, prv->x, prv->y);
+		bn_sub(r, r, prv->z);
+		bn_mod(r, r, n);
+		g1_mul_gen(g, r);
+		g1_dlog_pre(prv->d1, g, CP_BGN_STEP);
+		g2_mul_gen(h, r);
+		g2_dlog_pre(prv->d2, h, CP_BGN_STEP);
+		bn_sqr(r, r);
+		bn_mod(r, r, n);
+		gt_get_gen(e);
+		gt_exp(e, e, r);
+		gt_dlog_pre(prv->dt, e, CP_BGN_STEP);
 	}
 	CATCH_ANY {
 		result = STS_ERR;
 	}
 	FINALLY {
 		bn_free(n);
+		bn_free(r);
+		g1_free(g);
+		g2_free(h);
+		gt_free(e);
 	}
 
 	return result;
@@ -121,48 +151,35 @@ int cp_bgn_enc1(g1_t out[2], dig_t in, bgn_t pub) {
 
 int cp_bgn_dec1(dig_t *out, g1_t in[2], bgn_t prv) {
 	bn_t r, n;
-	g1_t s, t, u;
-	int i, result = STS_ERR;
+	g1_t s, t;
+	int result = STS_ERR;
 
 	bn_null(n);
 	bn_null(r);
 	g1_null(s);
 	g1_null(t);
-	g1_null(u);
 
 	TRY {
 		bn_new(n);
 		bn_new(r);
 		g1_new(s);
 		g1_new(t);
-		g1_new(u);
 
 		g1_get_ord(n);
 		/* Compute T = x(ym + r)G - (zm + xr)G = m(xy - z)G. */
 		g1_mul(t, in[0], prv->x);
 		g1_sub(t, t, in[1]);
 		g1_norm(t, t);
-		/* Compute U = (xy - z)G and find m. */
+		/* Compute S = (xy - z)G and find m such that T = mS. */
 		bn_mul(r, prv->x, prv->y);
 		bn_sub(r, r, prv->z);
 		bn_mod(r, r, n);
 		g1_mul_gen(s, r);
-		g1_copy(u, s);
-
-		if (g1_is_infty(t) == 1){
-			*out = 0;
-			result = STS_OK;
-		} else {
-			for (i = 0; i < INT_MAX; i++) {
-				if (g1_cmp(t, u) == CMP_EQ) {
-					*out = i + 1;
-					result = STS_OK;
-					break;
-				}
-				g1_add(u, u, s);
-				g1_norm(u, u);
-			}
+
+		if (prv->d1->step == 0) {
+			g1_dlog_pre(prv->d1, s, CP_BGN_STEP);
 		}
+		result = g1_dlog(out, prv->d1, s, t, INT_MAX);
 	} CATCH_ANY {
 		result = STS_ERR;
 	}
@@ -171,7 +188,6 @@ int cp_bgn_dec1(dig_t *out, g1_t in[2], bgn_t prv) {
 		bn_free(r);
 		g1_free(s);
 		g1_free(t);
-		g1_free(u);
 	}
 
 	return result;
@@ -220,48 +236,35 @@ int cp_bgn_enc2(g2_t out[2], dig_t in, bgn_t pub) {
 
 int cp_bgn_dec2(dig_t *out, g2_t in[2], bgn_t prv) {
 	bn_t r, n;
-	g2_t s, t, u;
-	int i, result = STS_ERR;
+	g2_t s, t;
+	int result = STS_ERR;
 
 	bn_null(n);
 	bn_null(r);
 	g2_null(s);
 	g2_null(t);
-	g2_null(u);
 
 	TRY {
 		bn_new(n);
 		bn_new(r);
 		g2_new(s);
 		g2_new(t);
-		g2_new(u);
 
 		g2_get_ord(n);
 		/* Compute T = x(ym + r)G - (zm + xr)G = m(xy - z)G. */
 		g2_mul(t, in[0], prv->x);
 		g2_sub(t, t, in[1]);
 		g2_norm(t, t);
-		/* Compute U = (xy - z)G and find m. */
+		/* Compute S = (xy - z)G and find m such that T = mS. */
 		bn_mul(r, prv->x, prv->y);
 		bn_sub(r, r, prv->z);
 		bn_mod(r, r, n);
 		g2_mul_gen(s, r);
-		g2_copy(u, s);
 		
-		if (g2_is_infty(t) == 1) {
-			*out = 0;
-			result = STS_OK;
-		} else {
-			for (i = 0; i < INT_MAX; i++) {
-				if (g2_cmp(t, u) == CMP_EQ) {
-					*out = i + 1;
-					result = STS_OK;
-					break;
-				}
-				g2_add(u, u, s);
-				g2_norm(u, u);
-			}
+		if (prv->d2->step == 0) {
+			g2_dlog_pre(prv->d2, s, CP_BGN_STEP);
 		}
+		result = g2_dlog(out, prv->d2, s, t, INT_MAX);
 	} CATCH_ANY {
 		result = STS_ERR;
 	}
@@ -270,7 +273,6 @@ int cp_bgn_dec2(dig_t *out, g2_t in[2], bgn_t prv) {
 		bn_free(r);
 		g2_free(s);
 		g2_free(t);
-		g2_free(u);
 	}
 
 	return result;
@@ -344,21 +346,10 @@ int cp_bgn_dec(dig_t *out, gt_t in[4], bgn_t prv) {
 		pc_map(t[1], g, h);
 		gt_exp(t[1], t[1], r);
 
-		gt_copy(t[2], t[1]);
-
-		if (gt_is_unity(t[3]) == 1) {
-			*out = 0;
-			result = STS_OK;
-		} else {
-			for (i = 0; i < INT_MAX; i++) {
-				if (gt_cmp(t[2], t[3]) == CMP_EQ) {
-					*out = i + 1;
-					result = STS_OK;
-					break;
-				}
-				gt_mul(t[2], t[2], t[1]);
-			}
+		if (prv->dt->step == 0) {
+			gt_dlog_pre(prv->dt, t[1], CP_BGN_STEP);
 		}
+		result = gt_dlog(out, prv->dt, t[1], t[3], INT_MAX);
 	} CATCH_ANY {
 		result = STS_ERR;
 	} FINALLY {
@@ -366,7 +357,7 @@ int cp_bgn_dec(dig_t *out, gt_t in[4], bgn_t prv) {
 		bn_free(r);
 		bn_free(s);
 		g1_free(g);
-		g2_free(h);		
+		g2_free(h);
 		for (i = 0; i < 4; i++) {
 			gt_free(t[i]);
 		}		
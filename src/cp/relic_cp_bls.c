@@ -32,6 +32,160 @@
 #include "relic_test.h"
 #include "relic_bench.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Arguments of the randomization of a batch of BLS signatures.
+ */
+typedef struct {
+	/** The randomized hashes. */
+	g1_t *p;
+	/** The randomized signatures. */
+	g1_t *t;
+	/** The signatures. */
+	g1_t *sigs;
+	/** The hashes of the signed messages. */
+	g1_t *h;
+	/** The random exponents. */
+	bn_t *r;
+} bls_rlc_t;
+
+/**
+ * Randomizes a single signature and the hash of its message.
+ *
+ * @param[in,out] args			- the arguments of the randomization.
+ * @param[in] i					- the index of the signature.
+ */
+static void bls_ver_job(void *args, int i) {
+	bls_rlc_t *rlc = (bls_rlc_t *)args;
+
+	g1_mul(rlc->p[i], rlc->h[i], rlc->r[i]);
+	g1_mul(rlc->t[i], rlc->sigs[i], rlc->r[i]);
+}
+
+/**
+ * Checks a batch of BLS signatures with a random linear combination, testing
+ * that \prod e(r_i * H(m_i), q_i) * e(\sum r_i * s_i, -g) = 1. The scalar
+ * multiplications and the Miller loops are spread among the available threads.
+ *
+ * @param[in] sigs				- the signatures.
+ * @param[in] h					- the hashes of the signed messages.
+ * @param[in] qs				- the public keys.
+ * @param[in] n					- the number of signatures.
+ * @return a boolean value indicating if the batch is valid.
+ */
+static int bls_ver_rlc(g1_t *sigs, g1_t *h, g2_t *qs, int n) {
+	g1_t p[n + 1], t[n];
+	g2_t q[n + 1];
+	gt_t e;
+	bn_t r[n];
+	bls_rlc_t rlc;
+	int i, result = 0;
+
+	gt_null(e);
+	for (i = 0; i <= n; i++) {
+		g1_null(p[i]);
+		g2_null(q[i]);
+	}
+	for (i = 0; i < n; i++) {
+		g1_null(t[i]);
+		bn_null(r[i]);
+	}
+
+	TRY {
+		gt_new(e);
+		for (i = 0; i <= n; i++) {
+			g1_new(p[i]);
+			g2_new(q[i]);
+		}
+		for (i = 0; i < n; i++) {
+			g1_new(t[i]);
+			bn_new(r[i]);
+		}
+
+		/* Draw exponents here, as threads work on copies of the generator. */
+		for (i = 0; i < n; i++) {
+			/* A single signature needs no randomization. */
+			if (n == 1) {
+				bn_set_dig(r[i], 1);
+			} else {
+				bn_rand(r[i], BN_POS, CP_BLS_RLC);
+			}
+			g2_copy(q[i], qs[i]);
+		}
+		rlc.p = p;
+		rlc.t = t;
+		rlc.sigs = sigs;
+		rlc.h = h;
+		rlc.r = r;
+		core_par(bls_ver_job, &rlc, n);
+
+		g1_set_infty(p[n]);
+		for (i = 0; i < n; i++) {
+			g1_add(p[n], p[n], t[i]);
+		}
+		g1_norm(p[n], p[n]);
+		g2_get_gen(q[n]);
+		g2_neg(q[n], q[n]);
+		pc_map_sim(e, p, q, n + 1);
+
+		if (gt_cmp_dig(e, 1) == CMP_EQ) {
+			result = 1;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		gt_free(e);
+		for (i = 0; i <= n; i++) {
+			g1_free(p[i]);
+			g2_free(q[i]);
+		}
+		for (i = 0; i < n; i++) {
+			g1_free(t[i]);
+			bn_free(r[i]);
+		}
+	}
+	return result;
+}
+
+/**
+ * Locates the invalid signatures in a batch known to be invalid by recursively
+ * verifying each half of the batch.
+ *
+ * @param[out] ver				- the verdict for each signature.
+ * @param[in] sigs				- the signatures.
+ * @param[in] h					- the hashes of the signed messages.
+ * @param[in] qs				- the public keys.
+ * @param[in] n					- the number of signatures.
+ */
+static void bls_ver_bis(int *ver, g1_t *sigs, g1_t *h, g2_t *qs, int n) {
+	int i, m = n / 2;
+
+	if (n == 1) {
+		ver[0] = 0;
+		return;
+	}
+
+	if (bls_ver_rlc(sigs, h, qs, m)) {
+		for (i = 0; i < m; i++) {
+			ver[i] = 1;
+		}
+	} else {
+		bls_ver_bis(ver, sigs, h, qs, m);
+	}
+	if (bls_ver_rlc(sigs + m, h + m, qs + m, n - m)) {
+		for (i = m; i < n; i++) {
+			ver[i] = 1;
+		}
+	} else {
+		bls_ver_bis(ver + m, sigs + m, h + m, qs + m, n - m);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -79,29 +233,95 @@ int cp_bls_sig(g1_t s, uint8_t *msg, int len, bn_t d) {
 }
 
 int cp_bls_ver(g1_t s, uint8_t *msg, int len, g2_t q) {
-	g1_t p;
-	g2_t g;
-	gt_t e1, e2;
+	g1_t p[2];
+	g2_t r[2];
+	gt_t e;
 	int result = 0;
 
-	g1_null(p);
-	g2_null(g);
-	gt_null(e1);
-	gt_null(e2);
+	g1_null(p[0]);
+	g1_null(p[1]);
+	g2_null(r[0]);
+	g2_null(r[1]);
+	gt_null(e);
 
 	TRY {
-		g1_new(p);
-		g2_new(g);
-		gt_new(e1);
-		gt_new(e2);
+		g1_new(p[0]);
+		g1_new(p[1]);
+		g2_new(r[0]);
+		g2_new(r[1]);
+		gt_new(e);
 
-		g2_get_gen(g);
+		/* Check that e(H(m), q) * e(s, -g) = 1 with a single final exp. */
+		g1_map(p[0], msg, len);
+		g1_copy(p[1], s);
+		g2_copy(r[0], q);
+		g2_get_gen(r[1]);
+		g2_neg(r[1], r[1]);
+		pc_map_sim(e, p, r, 2);
 
-		g1_map(p, msg, len);
-		pc_map(e1, p, q);
-		pc_map(e2, s, g);
+		if (gt_cmp_dig(e, 1) == CMP_EQ) {
+			result = 1;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		g1_free(p[0]);
+		g1_free(p[1]);
+		g2_free(r[0]);
+		g2_free(r[1]);
+		gt_free(e);
+	}
+	return result;
+}
+
+int cp_bls_agg(g1_t s, g1_t *sigs, int n) {
+	int i, result = STS_OK;
 
-		if (gt_cmp(e1, e2) == CMP_EQ) {
+	TRY {
+		g1_set_infty(s);
+		for (i = 0; i < n; i++) {
+			g1_add(s, s, sigs[i]);
+		}
+		g1_norm(s, s);
+	}
+	CATCH_ANY {
+		result = STS_ERR;
+	}
+	return result;
+}
+
+int cp_bls_ver_agg(g1_t s, uint8_t **msgs, int *lens, g2_t *qs, int n) {
+	g1_t p[n + 1];
+	g2_t r[n + 1];
+	gt_t e;
+	int i, result = 0;
+
+	gt_null(e);
+	for (i = 0; i <= n; i++) {
+		g1_null(p[i]);
+		g2_null(r[i]);
+	}
+
+	TRY {
+		gt_new(e);
+		for (i = 0; i <= n; i++) {
+			g1_new(p[i]);
+			g2_new(r[i]);
+		}
+
+		/* Check that \prod e(H(m_i), q_i) * e(s, -g) = 1. */
+		for (i = 0; i < n; i++) {
+			g1_map(p[i], msgs[i], lens[i]);
+			g2_copy(r[i], qs[i]);
+		}
+		g1_copy(p[n], s);
+		g2_get_gen(r[n]);
+		g2_neg(r[n], r[n]);
+		pc_map_sim(e, p, r, n + 1);
+
+		if (gt_cmp_dig(e, 1) == CMP_EQ) {
 			result = 1;
 		}
 	}
@@ -109,10 +329,53 @@ int cp_bls_ver(g1_t s, uint8_t *msg, int len, g2_t q) {
 		THROW(ERR_CAUGHT);
 	}
 	FINALLY {
-		g1_free(p);
-		g2_free(g);
-		gt_free(e1);
-		gt_free(e2);
+		gt_free(e);
+		for (i = 0; i <= n; i++) {
+			g1_free(p[i]);
+			g2_free(r[i]);
+		}
+	}
+	return result;
+}
+
+int cp_bls_ver_batch(int *ver, g1_t *sigs, uint8_t **msgs, int *lens, g2_t *qs,
+		int n) {
+	g1_t h[n];
+	int i, result = 0;
+
+	for (i = 0; i < n; i++) {
+		g1_null(h[i]);
+	}
+
+	TRY {
+		for (i = 0; i < n; i++) {
+			g1_new(h[i]);
+		}
+
+		/* Hash only once, since bisection verifies each message again. */
+		for (i = 0; i < n; i++) {
+			g1_map(h[i], msgs[i], lens[i]);
+		}
+
+		result = bls_ver_rlc(sigs, h, qs, n);
+
+		if (ver != NULL) {
+			if (result) {
+				for (i = 0; i < n; i++) {
+					ver[i] = 1;
+				}
+			} else {
+				bls_ver_bis(ver, sigs, h, qs, n);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; i < n; i++) {
+			g1_free(h[i]);
+		}
 	}
 	return result;
 }
@@ -103,10 +103,7 @@ int cp_ecdsa_sig(bn_t r, bn_t s, uint8_t *msg, int len, int hash, bn_t d) {
 			bn_mod(s, s, n);
 			bn_add(s, s, e);
 			bn_mod(s, s, n);
-			bn_gcd_ext(x, k, NULL, k, n);
-			if (bn_sign(k) == BN_NEG) {
-				bn_add(k, k, n);
-			}
+			bn_mod_inv(k, k, n);
 			bn_mul(s, s, k);
 			bn_mod(s, s, n);
 		} while (bn_is_zero(s));
@@ -582,6 +582,114 @@ static int pad_pkcs2(bn_t m, int *p_len, int m_len, int k_len, int operation) {
 
 #endif
 
+#if CP_RSA == QUICK || !defined(STRIP)
+
+/**
+ * Arguments of the exponentiations modulo each prime of an RSA modulus.
+ */
+typedef struct {
+	/** The results of the exponentiations. */
+	bn_t *m;
+	/** The value to exponentiate. */
+	bn_st *c;
+	/** The private key. */
+	rsa_st *prv;
+} rsa_crt_t;
+
+/**
+ * Exponentiates a value modulo a single prime of an RSA modulus.
+ *
+ * @param[in,out] args			- the arguments of the exponentiations.
+ * @param[in] i					- the index of the prime.
+ */
+static void rsa_crt_job(void *args, int i) {
+	rsa_crt_t *crt = (rsa_crt_t *)args;
+	rsa_st *prv = crt->prv;
+
+	if (i == 0) {
+		bn_mxp(crt->m[0], crt->c, prv->dp, prv->p);
+	} else if (i == 1) {
+		bn_mxp(crt->m[1], crt->c, prv->dq, prv->q);
+	} else {
+		bn_mxp(crt->m[i], crt->c, prv->dr[i - 2], prv->r[i - 2]);
+	}
+}
+
+/**
+ * Applies the RSA private exponent with the Chinese Remainder Theorem, as in
+ * the RSADP primitive of PKCS #1 v2.2. The exponentiations modulo each prime
+ * are independent and run on separate threads when multithreading is enabled.
+ *
+ * @param[in,out] c				- the value to exponentiate.
+ * @param[in] prv				- the private key.
+ */
+static void rsa_crt(bn_t c, rsa_t prv) {
+	bn_t h, t, m[CP_RSA_PRIMES];
+	rsa_crt_t crt;
+	int i, k = MIN(MAX(prv->primes, 2), CP_RSA_PRIMES);
+
+	bn_null(h);
+	bn_null(t);
+	for (i = 0; i < k; i++) {
+		bn_null(m[i]);
+	}
+
+	TRY {
+		bn_new(h);
+		bn_new(t);
+		for (i = 0; i < k; i++) {
+			bn_new(m[i]);
+		}
+
+		/* m_i = c^d_i mod r_i. */
+		crt.m = m;
+		crt.c = c;
+		crt.prv = prv;
+		core_par(rsa_crt_job, &crt, k);
+
+		/* h = qInv(m1 - m2) mod p. */
+		bn_sub(h, m[0], m[1]);
+		while (bn_sign(h) == BN_NEG) {
+			bn_add(h, h, prv->p);
+		}
+		bn_mod(h, h, prv->p);
+		bn_mul(h, h, prv->qi);
+		bn_mod(h, h, prv->p);
+		/* m = m2 + h * q. */
+		bn_mul(c, h, prv->q);
+		bn_add(c, c, m[1]);
+
+		/* R = pq. */
+		bn_mul(t, prv->p, prv->q);
+		for (i = 2; i < k; i++) {
+			/* h = t_i(m_i - m) mod r_i. */
+			bn_mod(h, c, prv->r[i - 2]);
+			bn_sub(h, m[i], h);
+			if (bn_sign(h) == BN_NEG) {
+				bn_add(h, h, prv->r[i - 2]);
+			}
+			bn_mul(h, h, prv->tr[i - 2]);
+			bn_mod(h, h, prv->r[i - 2]);
+			/* m = m + R * h and R = R * r_i. */
+			bn_mul(h, h, t);
+			bn_add(c, c, h);
+			bn_mul(t, t, prv->r[i - 2]);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(h);
+		bn_free(t);
+		for (i = 0; i < k; i++) {
+			bn_free(m[i]);
+		}
+	}
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -712,6 +820,7 @@ int cp_rsa_gen_quick(rsa_t pub, rsa_t prv, int bits) {
 				bn_add(prv->qi, prv->qi, prv->p);
 			}
 
+			prv->primes = 2;
 			result = STS_OK;
 		}
 	}
@@ -726,6 +835,114 @@ int cp_rsa_gen_quick(rsa_t pub, rsa_t prv, int bits) {
 	return result;
 }
 
+int cp_rsa_gen_multi(rsa_t pub, rsa_t prv, int bits, int primes) {
+	bn_t t, r, u, s[CP_RSA_PRIMES];
+	int i, j, result = STS_OK;
+
+	if (pub == NULL || prv == NULL || bits == 0 || primes < 2 ||
+			primes > CP_RSA_PRIMES) {
+		return STS_ERR;
+	}
+
+	if (primes == 2) {
+		return cp_rsa_gen_quick(pub, prv, bits);
+	}
+
+	bn_null(t);
+	bn_null(r);
+	bn_null(u);
+	for (i = 0; i < primes; i++) {
+		bn_null(s[i]);
+	}
+
+	TRY {
+		bn_new(t);
+		bn_new(r);
+		bn_new(u);
+		for (i = 0; i < primes; i++) {
+			bn_new(s[i]);
+		}
+
+		bn_set_2b(pub->e, 16);
+		bn_add_dig(pub->e, pub->e, 1);
+
+		do {
+			/* Generate distinct primes, the last one taking the leftover bits. */
+			for (i = 0; i < primes; i++) {
+				do {
+					bn_gen_prime(s[i], (i < primes - 1 ? bits / primes :
+							bits - (primes - 1) * (bits / primes)));
+					for (j = 0; j < i; j++) {
+						if (bn_cmp(s[i], s[j]) == CMP_EQ) {
+							break;
+						}
+					}
+				} while (j < i);
+			}
+
+			/* n = \prod r_i and phi(n) = \prod (r_i - 1). */
+			bn_set_dig(pub->n, 1);
+			bn_set_dig(t, 1);
+			for (i = 0; i < primes; i++) {
+				bn_mul(pub->n, pub->n, s[i]);
+				bn_sub_dig(u, s[i], 1);
+				bn_mul(t, t, u);
+			}
+
+			/* d = e^(-1) mod phi(n). */
+			bn_gcd_ext(r, prv->d, NULL, pub->e, t);
+		} while (bn_cmp_dig(r, 1) != CMP_EQ);
+
+		if (bn_sign(prv->d) == BN_NEG) {
+			bn_add(prv->d, prv->d, t);
+		}
+		bn_copy(prv->n, pub->n);
+		bn_copy(prv->e, pub->e);
+		bn_copy(prv->p, s[0]);
+		bn_copy(prv->q, s[1]);
+
+		/* dP = d mod (p - 1) and dQ = d mod (q - 1). */
+		bn_sub_dig(u, prv->p, 1);
+		bn_mod(prv->dp, prv->d, u);
+		bn_sub_dig(u, prv->q, 1);
+		bn_mod(prv->dq, prv->d, u);
+
+		/* qInv = q^(-1) mod p. */
+		bn_gcd_ext(r, prv->qi, NULL, prv->q, prv->p);
+		if (bn_sign(prv->qi) == BN_NEG) {
+			bn_add(prv->qi, prv->qi, prv->p);
+		}
+
+		/* R = pq, d_i = d mod (r_i - 1) and t_i = R^(-1) mod r_i. */
+		bn_mul(t, prv->p, prv->q);
+		for (i = 2; i < primes; i++) {
+			bn_copy(prv->r[i - 2], s[i]);
+			bn_sub_dig(u, s[i], 1);
+			bn_mod(prv->dr[i - 2], prv->d, u);
+			bn_mod(u, t, s[i]);
+			bn_gcd_ext(r, prv->tr[i - 2], NULL, u, s[i]);
+			if (bn_sign(prv->tr[i - 2]) == BN_NEG) {
+				bn_add(prv->tr[i - 2], prv->tr[i - 2], s[i]);
+			}
+			bn_mul(t, t, s[i]);
+		}
+		prv->primes = primes;
+	}
+	CATCH_ANY {
+		result = STS_ERR;
+	}
+	FINALLY {
+		bn_free(t);
+		bn_free(r);
+		bn_free(u);
+		for (i = 0; i < primes; i++) {
+			bn_free(s[i]);
+		}
+	}
+
+	return result;
+}
+
 #endif
 
 int cp_rsa_enc(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t pub) {
@@ -846,10 +1063,9 @@ int cp_rsa_dec_basic(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t
 #if CP_RSA == QUICK || !defined(STRIP)
 
 int cp_rsa_dec_quick(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t prv) {
-	bn_t m, eb;
+	bn_t eb;
 	int size, pad_len, result = STS_OK;
 
-	bn_null(m);
 	bn_null(eb);
 
 	size = bn_size_bin(prv->n);
@@ -859,31 +1075,12 @@ int cp_rsa_dec_quick(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t
 	}
 
 	TRY {
-		bn_new(m);
 		bn_new(eb);
 
 		bn_read_bin(eb, in, in_len);
 
-		bn_copy(m, eb);
-
-		/* m1 = c^dP mod p. */
-		bn_mxp(eb, eb, prv->dp, prv->p);
-
-		/* m2 = c^dQ mod q. */
-		bn_mxp(m, m, prv->dq, prv->q);
-
-		/* m1 = m1 - m2 mod p. */
-		bn_sub(eb, eb, m);
-		while (bn_sign(eb) == BN_NEG) {
-			bn_add(eb, eb, prv->p);
-		}
-		bn_mod(eb, eb, prv->p);
-		/* m1 = qInv(m1 - m2) mod p. */
-		bn_mul(eb, eb, prv->qi);
-		bn_mod(eb, eb, prv->p);
-		/* m = m2 + m1 * q. */
-		bn_mul(eb, eb, prv->q);
-		bn_add(eb, eb, m);
+		/* m = c^d mod n, one exponentiation per prime. */
+		rsa_crt(eb, prv);
 
 		if (bn_cmp(eb, prv->n) != CMP_LT) {
 			result = STS_ERR;
@@ -912,7 +1109,6 @@ int cp_rsa_dec_quick(uint8_t *out, int *out_len, uint8_t *in, int in_len, rsa_t
 		result = STS_ERR;
 	}
 	FINALLY {
-		bn_free(m);
 		bn_free(eb);
 	}
 
@@ -1065,26 +1261,8 @@ int cp_rsa_sig_quick(uint8_t *sig, int *sig_len, uint8_t *msg, int msg_len, int
 			pad_pkcs2(eb, &pad_len, bn_bits(prv->n), size, RSA_SIG_FIN);
 #endif
 
-			bn_copy(m, eb);
-
-			/* m1 = c^dP mod p. */
-			bn_mxp(eb, eb, prv->dp, prv->p);
-
-			/* m2 = c^dQ mod q. */
-			bn_mxp(m, m, prv->dq, prv->q);
-
-			/* m1 = m1 - m2 mod p. */
-			bn_sub(eb, eb, m);
-			while (bn_sign(eb) == BN_NEG) {
-				bn_add(eb, eb, prv->p);
-			}
-			bn_mod(eb, eb, prv->p);
-			/* m1 = qInv(m1 - m2) mod p. */
-			bn_mul(eb, eb, prv->qi);
-			bn_mod(eb, eb, prv->p);
-			/* m = m2 + m1 * q. */
-			bn_mul(eb, eb, prv->q);
-			bn_add(eb, eb, m);
+			/* s = m^d mod n, one exponentiation per prime. */
+			rsa_crt(eb, prv);
 			bn_mod(eb, eb, prv->n);
 
 			size = bn_size_bin(prv->n);
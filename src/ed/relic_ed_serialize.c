@@ -95,6 +95,86 @@ int ed_upk(ed_t r, const ed_t p) {
 	return result;
 }
 
+int ed_upk_bat(ed_t *r, const ed_t *p, int n, dig_t *s) {
+	int i, b, result = 1;
+	dig_t *buf = s;
+	fp_t u, t;
+
+	if (n <= 0) {
+		return 1;
+	}
+
+	if (buf == NULL) {
+		buf = (dig_t *)malloc(ED_BATCH(n) * sizeof(dig_t));
+		if (buf == NULL) {
+			THROW(ERR_NO_MEMORY);
+			return 0;
+		}
+	}
+
+	fp_null(u);
+	fp_null(t);
+
+	TRY {
+		fp_new(u);
+		fp_new(t);
+
+		/* Keep the denominators d * y^2 - a in z and the sign bits in x. */
+		fp_set_dig(u, 1);
+		for (i = 0; i < n; i++) {
+			b = fp_get_bit(p[i]->x, 0);
+			fp_copy(r[i]->y, p[i]->y);
+			fp_sqr(t, r[i]->y);
+			fp_mul(t, t, core_get()->ed_d);
+			fp_sub(r[i]->z, t, core_get()->ed_a);
+			fp_zero(r[i]->x);
+			fp_set_bit(r[i]->x, 0, b);
+			if (!fp_is_zero(r[i]->z)) {
+				fp_mul(u, u, r[i]->z);
+			}
+			fp_copy(buf + i * FP_DIGS, u);
+		}
+
+		fp_inv(u, u);
+
+		/* x = +/- sqrt((y^2 - 1) / (d * y^2 - a)). */
+		for (i = n - 1; i >= 0; i--) {
+			if (fp_is_zero(r[i]->z)) {
+				fp_zero(t);
+			} else if (i > 0) {
+				fp_mul(t, u, buf + (i - 1) * FP_DIGS);
+				fp_mul(u, u, r[i]->z);
+			} else {
+				fp_copy(t, u);
+			}
+			b = fp_get_bit(r[i]->x, 0);
+			fp_sqr(r[i]->x, r[i]->y);
+			fp_sub_dig(r[i]->x, r[i]->x, 1);
+			fp_mul(r[i]->x, r[i]->x, t);
+			result &= fp_srt(r[i]->x, r[i]->x);
+			if (fp_get_bit(r[i]->x, 0) != b) {
+				fp_neg(r[i]->x, r[i]->x);
+			}
+#if ED_ADD == EXTND
+			fp_mul(r[i]->t, r[i]->x, r[i]->y);
+#endif
+			fp_set_dig(r[i]->z, 1);
+			r[i]->norm = 1;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(u);
+		fp_free(t);
+		if (s == NULL) {
+			free(buf);
+		}
+	}
+	return result;
+}
+
 void ed_write_bin(uint8_t *bin, int len, const ed_t a, int pack) {
 	ed_t t;
 
@@ -246,6 +246,74 @@ void ed_norm_sim(ed_t *r, const ed_t *t, int n) {
 	}
 }
 
+void ed_norm_bat(ed_t *r, const ed_t *p, int n, dig_t *s) {
+	int i;
+	dig_t *buf = s;
+	fp_t u, t;
+
+	if (n <= 0) {
+		return;
+	}
+
+	if (buf == NULL) {
+		buf = (dig_t *)malloc(ED_BATCH(n) * sizeof(dig_t));
+		if (buf == NULL) {
+			THROW(ERR_NO_MEMORY);
+			return;
+		}
+	}
+
+	fp_null(u);
+	fp_null(t);
+
+	TRY {
+		fp_new(u);
+		fp_new(t);
+
+		/* Store the running products of the coordinates to invert. */
+		fp_set_dig(u, 1);
+		for (i = 0; i < n; i++) {
+			if (!fp_is_zero(p[i]->z) && fp_cmp_dig(p[i]->z, 1) != CMP_EQ) {
+				fp_mul(u, u, p[i]->z);
+			}
+			fp_copy(buf + i * FP_DIGS, u);
+		}
+
+		fp_inv(u, u);
+
+		/* Peel one inverse at a time off the inverse of the full product. */
+		for (i = n - 1; i >= 0; i--) {
+			if (fp_is_zero(p[i]->z) || fp_cmp_dig(p[i]->z, 1) == CMP_EQ) {
+				ed_copy(r[i], p[i]);
+				continue;
+			}
+			if (i > 0) {
+				fp_mul(t, u, buf + (i - 1) * FP_DIGS);
+			} else {
+				fp_copy(t, u);
+			}
+			fp_mul(u, u, p[i]->z);
+
+			fp_mul(r[i]->x, p[i]->x, t);
+			fp_mul(r[i]->y, p[i]->y, t);
+#if ED_ADD == EXTND
+			fp_mul(r[i]->t, p[i]->t, t);
+#endif
+			fp_set_dig(r[i]->z, 1);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(u);
+		fp_free(t);
+		if (s == NULL) {
+			free(buf);
+		}
+	}
+}
+
 /*
 void ed_norm(ed_t r, const ed_t p) {
 	if (fp_cmp_dig(p->z, 1) == CMP_EQ) {
@@ -362,6 +430,53 @@ int ed_is_valid(const ed_t p) {
 	return r;
 }
 
+int ed_is_valid_bat(const ed_t *p, int n) {
+	fp_t t0, t1, t2;
+	int i, r = 1;
+
+	fp_null(t0);
+	fp_null(t1);
+	fp_null(t2);
+
+	TRY {
+		fp_new(t0);
+		fp_new(t1);
+		fp_new(t2);
+
+		/* Check (a * X^2 + Y^2) * Z^2 = Z^4 + d * X^2 * Y^2 without inverting
+		 * Z, and also T * Z = X * Y in extended coordinates. */
+		for (i = 0; i < n; i++) {
+			if (fp_is_zero(p[i]->z)) {
+				r = 0;
+				break;
+			}
+			fp_sqr(t0, p[i]->x);
+			fp_sqr(t1, p[i]->y);
+			fp_mul(t2, t0, t1);
+			fp_mul(t2, t2, core_get()->ed_d);
+			fp_mul(t0, t0, core_get()->ed_a);
+			fp_add(t0, t0, t1);
+			fp_sqr(t1, p[i]->z);
+			fp_mul(t0, t0, t1);
+			fp_sqr(t1, t1);
+			fp_add(t1, t1, t2);
+			r &= (fp_cmp(t0, t1) == CMP_EQ);
+#if ED_ADD == EXTND
+			fp_mul(t0, p[i]->t, p[i]->z);
+			fp_mul(t1, p[i]->x, p[i]->y);
+			r &= (fp_cmp(t0, t1) == CMP_EQ);
+#endif
+		}
+	} CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	} FINALLY {
+		fp_free(t0);
+		fp_free(t1);
+		fp_free(t2);
+	}
+	return r;
+}
+
 void ed_tab(ed_t *t, const ed_t p, int w) {
 	if (w > 2) {
 		ed_dbl(t[0], p);
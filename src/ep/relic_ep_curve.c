@@ -82,6 +82,215 @@ static void detect_opt(int *opt, fp_t a) {
 	}
 }
 
+/**
+ * Tests if the polynomial x^3 + ax + c has a root in the prime field, by
+ * computing gcd(x^3 + ax + c, x^p - x).
+ *
+ * @param[in] a			- the coefficient of x.
+ * @param[in] c			- the constant coefficient.
+ * @return 1 if the polynomial has a root, 0 otherwise.
+ */
+static int detect_root(const fp_t a, const fp_t c) {
+	fp_t r[3], d[5], f[4], g[4], t;
+	bn_t e;
+	int i, j, k, df, dg, result = 1;
+
+	bn_null(e);
+	fp_null(t);
+	for (i = 0; i < 5; i++) {
+		fp_null(d[i]);
+	}
+	for (i = 0; i < 4; i++) {
+		fp_null(f[i]);
+		fp_null(g[i]);
+	}
+	for (i = 0; i < 3; i++) {
+		fp_null(r[i]);
+	}
+
+	TRY {
+		bn_new(e);
+		fp_new(t);
+		for (i = 0; i < 5; i++) {
+			fp_new(d[i]);
+		}
+		for (i = 0; i < 4; i++) {
+			fp_new(f[i]);
+			fp_new(g[i]);
+		}
+		for (i = 0; i < 3; i++) {
+			fp_new(r[i]);
+		}
+
+		/* Compute r = x^p mod (x^3 + ax + c), left to right. */
+		bn_read_raw(e, fp_prime_get(), FP_DIGS);
+		fp_set_dig(r[0], 1);
+		fp_zero(r[1]);
+		fp_zero(r[2]);
+		for (i = bn_bits(e) - 1; i >= 0; i--) {
+			for (j = 0; j < 5; j++) {
+				fp_zero(d[j]);
+			}
+			for (j = 0; j < 3; j++) {
+				for (k = 0; k < 3; k++) {
+					fp_mul(t, r[j], r[k]);
+					fp_add(d[j + k], d[j + k], t);
+				}
+			}
+			/* Reduce with x^j = -ax^(j - 2) - cx^(j - 3). */
+			for (j = 4; j >= 3; j--) {
+				fp_mul(t, d[j], a);
+				fp_sub(d[j - 2], d[j - 2], t);
+				fp_mul(t, d[j], c);
+				fp_sub(d[j - 3], d[j - 3], t);
+			}
+			if (bn_get_bit(e, i)) {
+				/* Multiply by x. */
+				fp_copy(r[2], d[1]);
+				fp_mul(t, d[2], a);
+				fp_sub(r[1], d[0], t);
+				fp_mul(r[0], d[2], c);
+				fp_neg(r[0], r[0]);
+			} else {
+				for (j = 0; j < 3; j++) {
+					fp_copy(r[j], d[j]);
+				}
+			}
+		}
+
+		/* Run the Euclidean algorithm on f = x^3 + ax + c and g = r - x. */
+		fp_copy(f[0], c);
+		fp_copy(f[1], a);
+		fp_zero(f[2]);
+		fp_set_dig(f[3], 1);
+		for (j = 0; j < 3; j++) {
+			fp_copy(g[j], r[j]);
+		}
+		fp_sub_dig(g[1], g[1], 1);
+		fp_zero(g[3]);
+		df = 3;
+		dg = 3;
+		while (1) {
+			while (dg >= 0 && fp_is_zero(g[dg])) {
+				dg--;
+			}
+			if (dg < 0) {
+				break;
+			}
+			/* Reduce f modulo g. */
+			fp_inv(t, g[dg]);
+			while (df >= dg) {
+				fp_mul(d[0], f[df], t);
+				for (j = 0; j < dg; j++) {
+					fp_mul(d[1], d[0], g[j]);
+					fp_sub(f[df - dg + j], f[df - dg + j], d[1]);
+				}
+				fp_zero(f[df]);
+				while (df >= 0 && fp_is_zero(f[df])) {
+					df--;
+				}
+			}
+			for (j = 0; j < 4; j++) {
+				fp_copy(d[0], f[j]);
+				fp_copy(f[j], g[j]);
+				fp_copy(g[j], d[0]);
+			}
+			j = df;
+			df = dg;
+			dg = j;
+		}
+		/* The polynomials share a linear factor if the gcd is not constant. */
+		result = (df > 0);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(e);
+		fp_free(t);
+		for (i = 0; i < 5; i++) {
+			fp_free(d[i]);
+		}
+		for (i = 0; i < 4; i++) {
+			fp_free(f[i]);
+			fp_free(g[i]);
+		}
+		for (i = 0; i < 3; i++) {
+			fp_free(r[i]);
+		}
+	}
+	return result;
+}
+
+/**
+ * Computes the constant used by the deterministic hash on the curve being
+ * configured. Curves with A = 0 get a square root of -3 for the SvdW map.
+ * Other curves get the Z of the simplified SWU map, chosen as in RFC 9380:
+ * the first of 2, -2, 3, -3, ... that is a non-square, makes g(x) - Z
+ * irreducible and makes g(B/(Z * A)) a square. The value -1 is never taken.
+ * The constant is zero if B = 0 or if -3 is not a square.
+ *
+ * @param[out] z		- the constant.
+ */
+static void detect_map(fp_t z) {
+	ctx_t *ctx = core_get();
+	fp_t t, u;
+	int i;
+
+	fp_null(t);
+	fp_null(u);
+
+	TRY {
+		fp_new(t);
+		fp_new(u);
+
+		fp_zero(z);
+		if (fp_is_zero(ctx->ep->b)) {
+			/* Neither encoding works with B = 0. */
+		} else if (fp_is_zero(ctx->ep->a)) {
+			fp_set_dig(t, 3);
+			fp_neg(t, t);
+			if (!fp_srt(z, t)) {
+				fp_zero(z);
+			}
+		} else {
+			/* Candidates 1 and -1 are skipped: one is a square, the other is
+			 * excluded by the RFC. */
+			for (i = 4; ; i++) {
+				fp_set_dig(z, i / 2);
+				if (i % 2 == 1) {
+					fp_neg(z, z);
+				}
+				if (fp_is_sqr(z)) {
+					continue;
+				}
+				fp_sub(t, ctx->ep->b, z);
+				if (detect_root(ctx->ep->a, t)) {
+					continue;
+				}
+				/* Compute g(B/(Z * A)). */
+				fp_mul(t, z, ctx->ep->a);
+				fp_inv(t, t);
+				fp_mul(t, t, ctx->ep->b);
+				fp_sqr(u, t);
+				fp_add(u, u, ctx->ep->a);
+				fp_mul(u, u, t);
+				fp_add(u, u, ctx->ep->b);
+				if (fp_is_sqr(u)) {
+					break;
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(t);
+		fp_free(u);
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -90,28 +299,29 @@ void ep_curve_init(void) {
 	ctx_t *ctx = core_get();
 #ifdef EP_PRECO
 	for (int i = 0; i < EP_TABLE; i++) {
-		ctx->ep_ptr[i] = &(ctx->ep_pre[i]);
+		ctx->ep->ptr[i] = &(ctx->ep->pre[i]);
 	}
 #endif
 #if ALLOC == STATIC
-	fp_new(ctx->ep_g.x);
-	fp_new(ctx->ep_g.y);
-	fp_new(ctx->ep_g.z);
+	fp_new(ctx->ep->g.x);
+	fp_new(ctx->ep->g.y);
+	fp_new(ctx->ep->g.z);
 #ifdef EP_PRECO
 	for (int i = 0; i < EP_TABLE; i++) {
-		fp_new(ctx->ep_pre[i].x);
-		fp_new(ctx->ep_pre[i].y);
-		fp_new(ctx->ep_pre[i].z);
+		fp_new(ctx->ep->pre[i].x);
+		fp_new(ctx->ep->pre[i].y);
+		fp_new(ctx->ep->pre[i].z);
 	}
 #endif
 #endif
-	ep_set_infty(&ctx->ep_g);
-	bn_init(&ctx->ep_r, FP_DIGS);
-	bn_init(&ctx->ep_h, FP_DIGS);
+	ctx->ep->id = 0;
+	ep_set_infty(&ctx->ep->g);
+	bn_init(&ctx->ep->r, FP_DIGS);
+	bn_init(&ctx->ep->h, FP_DIGS);
 #if defined(EP_ENDOM) && (EP_MUL == LWNAF || EP_FIX == COMBS || EP_FIX == LWNAF || !defined(STRIP))
 	for (int i = 0; i < 3; i++) {
-		bn_init(&(ctx->ep_v1[i]), FP_DIGS);
-		bn_init(&(ctx->ep_v2[i]), FP_DIGS);
+		bn_init(&(ctx->ep->v1[i]), FP_DIGS);
+		bn_init(&(ctx->ep->v2[i]), FP_DIGS);
 	}
 #endif
 }
@@ -119,83 +329,100 @@ void ep_curve_init(void) {
 void ep_curve_clean(void) {
 	ctx_t *ctx = core_get();
 #if ALLOC == STATIC
-	fp_free(ctx->ep_g.x);
-	fp_free(ctx->ep_g.y);
-	fp_free(ctx->ep_g.z);
+	fp_free(ctx->ep->g.x);
+	fp_free(ctx->ep->g.y);
+	fp_free(ctx->ep->g.z);
 #ifdef EP_PRECO
 	for (int i = 0; i < EP_TABLE; i++) {
-		fp_free(ctx->ep_pre[i].x);
-		fp_free(ctx->ep_pre[i].y);
-		fp_free(ctx->ep_pre[i].z);
+		fp_free(ctx->ep->pre[i].x);
+		fp_free(ctx->ep->pre[i].y);
+		fp_free(ctx->ep->pre[i].z);
 	}
 #endif
 #endif
-	bn_clean(&ctx->ep_r);
-	bn_clean(&ctx->ep_h);
+	bn_clean(&ctx->ep->r);
+	bn_clean(&ctx->ep->h);
 #if defined(EP_ENDOM) && (EP_MUL == LWNAF || EP_FIX == LWNAF || !defined(STRIP))
 	for (int i = 0; i < 3; i++) {
-		bn_clean(&(ctx->ep_v1[i]));
-		bn_clean(&(ctx->ep_v2[i]));
+		bn_clean(&(ctx->ep->v1[i]));
+		bn_clean(&(ctx->ep->v2[i]));
 	}
 #endif
 }
 
+ep_curve_t ep_curve_get(void) {
+	return core_get()->ep;
+}
+
+void ep_curve_set(ep_curve_t curve) {
+	ctx_t *ctx = core_get();
+
+	if (curve == NULL) {
+		curve = &(ctx->ep_def);
+	}
+	ctx->ep = curve;
+}
+
 dig_t *ep_curve_get_b() {
-	return core_get()->ep_b;
+	return core_get()->ep->b;
 }
 
 dig_t *ep_curve_get_a() {
-	return core_get()->ep_a;
+	return core_get()->ep->a;
+}
+
+dig_t *ep_curve_get_map() {
+	return core_get()->ep->map_z;
 }
 
 #if defined(EP_ENDOM) && (EP_MUL == LWNAF || EP_FIX == COMBS || EP_FIX == LWNAF || EP_SIM == INTER || !defined(STRIP))
 
 dig_t *ep_curve_get_beta() {
-	return core_get()->beta;
+	return core_get()->ep->beta;
 }
 
 void ep_curve_get_v1(bn_t v[]) {
 	ctx_t *ctx = core_get();
 	for (int i = 0; i < 3; i++) {
-		bn_copy(v[i], &(ctx->ep_v1[i]));
+		bn_copy(v[i], &(ctx->ep->v1[i]));
 	}
 }
 
 void ep_curve_get_v2(bn_t v[]) {
 	ctx_t *ctx = core_get();
 	for (int i = 0; i < 3; i++) {
-		bn_copy(v[i], &(ctx->ep_v2[i]));
+		bn_copy(v[i], &(ctx->ep->v2[i]));
 	}
 }
 
 #endif
 
 int ep_curve_opt_a() {
-	return core_get()->ep_opt_a;
+	return core_get()->ep->opt_a;
 }
 
 int ep_curve_opt_b() {
-	return core_get()->ep_opt_b;
+	return core_get()->ep->opt_b;
 }
 
 int ep_curve_is_endom() {
-	return core_get()->ep_is_endom;
+	return core_get()->ep->is_endom;
 }
 
 int ep_curve_is_super() {
-	return core_get()->ep_is_super;
+	return core_get()->ep->is_super;
 }
 
 void ep_curve_get_gen(ep_t g) {
-	ep_copy(g, &core_get()->ep_g);
+	ep_copy(g, &core_get()->ep->g);
 }
 
 void ep_curve_get_ord(bn_t n) {
-	bn_copy(n, &core_get()->ep_r);
+	bn_copy(n, &core_get()->ep->r);
 }
 
 void ep_curve_get_cof(bn_t h) {
-	bn_copy(h, &core_get()->ep_h);
+	bn_copy(h, &core_get()->ep->h);
 }
 
 const ep_t *ep_curve_get_tab() {
@@ -203,9 +430,9 @@ const ep_t *ep_curve_get_tab() {
 
 	/* Return a meaningful pointer. */
 #if ALLOC == AUTO
-	return (const ep_t *)*core_get()->ep_ptr;
+	return (const ep_t *)*core_get()->ep->ptr;
 #else
-	return (const ep_t *)core_get()->ep_ptr;
+	return (const ep_t *)core_get()->ep->ptr;
 #endif
 
 #else
@@ -219,21 +446,22 @@ const ep_t *ep_curve_get_tab() {
 void ep_curve_set_plain(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 		const bn_t h) {
 	ctx_t *ctx = core_get();
-	ctx->ep_is_endom = 0;
-	ctx->ep_is_super = 0;
+	ctx->ep->is_endom = 0;
+	ctx->ep->is_super = 0;
 
-	fp_copy(ctx->ep_a, a);
-	fp_copy(ctx->ep_b, b);
+	fp_copy(ctx->ep->a, a);
+	fp_copy(ctx->ep->b, b);
 
-	detect_opt(&(ctx->ep_opt_a), ctx->ep_a);
-	detect_opt(&(ctx->ep_opt_b), ctx->ep_b);
+	detect_opt(&(ctx->ep->opt_a), ctx->ep->a);
+	detect_opt(&(ctx->ep->opt_b), ctx->ep->b);
+	detect_map(ctx->ep->map_z);
 
-	ep_norm(&(ctx->ep_g), g);
-	bn_copy(&(ctx->ep_r), r);
-	bn_copy(&(ctx->ep_h), h);
+	ep_norm(&(ctx->ep->g), g);
+	bn_copy(&(ctx->ep->r), r);
+	bn_copy(&(ctx->ep->h), h);
 
 #if defined(EP_PRECO)
-	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
+	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep->g));
 #endif
 }
 
@@ -244,21 +472,22 @@ void ep_curve_set_plain(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 void ep_curve_set_super(const fp_t a, const fp_t b, const ep_t g, const bn_t r,
 		const bn_t h) {
 	ctx_t *ctx = core_get();
-	ctx->ep_is_endom = 0;
-	ctx->ep_is_super = 1;
+	ctx->ep->is_endom = 0;
+	ctx->ep->is_super = 1;
 
-	fp_copy(ctx->ep_a, a);
-	fp_copy(ctx->ep_b, b);
+	fp_copy(ctx->ep->a, a);
+	fp_copy(ctx->ep->b, b);
 
-	detect_opt(&(ctx->ep_opt_a), ctx->ep_a);
-	detect_opt(&(ctx->ep_opt_b), ctx->ep_b);
+	detect_opt(&(ctx->ep->opt_a), ctx->ep->a);
+	detect_opt(&(ctx->ep->opt_b), ctx->ep->b);
+	detect_map(ctx->ep->map_z);
 
-	ep_norm(&(ctx->ep_g), g);
-	bn_copy(&(ctx->ep_r), r);
-	bn_copy(&(ctx->ep_h), h);
+	ep_norm(&(ctx->ep->g), g);
+	bn_copy(&(ctx->ep->r), r);
+	bn_copy(&(ctx->ep->h), h);
 
 #if defined(EP_PRECO)
-	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
+	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep->g));
 #endif
 }
 
@@ -270,56 +499,57 @@ void ep_curve_set_endom(const fp_t b, const ep_t g, const bn_t r, const bn_t h,
 		const fp_t beta, const bn_t l) {
 	int bits = bn_bits(r);
 	ctx_t *ctx = core_get();
-	ctx->ep_is_endom = 1;
-	ctx->ep_is_super = 0;
+	ctx->ep->is_endom = 1;
+	ctx->ep->is_super = 0;
 
-	fp_zero(ctx->ep_a);
-	fp_copy(ctx->ep_b, b);
+	fp_zero(ctx->ep->a);
+	fp_copy(ctx->ep->b, b);
 
-	detect_opt(&(ctx->ep_opt_a), ctx->ep_a);
-	detect_opt(&(ctx->ep_opt_b), ctx->ep_b);
+	detect_opt(&(ctx->ep->opt_a), ctx->ep->a);
+	detect_opt(&(ctx->ep->opt_b), ctx->ep->b);
+	detect_map(ctx->ep->map_z);
 
 #if EP_MUL == LWNAF || EP_FIX == COMBS || EP_FIX == LWNAF || EP_SIM == INTER || !defined(STRIP)
-	fp_copy(ctx->beta, beta);
-	bn_gcd_ext_mid(&(ctx->ep_v1[1]), &(ctx->ep_v1[2]), &(ctx->ep_v2[1]),
-			&(ctx->ep_v2[2]), l, r);
+	fp_copy(ctx->ep->beta, beta);
+	bn_gcd_ext_mid(&(ctx->ep->v1[1]), &(ctx->ep->v1[2]), &(ctx->ep->v2[1]),
+			&(ctx->ep->v2[2]), l, r);
 	/* l = v1[1] * v2[2] - v1[2] * v2[1], r = l / 2. */
-	bn_mul(&(ctx->ep_v1[0]), &(ctx->ep_v1[1]), &(ctx->ep_v2[2]));
-	bn_mul(&(ctx->ep_v2[0]), &(ctx->ep_v1[2]), &(ctx->ep_v2[1]));
-	bn_sub(&(ctx->ep_r), &(ctx->ep_v1[0]), &(ctx->ep_v2[0]));
-	bn_hlv(&(ctx->ep_r), &(ctx->ep_r));
+	bn_mul(&(ctx->ep->v1[0]), &(ctx->ep->v1[1]), &(ctx->ep->v2[2]));
+	bn_mul(&(ctx->ep->v2[0]), &(ctx->ep->v1[2]), &(ctx->ep->v2[1]));
+	bn_sub(&(ctx->ep->r), &(ctx->ep->v1[0]), &(ctx->ep->v2[0]));
+	bn_hlv(&(ctx->ep->r), &(ctx->ep->r));
 	/* v1[0] = round(v2[2] * 2^|n| / l). */
-	bn_lsh(&(ctx->ep_v1[0]), &(ctx->ep_v2[2]), bits + 1);
-	if (bn_sign(&(ctx->ep_v1[0])) == BN_POS) {
-		bn_add(&(ctx->ep_v1[0]), &(ctx->ep_v1[0]), &(ctx->ep_r));
+	bn_lsh(&(ctx->ep->v1[0]), &(ctx->ep->v2[2]), bits + 1);
+	if (bn_sign(&(ctx->ep->v1[0])) == BN_POS) {
+		bn_add(&(ctx->ep->v1[0]), &(ctx->ep->v1[0]), &(ctx->ep->r));
 	} else {
-		bn_sub(&(ctx->ep_v1[0]), &(ctx->ep_v1[0]), &(ctx->ep_r));
+		bn_sub(&(ctx->ep->v1[0]), &(ctx->ep->v1[0]), &(ctx->ep->r));
 	}
-	bn_dbl(&(ctx->ep_r), &(ctx->ep_r));
-	bn_div(&(ctx->ep_v1[0]), &(ctx->ep_v1[0]), &(ctx->ep_r));
-	if (bn_sign(&ctx->ep_v1[0]) == BN_NEG) {
-		bn_add_dig(&(ctx->ep_v1[0]), &(ctx->ep_v1[0]), 1);
+	bn_dbl(&(ctx->ep->r), &(ctx->ep->r));
+	bn_div(&(ctx->ep->v1[0]), &(ctx->ep->v1[0]), &(ctx->ep->r));
+	if (bn_sign(&ctx->ep->v1[0]) == BN_NEG) {
+		bn_add_dig(&(ctx->ep->v1[0]), &(ctx->ep->v1[0]), 1);
 	}
 	/* v2[0] = round(v1[2] * 2^|n| / l). */
-	bn_lsh(&(ctx->ep_v2[0]), &(ctx->ep_v1[2]), bits + 1);
-	if (bn_sign(&(ctx->ep_v2[0])) == BN_POS) {
-		bn_add(&(ctx->ep_v2[0]), &(ctx->ep_v2[0]), &(ctx->ep_r));
+	bn_lsh(&(ctx->ep->v2[0]), &(ctx->ep->v1[2]), bits + 1);
+	if (bn_sign(&(ctx->ep->v2[0])) == BN_POS) {
+		bn_add(&(ctx->ep->v2[0]), &(ctx->ep->v2[0]), &(ctx->ep->r));
 	} else {
-		bn_sub(&(ctx->ep_v2[0]), &(ctx->ep_v2[0]), &(ctx->ep_r));
+		bn_sub(&(ctx->ep->v2[0]), &(ctx->ep->v2[0]), &(ctx->ep->r));
 	}
-	bn_div(&(ctx->ep_v2[0]), &(ctx->ep_v2[0]), &(ctx->ep_r));
-	if (bn_sign(&ctx->ep_v2[0]) == BN_NEG) {
-		bn_add_dig(&(ctx->ep_v2[0]), &(ctx->ep_v2[0]), 1);
+	bn_div(&(ctx->ep->v2[0]), &(ctx->ep->v2[0]), &(ctx->ep->r));
+	if (bn_sign(&ctx->ep->v2[0]) == BN_NEG) {
+		bn_add_dig(&(ctx->ep->v2[0]), &(ctx->ep->v2[0]), 1);
 	}
-	bn_neg(&(ctx->ep_v2[0]), &(ctx->ep_v2[0]));
+	bn_neg(&(ctx->ep->v2[0]), &(ctx->ep->v2[0]));
 #endif
 
-	ep_norm(&(ctx->ep_g), g);
-	bn_copy(&(ctx->ep_r), r);
-	bn_copy(&(ctx->ep_h), h);
+	ep_norm(&(ctx->ep->g), g);
+	bn_copy(&(ctx->ep->r), r);
+	bn_copy(&(ctx->ep->h), h);
 
 #if defined(EP_PRECO)
-	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep_g));
+	ep_mul_pre((ep_t *)ep_curve_get_tab(), &(ctx->ep->g));
 #endif
 }
 
@@ -32,11 +32,285 @@
 #include "relic_core.h"
 #include "relic_md.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Hashes a byte array to a prime field element.
+ *
+ * @param[out] t			- the result.
+ * @param[in] msg			- the byte array to map.
+ * @param[in] len			- the array length in bytes.
+ */
+static void ep_map_hash(fp_t t, const uint8_t *msg, int len) {
+	bn_t k;
+	uint8_t digest[MD_LEN];
+
+	bn_null(k);
+
+	TRY {
+		bn_new(k);
+
+		md_map(digest, msg, len);
+		bn_read_bin(k, digest, MIN(FP_BYTES, MD_LEN));
+		fp_prime_conv(t, k);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(k);
+	}
+}
+
+/**
+ * Multiplies a point by the cofactor of the prime elliptic curve.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ */
+static void ep_map_cof(ep_t r, ep_t p) {
+	bn_t k;
+
+	bn_null(k);
+
+	TRY {
+		bn_new(k);
+
+		ep_curve_get_cof(k);
+		if (bn_cmp_dig(k, 1) == CMP_EQ) {
+			ep_norm(r, p);
+		} else if (bn_bits(k) < BN_DIGIT) {
+			ep_mul_dig(r, p, k->dp[0]);
+		} else {
+			ep_mul(r, p, k);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(k);
+	}
+}
+
+/**
+ * Maps a prime field element to a point in a curve y^2 = x^3 + b using the
+ * Shallue-van de Woestijne encoding as specialized by Fouque and Tibouchi. The
+ * three candidate abscissae are always computed and the point is selected
+ * without branching on secret data.
+ *
+ * @param[out] p			- the result.
+ * @param[in] t				- the prime field element to map.
+ */
+static void ep_map_svdw(ep_t p, fp_t t) {
+	fp_t s, b, x[3], y[3], u[3], v[3];
+	int i, r[3];
+
+	fp_null(s);
+	fp_null(b);
+	for (i = 0; i < 3; i++) {
+		fp_null(x[i]);
+		fp_null(y[i]);
+		fp_null(u[i]);
+		fp_null(v[i]);
+	}
+
+	TRY {
+		fp_new(s);
+		fp_new(b);
+		for (i = 0; i < 3; i++) {
+			fp_new(x[i]);
+			fp_new(y[i]);
+			fp_new(u[i]);
+			fp_new(v[i]);
+		}
+
+		/* Compute b = (-1 + s)/2 from the cached s = sqrt(-3), a primitive
+		 * cube root of unity. */
+		fp_copy(s, ep_curve_get_map());
+		fp_sub_dig(b, s, 1);
+		fp_hlv(b, b);
+
+		/* Exceptional inputs happen with negligible probability and are
+		 * replaced by the next field element. */
+		while (1) {
+			fp_sqr(u[0], t);
+			fp_add(u[0], u[0], ep_curve_get_b());
+			fp_add_dig(u[0], u[0], 1);
+			if (!fp_is_zero(t) && !fp_is_zero(u[0])) {
+				break;
+			}
+			fp_add_dig(t, t, 1);
+		}
+
+		/* Compute 1/(1 + B + t^2), 1/t and 1/s with a single inversion. */
+		fp_copy(u[1], t);
+		fp_copy(u[2], s);
+		fp_inv_sim(v, (const fp_t *)u, 3);
+
+		/* w = s * t/(1 + B + t^2), stored in y[0]. */
+		fp_mul(y[0], s, t);
+		fp_mul(y[0], y[0], v[0]);
+		/* x1 = (-1 + s)/2 - t * w. */
+		fp_mul(x[0], t, y[0]);
+		fp_sub(x[0], b, x[0]);
+		/* x2 = -1 - x1. */
+		fp_neg(x[1], x[0]);
+		fp_sub_dig(x[1], x[1], 1);
+		/* x3 = 1 + 1/w^2 = 1 + ((1 + B + t^2)/(s * t))^2. */
+		fp_mul(x[2], u[0], v[1]);
+		fp_mul(x[2], x[2], v[2]);
+		fp_sqr(x[2], x[2]);
+		fp_add_dig(x[2], x[2], 1);
+
+		for (i = 0; i < 3; i++) {
+			fp_sqr(u[i], x[i]);
+			fp_mul(u[i], u[i], x[i]);
+			fp_add(u[i], u[i], ep_curve_get_b());
+			r[i] = fp_srt(y[i], u[i]);
+		}
+
+		/* Select the first candidate with a square right-hand side. */
+		dv_swap_cond(x[2], x[1], FP_DIGS, r[1]);
+		dv_swap_cond(y[2], y[1], FP_DIGS, r[1]);
+		dv_swap_cond(x[2], x[0], FP_DIGS, r[0]);
+		dv_swap_cond(y[2], y[0], FP_DIGS, r[0]);
+
+		/* Give the point the parity of t, so that t and -t map to P and -P. */
+		fp_neg(y[0], y[2]);
+		dv_swap_cond(y[2], y[0], FP_DIGS, fp_is_even(t) ^ fp_is_even(y[2]));
+
+		fp_copy(p->x, x[2]);
+		fp_copy(p->y, y[2]);
+		fp_set_dig(p->z, 1);
+		p->norm = 1;
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(s);
+		fp_free(b);
+		for (i = 0; i < 3; i++) {
+			fp_free(x[i]);
+			fp_free(y[i]);
+			fp_free(u[i]);
+			fp_free(v[i]);
+		}
+	}
+}
+
+/**
+ * Maps a prime field element to a point in a curve y^2 = x^3 + ax + b with
+ * ab != 0 using the simplified Shallue-van de Woestijne-Ulas encoding. Both
+ * candidate abscissae are always computed and the point is selected without
+ * branching on secret data.
+ *
+ * @param[out] p			- the result.
+ * @param[in] t				- the prime field element to map.
+ */
+static void ep_map_sswu(ep_t p, fp_t t) {
+	fp_t z, x[2], y[2], u[2], v[2];
+	int i, r[2];
+
+	fp_null(z);
+	for (i = 0; i < 2; i++) {
+		fp_null(x[i]);
+		fp_null(y[i]);
+		fp_null(u[i]);
+		fp_null(v[i]);
+	}
+
+	TRY {
+		fp_new(z);
+		for (i = 0; i < 2; i++) {
+			fp_new(x[i]);
+			fp_new(y[i]);
+			fp_new(u[i]);
+			fp_new(v[i]);
+		}
+
+		/* The constant Z is chosen when the curve is configured. */
+		fp_copy(z, ep_curve_get_map());
+
+		/* Exceptional inputs happen with negligible probability and are
+		 * replaced by the next field element. */
+		while (1) {
+			fp_sqr(x[1], t);
+			fp_mul(x[1], x[1], z);
+			fp_sqr(u[1], x[1]);
+			fp_add(u[1], u[1], x[1]);
+			if (!fp_is_zero(u[1])) {
+				break;
+			}
+			fp_add_dig(t, t, 1);
+		}
+
+		/* Compute 1/A and 1/(Z^2 * t^4 + Z * t^2) with a single inversion. */
+		fp_copy(u[0], ep_curve_get_a());
+		fp_inv_sim(v, (const fp_t *)u, 2);
+
+		/* x1 = -B/A * (1 + 1/(Z^2 * t^4 + Z * t^2)). */
+		fp_add_dig(x[0], v[1], 1);
+		fp_mul(x[0], x[0], v[0]);
+		fp_mul(x[0], x[0], ep_curve_get_b());
+		fp_neg(x[0], x[0]);
+		/* x2 = Z * t^2 * x1. */
+		fp_mul(x[1], x[1], x[0]);
+
+		for (i = 0; i < 2; i++) {
+			fp_sqr(u[i], x[i]);
+			fp_add(u[i], u[i], ep_curve_get_a());
+			fp_mul(u[i], u[i], x[i]);
+			fp_add(u[i], u[i], ep_curve_get_b());
+			r[i] = fp_srt(y[i], u[i]);
+		}
+
+		/* Select x1 if its right-hand side is a square, x2 otherwise. */
+		dv_swap_cond(x[1], x[0], FP_DIGS, r[0]);
+		dv_swap_cond(y[1], y[0], FP_DIGS, r[0]);
+
+		/* Give the point the parity of t, so that t and -t map to P and -P. */
+		fp_neg(y[0], y[1]);
+		dv_swap_cond(y[1], y[0], FP_DIGS, fp_is_even(t) ^ fp_is_even(y[1]));
+
+		fp_copy(p->x, x[1]);
+		fp_copy(p->y, y[1]);
+		fp_set_dig(p->z, 1);
+		p->norm = 1;
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(z);
+		for (i = 0; i < 2; i++) {
+			fp_free(x[i]);
+			fp_free(y[i]);
+			fp_free(u[i]);
+			fp_free(v[i]);
+		}
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
 void ep_map(ep_t p, const uint8_t *msg, int len) {
+#if EP_MAP == SWU
+	/* The curve has no constant for the encodings if it cannot use them. */
+	if (!fp_is_zero(ep_curve_get_map())) {
+		ep_map_swu(p, msg, len);
+		return;
+	}
+#endif
+	ep_map_basic(p, msg, len);
+}
+
+void ep_map_basic(ep_t p, const uint8_t *msg, int len) {
 	bn_t k;
 	fp_t t;
 	uint8_t digest[MD_LEN];
@@ -66,18 +340,43 @@ void ep_map(ep_t p, const uint8_t *msg, int len) {
 		}
 
 		/* Now, multiply by cofactor to get the correct group. */
-		ep_curve_get_cof(k);
-		if (bn_bits(k) < BN_DIGIT) {
-			ep_mul_dig(p, p, k->dp[0]);
+		ep_map_cof(p, p);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(k);
+		fp_free(t);
+	}
+}
+
+void ep_map_swu(ep_t p, const uint8_t *msg, int len) {
+	fp_t t;
+
+	fp_null(t);
+
+	TRY {
+		fp_new(t);
+
+		if (fp_is_zero(ep_curve_get_map())) {
+			THROW(ERR_NO_VALID);
+		}
+
+		ep_map_hash(t, msg, len);
+		if (ep_curve_opt_a() == OPT_ZERO) {
+			ep_map_svdw(p, t);
 		} else {
-			ep_mul(p, p, k);
+			ep_map_sswu(p, t);
 		}
+
+		/* Now, multiply by cofactor to get the correct group. */
+		ep_map_cof(p, p);
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
 	}
 	FINALLY {
-		bn_free(k);
 		fp_free(t);
 	}
 }
@@ -357,6 +357,223 @@ static void ep_mul_sim_plain(ep_t r, const ep_t p, const bn_t k, const ep_t q,
 
 #endif /* EP_SIM == INTER */
 
+/**
+ * Multiplies and adds many prime elliptic curve points simultaneously by
+ * interleaving their width-w NAFs. The points must be in affine coordinates
+ * and the integers must be positive.
+ *
+ * @param[out] r 				- the result.
+ * @param[in] p					- the points to multiply.
+ * @param[in] k					- the integers.
+ * @param[in] n					- the number of points.
+ */
+static void ep_mul_lot_inter(ep_t r, ep_t *p, bn_t *k, int n) {
+	int i, j, d, len, w = 1 << (EP_WIDTH - 2), *l;
+	int8_t *naf;
+	ep_t *t;
+
+	/* The tables and recodings grow with n, so keep them off the stack. */
+	l = (int *)malloc(n * sizeof(int));
+	naf = (int8_t *)malloc(n * (FP_BITS + 1));
+	t = (ep_t *)malloc(n * w * sizeof(ep_t));
+	if (l == NULL || naf == NULL || t == NULL) {
+		free(l);
+		free(naf);
+		free(t);
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	for (i = 0; i < n * w; i++) {
+		ep_null(t[i]);
+	}
+
+	TRY {
+		len = 0;
+		for (i = 0; i < n; i++) {
+			for (j = 0; j < w; j++) {
+				ep_new(t[i * w + j]);
+			}
+			ep_tab(t + i * w, p[i], EP_WIDTH);
+			l[i] = FP_BITS + 1;
+			bn_rec_naf(naf + i * (FP_BITS + 1), &l[i], k[i], EP_WIDTH);
+			len = MAX(len, l[i]);
+		}
+		/* Normalize all tables at once to use mixed additions. */
+		ep_norm_bat(t, (const ep_t *)t, n * w, NULL);
+		for (i = 0; i < n; i++) {
+			for (j = l[i]; j < len; j++) {
+				naf[i * (FP_BITS + 1) + j] = 0;
+			}
+		}
+
+		ep_set_infty(r);
+		for (j = len - 1; j >= 0; j--) {
+			ep_dbl(r, r);
+			for (i = 0; i < n; i++) {
+				d = naf[i * (FP_BITS + 1) + j];
+				if (d > 0) {
+					ep_add(r, r, t[i * w + d / 2]);
+				}
+				if (d < 0) {
+					ep_sub(r, r, t[i * w - d / 2]);
+				}
+			}
+		}
+		ep_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; i < n * w; i++) {
+			ep_free(t[i]);
+		}
+		free(l);
+		free(naf);
+		free(t);
+	}
+}
+
+/**
+ * Arguments of the windows computed by Pippenger's bucket method.
+ */
+typedef struct {
+	/** The sum of the points in each window. */
+	ep_t *w;
+	/** The points to multiply. */
+	ep_t *p;
+	/** The integers. */
+	bn_t *k;
+	/** The number of points. */
+	int n;
+	/** The window width. */
+	int c;
+} ep_lot_t;
+
+/**
+ * Computes the sum of the points weighted by the value of their integers in a
+ * single window, accumulating each point in the bucket of its window value.
+ *
+ * @param[in,out] args			- the arguments of the bucket method.
+ * @param[in] j					- the window index.
+ */
+static void ep_mul_lot_window(void *args, int j) {
+	ep_lot_t *lot = (ep_lot_t *)args;
+	int i, b, d, c = lot->c;
+	ep_t s, *t;
+
+	/* Worker threads have small stacks, so the buckets live on the heap. */
+	t = (ep_t *)malloc(((1 << c) - 1) * sizeof(ep_t));
+	if (t == NULL) {
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	ep_null(s);
+	for (i = 0; i < (1 << c) - 1; i++) {
+		ep_null(t[i]);
+	}
+
+	TRY {
+		ep_new(s);
+		for (i = 0; i < (1 << c) - 1; i++) {
+			ep_new(t[i]);
+			ep_set_infty(t[i]);
+		}
+
+		for (i = 0; i < lot->n; i++) {
+			d = 0;
+			for (b = c - 1; b >= 0; b--) {
+				d = (d << 1) | bn_get_bit(lot->k[i], j * c + b);
+			}
+			if (d > 0) {
+				ep_add(t[d - 1], t[d - 1], lot->p[i]);
+			}
+		}
+
+		/* Compute \sum d * t[d - 1] with a running sum. */
+		ep_set_infty(s);
+		ep_set_infty(lot->w[j]);
+		for (i = (1 << c) - 2; i >= 0; i--) {
+			ep_add(s, s, t[i]);
+			ep_add(lot->w[j], lot->w[j], s);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		ep_free(s);
+		for (i = 0; i < (1 << c) - 1; i++) {
+			ep_free(t[i]);
+		}
+		free(t);
+	}
+}
+
+/**
+ * Multiplies and adds many prime elliptic curve points simultaneously using
+ * Pippenger's bucket method. The points must be in affine coordinates and the
+ * integers must be positive. The windows are independent and are computed in
+ * parallel when multithreading is enabled.
+ *
+ * @param[out] r 				- the result.
+ * @param[in] p					- the points to multiply.
+ * @param[in] k					- the integers.
+ * @param[in] n					- the number of points.
+ */
+static void ep_mul_lot_bucket(ep_t r, ep_t *p, bn_t *k, int n) {
+	int i, j, c, m, len;
+	ep_lot_t lot;
+
+	/* Windows of about lg(n) bits balance bucket filling and summation. */
+	c = util_bits_dig(n) - 2;
+	c = MIN(MAX(c, 2), 12);
+
+	len = 0;
+	for (i = 0; i < n; i++) {
+		len = MAX(len, bn_bits(k[i]));
+	}
+	m = MAX(CEIL(len, c), 1);
+
+	ep_t w[m];
+
+	for (j = 0; j < m; j++) {
+		ep_null(w[j]);
+	}
+
+	TRY {
+		for (j = 0; j < m; j++) {
+			ep_new(w[j]);
+		}
+
+		lot.w = w;
+		lot.p = p;
+		lot.k = k;
+		lot.n = n;
+		lot.c = c;
+		core_par(ep_mul_lot_window, &lot, m);
+
+		ep_set_infty(r);
+		for (j = m - 1; j >= 0; j--) {
+			for (i = 0; i < c; i++) {
+				ep_dbl(r, r);
+			}
+			ep_add(r, r, w[j]);
+		}
+		ep_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (j = 0; j < m; j++) {
+			ep_free(w[j]);
+		}
+	}
+}
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -600,3 +817,84 @@ void ep_mul_sim_gen(ep_t r, const bn_t k, const ep_t q, const bn_t m) {
 		ep_free(g);
 	}
 }
+
+void ep_mul_sim_lot(ep_t r, const ep_t *p, const bn_t *k, int n) {
+	int i, j;
+	bn_t ord, *_k;
+	ep_t *_p;
+
+	if (n <= 0) {
+		ep_set_infty(r);
+		return;
+	}
+
+	/* Copy the inputs to the heap, since there may be thousands of them. */
+	_p = (ep_t *)malloc(n * sizeof(ep_t));
+	_k = (bn_t *)malloc(n * sizeof(bn_t));
+	if (_p == NULL || _k == NULL) {
+		free(_p);
+		free(_k);
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+
+	bn_null(ord);
+	for (i = 0; i < n; i++) {
+		ep_null(_p[i]);
+		bn_null(_k[i]);
+	}
+
+	TRY {
+		bn_new(ord);
+		for (i = 0; i < n; i++) {
+			ep_new(_p[i]);
+			bn_new(_k[i]);
+		}
+
+		/* Reduce the integers so that their recodings fit, drop trivial terms
+		 * and move the signs of the integers to the points. */
+		ep_curve_get_ord(ord);
+		j = 0;
+		for (i = 0; i < n; i++) {
+			if (ep_is_infty(p[i])) {
+				continue;
+			}
+			bn_abs(_k[j], k[i]);
+			if (bn_cmp(_k[j], ord) != CMP_LT) {
+				bn_mod(_k[j], _k[j], ord);
+			}
+			if (bn_is_zero(_k[j])) {
+				continue;
+			}
+			if (bn_sign(k[i]) == BN_NEG) {
+				ep_neg(_p[j], p[i]);
+			} else {
+				ep_copy(_p[j], p[i]);
+			}
+			j++;
+		}
+
+		if (j == 0) {
+			ep_set_infty(r);
+		} else {
+			ep_norm_bat(_p, (const ep_t *)_p, j, NULL);
+			if (j < EP_LOT_BUCKET) {
+				ep_mul_lot_inter(r, _p, _k, j);
+			} else {
+				ep_mul_lot_bucket(r, _p, _k, j);
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(ord);
+		for (i = 0; i < n; i++) {
+			ep_free(_p[i]);
+			bn_free(_k[i]);
+		}
+		free(_p);
+		free(_k);
+	}
+}
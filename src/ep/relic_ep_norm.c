@@ -135,3 +135,73 @@ void ep_norm_sim(ep_t *r, const ep_t *t, int n) {
 		}
 	}
 }
+
+void ep_norm_bat(ep_t *r, const ep_t *p, int n, dig_t *s) {
+	int i;
+	dig_t *buf = s;
+	fp_t u, t;
+
+	if (n <= 0) {
+		return;
+	}
+
+	if (buf == NULL) {
+		buf = (dig_t *)malloc(EP_BATCH(n) * sizeof(dig_t));
+		if (buf == NULL) {
+			THROW(ERR_NO_MEMORY);
+			return;
+		}
+	}
+
+	fp_null(u);
+	fp_null(t);
+
+	TRY {
+		fp_new(u);
+		fp_new(t);
+
+		/* Store the running products of the coordinates to invert. */
+		fp_set_dig(u, 1);
+		for (i = 0; i < n; i++) {
+			if (!p[i]->norm && !ep_is_infty(p[i])) {
+				fp_mul(u, u, p[i]->z);
+			}
+			fp_copy(buf + i * FP_DIGS, u);
+		}
+
+		fp_inv(u, u);
+
+		/* Peel one inverse at a time off the inverse of the full product. */
+		for (i = n - 1; i >= 0; i--) {
+			if (ep_is_infty(p[i])) {
+				ep_set_infty(r[i]);
+			} else if (p[i]->norm) {
+				ep_copy(r[i], p[i]);
+			} else {
+				if (i > 0) {
+					fp_mul(t, u, buf + (i - 1) * FP_DIGS);
+				} else {
+					fp_copy(t, u);
+				}
+				fp_mul(u, u, p[i]->z);
+#if EP_ADD == PROJC || !defined(STRIP)
+				fp_copy(r[i]->x, p[i]->x);
+				fp_copy(r[i]->y, p[i]->y);
+				fp_copy(r[i]->z, t);
+				r[i]->norm = 0;
+				ep_norm_imp(r[i], r[i], 1);
+#endif
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(u);
+		fp_free(t);
+		if (s == NULL) {
+			free(buf);
+		}
+	}
+}
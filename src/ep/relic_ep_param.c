@@ -28,6 +28,9 @@
  * @ingroup ep
  */
 
+#include <stdint.h>
+#include <stdlib.h>
+
 #include "relic_core.h"
 #include "relic_epx.h"
 
@@ -35,6 +38,53 @@
 /* Private definitions                                                        */
 /*============================================================================*/
 
+/**
+ * Maximum number of prime elliptic curves that can be shared among threads.
+ */
+#define EP_SHARED		8
+
+/**
+ * Size in bytes of a cache line, to which shared parameters are aligned.
+ */
+#define EP_LINE			64
+
+/**
+ * Rounds a pointer up to the next cache line boundary.
+ *
+ * @param[in] P			- the pointer to align.
+ */
+#define EP_ALIGNED(P)	((uint8_t *)(((uintptr_t)(P) + EP_LINE - 1) & ~(uintptr_t)(EP_LINE - 1)))
+
+/**
+ * Prime elliptic curve parameters shared read-only by all threads.
+ */
+typedef struct {
+	/** The parameter identifier. */
+	int param;
+	/** The number of contexts referencing these parameters. */
+	int refs;
+	/** The memory block holding the parameters. */
+	void *mem;
+	/** The prime field over which the curve is defined. */
+	fp_field_t field;
+	/** The prime elliptic curve. */
+	ep_curve_t curve;
+} ep_shared_t;
+
+#if ALLOC != STATIC
+/**
+ * Table of shared prime elliptic curves.
+ */
+static ep_shared_t shared[EP_SHARED];
+
+#if MULTI == PTHREAD
+/**
+ * Lock protecting the table of shared prime elliptic curves.
+ */
+static pthread_mutex_t shared_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+#endif
+
 #if defined(EP_PLAIN) && FP_PRIME == 160
 /**
  * Parameters for the SECG P-160 prime elliptic curve.
@@ -463,7 +513,7 @@
 /*============================================================================*/
 
 int ep_param_get() {
-	return core_get()->ep_id;
+	return core_get()->ep->id;
 }
 
 void ep_param_set(int param) {
@@ -472,6 +522,12 @@ void ep_param_set(int param) {
 	fp_t a, b, beta;
 	ep_t g;
 	bn_t r, h, lamb;
+	ctx_t *ctx = core_get();
+
+	/* A shared curve is read-only, so reconfigure the default one instead. */
+	if (ctx->ep_shared != NULL && ctx->ep == ctx->ep_shared) {
+		ep_param_release();
+	}
 
 	fp_null(a);
 	fp_null(b);
@@ -490,7 +546,7 @@ void ep_param_set(int param) {
 		bn_new(r);
 		bn_new(h);
 
-		core_get()->ep_id = 0;
+		core_get()->ep->id = 0;
 
 		switch (param) {
 #if defined(EP_ENDOM) && FP_PRIME == 158
@@ -661,21 +717,21 @@ void ep_param_set(int param) {
 #if defined(EP_PLAIN)
 		if (plain) {
 			ep_curve_set_plain(a, b, g, r, h);
-			core_get()->ep_id = param;
+			core_get()->ep->id = param;
 		}
 #endif
 
 #if defined(EP_ENDOM)
 		if (endom) {
 			ep_curve_set_endom(b, g, r, h, beta, lamb);
-			core_get()->ep_id = param;
+			core_get()->ep->id = param;
 		}
 #endif
 
 #if defined(EP_SUPER)
 		if (super) {
 			ep_curve_set_super(a, b, g, r, h);
-			core_get()->ep_id = param;
+			core_get()->ep->id = param;
 		}
 #endif
 	}
@@ -693,6 +749,133 @@ void ep_param_set(int param) {
 	}
 }
 
+void ep_param_set_shared(int param) {
+#if ALLOC == STATIC
+	/* Pool memory belongs to a single context, so nothing can be shared. */
+	ep_param_set(param);
+#else
+	ctx_t *ctx = core_get();
+	ep_shared_t *s = NULL;
+	int i;
+
+	ep_param_release();
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&shared_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (ep_shared)
+#endif
+	{
+		for (i = 0; i < EP_SHARED && s == NULL; i++) {
+			if (shared[i].refs > 0 && shared[i].param == param) {
+				s = &shared[i];
+			}
+		}
+		for (i = 0; i < EP_SHARED && s == NULL; i++) {
+			if (shared[i].refs > 0) {
+				continue;
+			}
+			shared[i].mem = malloc(sizeof(fp_field_st) + sizeof(ep_curve_st) +
+					2 * EP_LINE);
+			if (shared[i].mem == NULL) {
+				break;
+			}
+			shared[i].field = (fp_field_t)EP_ALIGNED(shared[i].mem);
+			shared[i].curve = (ep_curve_t)EP_ALIGNED(shared[i].field + 1);
+
+			/* The first thread builds the parameters in place. */
+			fp_field_set(shared[i].field);
+			fp_prime_init();
+			ep_curve_set(shared[i].curve);
+			ep_curve_init();
+			TRY {
+				ep_param_set(param);
+			}
+			CATCH_ANY {
+				ep_curve_get()->id = 0;
+			}
+
+			if (ep_param_get() == param) {
+				shared[i].param = param;
+				s = &shared[i];
+			} else {
+				ep_curve_clean();
+				fp_prime_clean();
+				free(shared[i].mem);
+				shared[i].mem = NULL;
+			}
+			ep_curve_set(NULL);
+			fp_field_set(NULL);
+			break;
+		}
+		if (s != NULL) {
+			s->refs++;
+		}
+	}
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&shared_lock);
+#endif
+
+	if (s == NULL) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	fp_field_set(s->field);
+	ep_curve_set(s->curve);
+	ctx->ep_shared = s->curve;
+#endif
+}
+
+void ep_param_release(void) {
+#if ALLOC != STATIC
+	ctx_t *ctx = core_get();
+	fp_field_t field = ctx->fp;
+	ep_curve_t curve = ctx->ep;
+	int i;
+
+	if (ctx->ep_shared == NULL) {
+		return;
+	}
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&shared_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (ep_shared)
+#endif
+	{
+		for (i = 0; i < EP_SHARED; i++) {
+			if (shared[i].refs == 0 || shared[i].curve != ctx->ep_shared) {
+				continue;
+			}
+			if (field == shared[i].field) {
+				field = NULL;
+			}
+			if (curve == shared[i].curve) {
+				curve = NULL;
+			}
+			if (--shared[i].refs == 0) {
+				/* The last reference cleans the parameters up. */
+				fp_field_set(shared[i].field);
+				ep_curve_set(shared[i].curve);
+				ep_curve_clean();
+				fp_prime_clean();
+				free(shared[i].mem);
+				shared[i].mem = NULL;
+			}
+			break;
+		}
+	}
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&shared_lock);
+#endif
+
+	fp_field_set(field);
+	ep_curve_set(curve);
+	ctx->ep_shared = NULL;
+#endif
+}
+
 int ep_param_set_any() {
 	int r0, r1, r2;
 
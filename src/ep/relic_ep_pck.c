@@ -78,3 +78,12 @@ int ep_upk(ep_t r, const ep_t p) {
 	}
 	return result;
 }
+
+int ep_upk_bat(ep_t *r, const ep_t *p, int n) {
+	int i, result = 1;
+
+	for (i = 0; i < n; i++) {
+		result &= ep_upk(r[i], p[i]);
+	}
+	return result;
+}
@@ -174,6 +174,51 @@ int ep_is_valid(const ep_t p) {
 	return r;
 }
 
+int ep_is_valid_bat(const ep_t *p, int n) {
+	fp_t t0, t1, t2;
+	int i, r = 1;
+
+	fp_null(t0);
+	fp_null(t1);
+	fp_null(t2);
+
+	TRY {
+		fp_new(t0);
+		fp_new(t1);
+		fp_new(t2);
+
+		/* Check Y^2 = X^3 + a * X * Z^4 + b * Z^6 without inverting Z. */
+		for (i = 0; i < n; i++) {
+			if (ep_is_infty(p[i])) {
+				continue;
+			}
+			/* t0 = Z^2, t1 = Z^4. */
+			fp_sqr(t0, p[i]->z);
+			fp_sqr(t1, t0);
+			/* t1 = a * Z^4 + X^2. */
+			fp_mul(t1, t1, ep_curve_get_a());
+			fp_sqr(t2, p[i]->x);
+			fp_add(t1, t1, t2);
+			/* t1 = X^3 + a * X * Z^4. */
+			fp_mul(t1, t1, p[i]->x);
+			/* t0 = b * Z^6. */
+			fp_sqr(t2, t0);
+			fp_mul(t0, t0, t2);
+			fp_mul(t0, t0, ep_curve_get_b());
+			fp_add(t1, t1, t0);
+			fp_sqr(t0, p[i]->y);
+			r &= (fp_cmp(t0, t1) == CMP_EQ);
+		}
+	} CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	} FINALLY {
+		fp_free(t0);
+		fp_free(t1);
+		fp_free(t2);
+	}
+	return r;
+}
+
 void ep_tab(ep_t *t, const ep_t p, int w) {
 	if (w > 2) {
 		ep_dbl(t[0], p);
@@ -59,8 +59,8 @@ void ep2_mul_cof_bn(ep2_t r, ep2_t p) {
 
 		fp_param_get_var(x);
 
-		/* Compute t0 = xP. */
-		ep2_mul(t0, p, x);
+		/* Compute t0 = xP, with a point that may lie outside G_2. */
+		ep2_mul_basic(t0, p, x);
 		if (bn_sign(x) == BN_NEG) {
 			ep2_neg(t0, t0);
 		}
@@ -117,13 +117,13 @@ void ep2_mul_cof_b12(ep2_t r, ep2_t p) {
 
 		fp_param_get_var(x);
 
-		/* Compute t0 = xP. */
-		ep2_mul(t0, p, x);
+		/* Compute t0 = xP, with a point that may lie outside G_2. */
+		ep2_mul_basic(t0, p, x);
 		if (bn_sign(x) == BN_NEG) {
 			ep2_neg(t0, t0);
 		}
 		/* Compute t1 = [x^2]P. */
-		ep2_mul(t1, t0, x);
+		ep2_mul_basic(t1, t0, x);
 		if (bn_sign(x) == BN_NEG) {
 			ep2_neg(t1, t1);
 		}
@@ -206,7 +206,7 @@ void ep2_map(ep2_t p, uint8_t *msg, int len) {
 				if (bn_bits(x) < BN_DIGIT) {
 					ep2_mul_dig(p, p, x->dp[0]);
 				} else {
-					ep2_mul(p, p, x);
+					ep2_mul_basic(p, p, x);
 				}
 				break;
 		}
@@ -31,25 +31,192 @@
 
 #include "relic_core.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if EP2_MUL == LWNAF || !defined(STRIP)
+
+/**
+ * Multiplies a point in the r-torsion subgroup of a BN twist by an integer
+ * using the endomorphism psi(P) = pP, a 4-dimensional decomposition of the
+ * integer and interleaving of width-w NAFs.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] k				- the integer.
+ */
+static void ep2_mul_glv_imp(ep2_t r, ep2_t p, bn_t k) {
+	int i, j, l, _l[4];
+	int8_t naf[4][FP_BITS + 1];
+	bn_t n, u, _k[4];
+	ep2_t q, t[4][1 << (EP_WIDTH - 2)];
+
+	bn_null(n);
+	bn_null(u);
+	ep2_null(q);
+
+	TRY {
+		bn_new(n);
+		bn_new(u);
+		ep2_new(q);
+		for (i = 0; i < 4; i++) {
+			bn_null(_k[i]);
+			bn_new(_k[i]);
+			for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+				ep2_null(t[i][j]);
+				ep2_new(t[i][j]);
+			}
+		}
+
+		ep2_curve_get_ord(n);
+		fp_param_get_var(u);
+		bn_abs(_k[0], k);
+		bn_mod(_k[0], _k[0], n);
+		bn_rec_frb(_k, _k[0], u, n);
+
+		/* Tables for psi^i(P) follow from the table for P, which is affine. */
+		ep2_norm(q, p);
+		ep2_tab(t[0], q, EP_WIDTH);
+		for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+			ep2_norm(t[0][j], t[0][j]);
+		}
+		for (i = 1; i < 4; i++) {
+			for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+				ep2_frb(t[i][j], t[i - 1][j], 1);
+			}
+		}
+		for (i = 0; i < 4; i++) {
+			if (bn_sign(_k[i]) == BN_NEG) {
+				bn_neg(_k[i], _k[i]);
+				for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+					ep2_neg(t[i][j], t[i][j]);
+				}
+			}
+		}
+
+		l = 0;
+		for (i = 0; i < 4; i++) {
+			_l[i] = FP_BITS + 1;
+			bn_rec_naf(naf[i], &_l[i], _k[i], EP_WIDTH);
+			l = MAX(l, _l[i]);
+		}
+		for (i = 0; i < 4; i++) {
+			for (j = _l[i]; j < l; j++) {
+				naf[i][j] = 0;
+			}
+		}
+
+		ep2_set_infty(q);
+		for (j = l - 1; j >= 0; j--) {
+			ep2_dbl(q, q);
+			for (i = 0; i < 4; i++) {
+				if (naf[i][j] > 0) {
+					ep2_add(q, q, t[i][naf[i][j] / 2]);
+				}
+				if (naf[i][j] < 0) {
+					ep2_sub(q, q, t[i][-naf[i][j] / 2]);
+				}
+			}
+		}
+		/* Convert r to affine coordinates. */
+		ep2_norm(r, q);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+		bn_free(u);
+		ep2_free(q);
+		for (i = 0; i < 4; i++) {
+			bn_free(_k[i]);
+			for (j = 0; j < (1 << (EP_WIDTH - 2)); j++) {
+				ep2_free(t[i][j]);
+			}
+		}
+	}
+}
+
+/**
+ * Multiplies a point in an elliptic curve over a quadratic extension by an
+ * integer using the left-to-right width-w NAF method.
+ *
+ * @param[out] r			- the result.
+ * @param[in] p				- the point to multiply.
+ * @param[in] k				- the integer.
+ */
+static void ep2_mul_naf_imp(ep2_t r, ep2_t p, bn_t k) {
+	int l, i, n;
+	int8_t naf[FP_BITS + 1], *_k;
+	ep2_t t[1 << (EP_WIDTH - 2)];
+
+	for (i = 0; i < (1 << (EP_WIDTH - 2)); i++) {
+		ep2_null(t[i]);
+	}
+
+	TRY {
+		/* Prepare the precomputation table. */
+		for (i = 0; i < (1 << (EP_WIDTH - 2)); i++) {
+			ep2_new(t[i]);
+		}
+		/* Compute the precomputation table. */
+		ep2_tab(t, p, EP_WIDTH);
+
+		/* Compute the w-NAF representation of k. */
+		l = FP_BITS + 1;
+		bn_rec_naf(naf, &l, k, EP_WIDTH);
+
+		_k = naf + l - 1;
+
+		ep2_set_infty(r);
+		for (i = l - 1; i >= 0; i--, _k--) {
+			ep2_dbl(r, r);
+
+			n = *_k;
+			if (n > 0) {
+				ep2_add(r, r, t[n / 2]);
+			}
+			if (n < 0) {
+				ep2_sub(r, r, t[-n / 2]);
+			}
+		}
+		/* Convert r to affine coordinates. */
+		ep2_norm(r, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		/* Free the precomputation table. */
+		for (i = 0; i < (1 << (EP_WIDTH - 2)); i++) {
+			ep2_free(t[i]);
+		}
+	}
+}
+
+#endif /* EP2_MUL == LWNAF */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
-void ep2_mul(ep2_t r, ep2_t p, bn_t k) {
+void ep2_mul_basic(ep2_t r, ep2_t p, bn_t k) {
 	int i, l;
 	ep2_t t;
 
 	ep2_null(t);
+
+	if (bn_is_zero(k)) {
+		ep2_set_infty(r);
+		return;
+	}
+
 	TRY {
 		ep2_new(t);
 		l = bn_bits(k);
 
-		if (bn_get_bit(k, l - 1)) {
-			ep2_copy(t, p);
-		} else {
-			ep2_set_infty(t);
-		}
-
+		ep2_copy(t, p);
 		for (i = l - 2; i >= 0; i--) {
 			ep2_dbl(t, t);
 			if (bn_get_bit(k, i)) {
@@ -57,8 +224,7 @@ void ep2_mul(ep2_t r, ep2_t p, bn_t k) {
 			}
 		}
 
-		ep2_copy(r, t);
-		ep2_norm(r, r);
+		ep2_norm(r, t);
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
@@ -68,6 +234,54 @@ void ep2_mul(ep2_t r, ep2_t p, bn_t k) {
 	}
 }
 
+#if EP2_MUL == LWNAF || !defined(STRIP)
+
+void ep2_mul_lwnaf(ep2_t r, ep2_t p, bn_t k) {
+	bn_t n, _k;
+
+	if (bn_is_zero(k) || ep2_is_infty(p)) {
+		ep2_set_infty(r);
+		return;
+	}
+
+	bn_null(n);
+	bn_null(_k);
+
+	TRY {
+		bn_new(n);
+		bn_new(_k);
+
+		switch (ep_param_get()) {
+			case BN_P158:
+			case BN_P254:
+			case BN_P256:
+			case BN_P638:
+				ep2_mul_glv_imp(r, p, k);
+				break;
+			default:
+				/* The w-NAF of the scalar must fit in FP_BITS + 1 digits. */
+				ep2_curve_get_ord(n);
+				if (bn_bits(k) > bn_bits(n)) {
+					bn_abs(_k, k);
+					bn_mod(_k, _k, n);
+					ep2_mul_naf_imp(r, p, _k);
+				} else {
+					ep2_mul_naf_imp(r, p, k);
+				}
+				break;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+		bn_free(_k);
+	}
+}
+
+#endif
+
 void ep2_mul_gen(ep2_t r, bn_t k) {
 #ifdef EP_PRECO
 	ep2_mul_fix(r, ep2_curve_get_tab(), k);
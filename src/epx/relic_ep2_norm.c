@@ -95,3 +95,97 @@ void ep2_norm(ep2_t r, ep2_t p) {
 	ep2_norm_imp(r, p);
 #endif
 }
+
+void ep2_norm_bat(ep2_t *r, ep2_t *p, int n, dig_t *s) {
+	int i;
+	dig_t *buf = s;
+	fp_t u, t;
+	fp2_t c, v, z;
+
+	if (n <= 0) {
+		return;
+	}
+
+	if (buf == NULL) {
+		buf = (dig_t *)malloc(EPX_BATCH(n) * sizeof(dig_t));
+		if (buf == NULL) {
+			THROW(ERR_NO_MEMORY);
+			return;
+		}
+	}
+
+	fp_null(u);
+	fp_null(t);
+	fp2_null(c);
+	fp2_null(v);
+	fp2_null(z);
+
+	TRY {
+		fp_new(u);
+		fp_new(t);
+		fp2_new(c);
+		fp2_new(v);
+		fp2_new(z);
+
+		/* Store the running products of the norms of the coordinates. */
+		fp_set_dig(u, 1);
+		for (i = 0; i < n; i++) {
+			if (!p[i]->norm && !ep2_is_infty(p[i])) {
+				fp_copy(z[0], p[i]->z[0]);
+				fp_copy(z[1], p[i]->z[1]);
+				fp_copy(c[0], z[0]);
+				fp_neg(c[1], z[1]);
+				fp2_mul(v, z, c);
+				fp_mul(u, u, v[0]);
+			}
+			fp_copy(buf + i * FP_DIGS, u);
+		}
+
+		fp_inv(u, u);
+
+		/* Invert each coordinate as its conjugate over its norm. */
+		for (i = n - 1; i >= 0; i--) {
+			if (ep2_is_infty(p[i])) {
+				ep2_set_infty(r[i]);
+			} else if (p[i]->norm) {
+				ep2_copy(r[i], p[i]);
+			} else {
+				fp_copy(z[0], p[i]->z[0]);
+				fp_copy(z[1], p[i]->z[1]);
+				fp_copy(c[0], z[0]);
+				fp_neg(c[1], z[1]);
+				fp2_mul(v, z, c);
+				if (i > 0) {
+					fp_mul(t, u, buf + (i - 1) * FP_DIGS);
+				} else {
+					fp_copy(t, u);
+				}
+				fp_mul(u, u, v[0]);
+				fp_mul(c[0], c[0], t);
+				fp_mul(c[1], c[1], t);
+
+				/* v = 1/z^2, c = 1/z^3. */
+				fp2_sqr(v, c);
+				fp2_mul(c, c, v);
+				fp2_mul(r[i]->x, p[i]->x, v);
+				fp2_mul(r[i]->y, p[i]->y, c);
+				fp_set_dig(r[i]->z[0], 1);
+				fp_zero(r[i]->z[1]);
+				r[i]->norm = 1;
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(u);
+		fp_free(t);
+		fp2_free(c);
+		fp2_free(v);
+		fp2_free(z);
+		if (s == NULL) {
+			free(buf);
+		}
+	}
+}
@@ -81,3 +81,121 @@ int ep2_upk(ep2_t r, ep2_t p) {
 	}
 	return result;
 }
+
+int ep2_upk_bat(ep2_t *r, ep2_t *p, int n, dig_t *s) {
+	int i, b, result = 1;
+	dig_t *buf = s;
+	fp_t t0, t1, t2;
+	fp2_t t;
+
+	if (n <= 0) {
+		return 1;
+	}
+
+	if (buf == NULL) {
+		buf = (dig_t *)malloc(EPX_BATCH(n) * sizeof(dig_t));
+		if (buf == NULL) {
+			THROW(ERR_NO_MEMORY);
+			return 0;
+		}
+	}
+
+	fp_null(t0);
+	fp_null(t1);
+	fp_null(t2);
+	fp2_null(t);
+
+	TRY {
+		fp_new(t0);
+		fp_new(t1);
+		fp_new(t2);
+		fp2_new(t);
+
+		/* Compute the first half of each square root, keeping the sign bit in
+		 * z_1 and the denominator of the second half in z_0. */
+		fp_set_dig(t0, 1);
+		for (i = 0; i < n; i++) {
+			ep2_rhs(t, p[i]);
+			b = fp_get_bit(p[i]->y[0], 0);
+			fp2_copy(r[i]->x, p[i]->x);
+
+			/* t1 = t_0^2 - u * t_1^2. */
+			fp_sqr(t1, t[0]);
+			fp_sqr(t2, t[1]);
+			for (int j = -1; j > fp_prime_get_qnr(); j--) {
+				fp_add(t1, t1, t2);
+			}
+			for (int j = 0; j <= fp_prime_get_qnr(); j++) {
+				fp_sub(t1, t1, t2);
+			}
+			fp_add(t1, t1, t2);
+
+			if (fp_srt(t2, t1)) {
+				/* t1 = (t_0 + sqrt(t1)) / 2, or (t_0 - sqrt(t1)) / 2. */
+				fp_add(t1, t[0], t2);
+				fp_hlv(t1, t1);
+				if (!fp_srt(r[i]->y[0], t1)) {
+					fp_sub(t1, t[0], t2);
+					fp_hlv(t1, t1);
+					fp_srt(r[i]->y[0], t1);
+				}
+				fp_copy(r[i]->y[1], t[1]);
+				fp_dbl(r[i]->z[0], r[i]->y[0]);
+				if (!fp_is_zero(r[i]->z[0])) {
+					fp_mul(t0, t0, r[i]->z[0]);
+				}
+				fp_zero(r[i]->z[1]);
+				fp_set_bit(r[i]->z[1], 0, b);
+			} else {
+				/* Mark the point as invalid and leave it out of the product. */
+				fp_zero(r[i]->z[0]);
+				fp_zero(r[i]->z[1]);
+				fp_set_bit(r[i]->z[1], 1, 1);
+				result = 0;
+			}
+			fp_copy(buf + i * FP_DIGS, t0);
+		}
+
+		fp_inv(t0, t0);
+
+		/* Divide the second halves using the inverse of the full product. */
+		for (i = n - 1; i >= 0; i--) {
+			if (fp_get_bit(r[i]->z[1], 1)) {
+				ep2_set_infty(r[i]);
+				continue;
+			}
+			if (fp_is_zero(r[i]->z[0])) {
+				fp_zero(r[i]->y[1]);
+			} else {
+				if (i > 0) {
+					fp_mul(t1, t0, buf + (i - 1) * FP_DIGS);
+				} else {
+					fp_copy(t1, t0);
+				}
+				fp_mul(t0, t0, r[i]->z[0]);
+				fp_mul(r[i]->y[1], r[i]->y[1], t1);
+			}
+			/* Fix the sign to match the compressed y-coordinate. */
+			if (fp_get_bit(r[i]->y[0], 0) != fp_get_bit(r[i]->z[1], 0)) {
+				fp_neg(r[i]->y[0], r[i]->y[0]);
+				fp_neg(r[i]->y[1], r[i]->y[1]);
+			}
+			fp_set_dig(r[i]->z[0], 1);
+			fp_zero(r[i]->z[1]);
+			r[i]->norm = 1;
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(t0);
+		fp_free(t1);
+		fp_free(t2);
+		fp2_free(t);
+		if (s == NULL) {
+			free(buf);
+		}
+	}
+	return result;
+}
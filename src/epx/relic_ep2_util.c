@@ -173,6 +173,53 @@ int ep2_is_valid(ep2_t p) {
 	return r;
 }
 
+int ep2_is_valid_bat(ep2_t *p, int n) {
+	fp2_t t0, t1, t2;
+	int i, r = 1;
+
+	fp2_null(t0);
+	fp2_null(t1);
+	fp2_null(t2);
+
+	TRY {
+		fp2_new(t0);
+		fp2_new(t1);
+		fp2_new(t2);
+
+		/* Check Y^2 = X^3 + a * X * Z^4 + b * Z^6 without inverting Z. */
+		for (i = 0; i < n; i++) {
+			if (ep2_is_infty(p[i])) {
+				continue;
+			}
+			/* t0 = Z^2, t1 = Z^4. */
+			fp2_sqr(t0, p[i]->z);
+			fp2_sqr(t1, t0);
+			/* t1 = a * Z^4 + X^2. */
+			ep2_curve_get_a(t2);
+			fp2_mul(t1, t1, t2);
+			fp2_sqr(t2, p[i]->x);
+			fp2_add(t1, t1, t2);
+			/* t1 = X^3 + a * X * Z^4. */
+			fp2_mul(t1, t1, p[i]->x);
+			/* t0 = b * Z^6. */
+			fp2_sqr(t2, t0);
+			fp2_mul(t0, t0, t2);
+			ep2_curve_get_b(t2);
+			fp2_mul(t0, t0, t2);
+			fp2_add(t1, t1, t0);
+			fp2_sqr(t0, p[i]->y);
+			r &= (fp2_cmp(t0, t1) == CMP_EQ);
+		}
+	} CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	} FINALLY {
+		fp2_free(t0);
+		fp2_free(t1);
+		fp2_free(t2);
+	}
+	return r;
+}
+
 void ep2_print(ep2_t p) {
 	fp2_print(p->x);
 	fp2_print(p->y);
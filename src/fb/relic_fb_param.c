@@ -28,6 +28,7 @@
  * @ingroup fb
  */
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
@@ -38,15 +39,62 @@
 #include "relic_fb.h"
 #include "relic_util.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Maximum number of binary fields that can be shared among threads.
+ */
+#define FB_SHARED		8
+
+/**
+ * Size in bytes of a cache line, to which shared parameters are aligned.
+ */
+#define FB_LINE			64
+
+/**
+ * Binary field parameters shared read-only by all threads.
+ */
+typedef struct {
+	/** The parameter identifier. */
+	int param;
+	/** The number of contexts referencing these parameters. */
+	int refs;
+	/** The memory block holding the parameters. */
+	void *mem;
+	/** The binary field, aligned to a cache line inside the block. */
+	fb_field_t field;
+} fb_shared_t;
+
+/**
+ * Table of shared binary fields.
+ */
+static fb_shared_t shared[FB_SHARED];
+
+#if MULTI == PTHREAD
+/**
+ * Lock protecting the table of shared binary fields.
+ */
+static pthread_mutex_t shared_lock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
 int fb_param_get(void) {
-	return core_get()->fb_id;
+	return core_get()->fb->id;
 }
 
 void fb_param_set(int param) {
+	ctx_t *ctx = core_get();
+
+	/* A shared field is read-only, so reconfigure the default one instead. */
+	if (ctx->fb_shared != NULL && ctx->fb == ctx->fb_shared) {
+		fb_param_release();
+	}
+
 	switch (param) {
 		case PENTA_8:
 			fb_poly_set_penta(4, 3, 2);
@@ -137,7 +185,114 @@ void fb_param_set(int param) {
 			THROW(ERR_NO_VALID);
 			break;
 	}
-	core_get()->fb_id = param;
+	ctx->fb->id = param;
+}
+
+void fb_param_set_shared(int param) {
+	ctx_t *ctx = core_get();
+	fb_shared_t *s = NULL;
+	int i;
+
+	fb_param_release();
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&shared_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (fb_shared)
+#endif
+	{
+		for (i = 0; i < FB_SHARED && s == NULL; i++) {
+			if (shared[i].refs > 0 && shared[i].param == param) {
+				s = &shared[i];
+			}
+		}
+		for (i = 0; i < FB_SHARED && s == NULL; i++) {
+			if (shared[i].refs > 0) {
+				continue;
+			}
+			shared[i].mem = malloc(sizeof(fb_field_st) + FB_LINE);
+			if (shared[i].mem == NULL) {
+				break;
+			}
+			shared[i].field = (fb_field_t)(((uintptr_t)shared[i].mem +
+					FB_LINE - 1) & ~(uintptr_t)(FB_LINE - 1));
+
+			/* The first thread builds the field and its tables in place. */
+			fb_field_set(shared[i].field);
+			fb_poly_init();
+			TRY {
+				fb_param_set(param);
+			}
+			CATCH_ANY {
+				fb_field_get()->id = 0;
+			}
+
+			if (fb_param_get() == param) {
+				shared[i].param = param;
+				s = &shared[i];
+			} else {
+				fb_poly_clean();
+				free(shared[i].mem);
+				shared[i].mem = NULL;
+			}
+			fb_field_set(NULL);
+			break;
+		}
+		if (s != NULL) {
+			s->refs++;
+		}
+	}
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&shared_lock);
+#endif
+
+	if (s == NULL) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	fb_field_set(s->field);
+	ctx->fb_shared = s->field;
+}
+
+void fb_param_release(void) {
+	ctx_t *ctx = core_get();
+	fb_field_t field = ctx->fb;
+	int i;
+
+	if (ctx->fb_shared == NULL) {
+		return;
+	}
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&shared_lock);
+#elif MULTI == OPENMP
+#pragma omp critical (fb_shared)
+#endif
+	{
+		for (i = 0; i < FB_SHARED; i++) {
+			if (shared[i].refs == 0 || shared[i].field != ctx->fb_shared) {
+				continue;
+			}
+			if (field == shared[i].field) {
+				field = NULL;
+			}
+			if (--shared[i].refs == 0) {
+				/* The last reference frees the field. */
+				fb_field_set(shared[i].field);
+				fb_poly_clean();
+				free(shared[i].mem);
+				shared[i].mem = NULL;
+			}
+			break;
+		}
+	}
+#if MULTI == PTHREAD
+	pthread_mutex_unlock(&shared_lock);
+#endif
+
+	fb_field_set(field);
+	ctx->fb_shared = NULL;
 }
 
 void fb_param_set_any(void) {
@@ -58,7 +58,7 @@ static void find_trace() {
 	fb_null(t0);
 	fb_null(t1);
 
-	ctx->fb_ta = ctx->fb_tb = ctx->fb_tc = -1;
+	ctx->fb->ta = ctx->fb->tb = ctx->fb->tc = -1;
 
 	TRY {
 		fb_new(t0);
@@ -76,15 +76,15 @@ static void find_trace() {
 			if (!fb_is_zero(t0)) {
 				switch (counter) {
 					case 0:
-						ctx->fb_ta = i;
-						ctx->fb_tb = ctx->fb_tc = -1;
+						ctx->fb->ta = i;
+						ctx->fb->tb = ctx->fb->tc = -1;
 						break;
 					case 1:
-						ctx->fb_tb = i;
-						ctx->fb_tc = -1;
+						ctx->fb->tb = i;
+						ctx->fb->tc = -1;
 						break;
 					case 2:
-						ctx->fb_tc = i;
+						ctx->fb->tc = i;
 						break;
 					default:
 						THROW(ERR_NO_VALID);
@@ -131,14 +131,14 @@ static void find_solve() {
 						fb_set_bit(t0, i + 2 * k + 1, 1);
 					}
 				}
-				fb_copy(ctx->fb_half[l][j], t0);
+				fb_copy(ctx->fb->half[l][j], t0);
 				for (k = 0; k < (FB_BITS - 1) / 2; k++) {
-					fb_sqr(ctx->fb_half[l][j], ctx->fb_half[l][j]);
-					fb_sqr(ctx->fb_half[l][j], ctx->fb_half[l][j]);
-					fb_add(ctx->fb_half[l][j], ctx->fb_half[l][j], t0);
+					fb_sqr(ctx->fb->half[l][j], ctx->fb->half[l][j]);
+					fb_sqr(ctx->fb->half[l][j], ctx->fb->half[l][j]);
+					fb_add(ctx->fb->half[l][j], ctx->fb->half[l][j], t0);
 				}
 			}
-			fb_rsh(ctx->fb_half[l][j], ctx->fb_half[l][j], 1);
+			fb_rsh(ctx->fb->half[l][j], ctx->fb->half[l][j], 1);
 		}
 	}
 	CATCH_ANY {
@@ -159,15 +159,15 @@ static void find_solve() {
 static void find_srz() {
 	ctx_t *ctx = core_get();
 
-	fb_set_dig(ctx->fb_srz, 2);
+	fb_set_dig(ctx->fb->srz, 2);
 
 	for (int i = 1; i < FB_BITS; i++) {
-		fb_sqr(ctx->fb_srz, ctx->fb_srz);
+		fb_sqr(ctx->fb->srz, ctx->fb->srz);
 	}
 
 #ifdef FB_PRECO
 	for (int i = 0; i <= 255; i++) {
-		fb_mul_dig(ctx->fb_tab_srz[i], ctx->fb_srz, i);
+		fb_mul_dig(ctx->fb->tab_srz[i], ctx->fb->srz, i);
 	}
 #endif
 }
@@ -183,62 +183,62 @@ static void find_chain() {
 	int i, j, k, l;
 	ctx_t *ctx = core_get();
 
-	ctx->chain_len = -1;
+	ctx->fb->chain_len = -1;
 	for (int i = 0; i < MAX_TERMS; i++) {
-		ctx->chain[i] = (i << 8) + i;
+		ctx->fb->chain[i] = (i << 8) + i;
 	}
 	switch (FB_BITS) {
 		case 127:
-			ctx->chain[1] = (1 << 8) + 0;
-			ctx->chain[4] = (4 << 8) + 2;
-			ctx->chain[7] = (7 << 8) + 2;
-			ctx->chain_len = 9;
+			ctx->fb->chain[1] = (1 << 8) + 0;
+			ctx->fb->chain[4] = (4 << 8) + 2;
+			ctx->fb->chain[7] = (7 << 8) + 2;
+			ctx->fb->chain_len = 9;
 			break;
 		case 193:
-			ctx->chain[1] = (1 << 8) + 0;
-			ctx->chain_len = 8;
+			ctx->fb->chain[1] = (1 << 8) + 0;
+			ctx->fb->chain_len = 8;
 			break;
 		case 233:
-			ctx->chain[1] = (1 << 8) + 0;
-			ctx->chain[3] = (3 << 8) + 0;
-			ctx->chain[6] = (6 << 8) + 0;
-			ctx->chain_len = 10;
+			ctx->fb->chain[1] = (1 << 8) + 0;
+			ctx->fb->chain[3] = (3 << 8) + 0;
+			ctx->fb->chain[6] = (6 << 8) + 0;
+			ctx->fb->chain_len = 10;
 			break;
 		case 251:
-			ctx->chain[1] = (1 << 8) + 0;
-			ctx->chain[2] = (2 << 8) + 1;
-			ctx->chain[4] = (4 << 8) + 3;
-			ctx->chain[5] = (5 << 8) + 4;
-			ctx->chain[7] = (7 << 8) + 6;
-			ctx->chain[8] = (8 << 8) + 7;
-			ctx->chain_len = 10;
+			ctx->fb->chain[1] = (1 << 8) + 0;
+			ctx->fb->chain[2] = (2 << 8) + 1;
+			ctx->fb->chain[4] = (4 << 8) + 3;
+			ctx->fb->chain[5] = (5 << 8) + 4;
+			ctx->fb->chain[7] = (7 << 8) + 6;
+			ctx->fb->chain[8] = (8 << 8) + 7;
+			ctx->fb->chain_len = 10;
 			break;
 		case 283:
-			ctx->chain[4] = (4 << 8) + 0;
-			ctx->chain[6] = (6 << 8) + 0;
-			ctx->chain[9] = (9 << 8) + 0;
-			ctx->chain_len = 11;
+			ctx->fb->chain[4] = (4 << 8) + 0;
+			ctx->fb->chain[6] = (6 << 8) + 0;
+			ctx->fb->chain[9] = (9 << 8) + 0;
+			ctx->fb->chain_len = 11;
 			break;
 		case 353:
-			ctx->chain[2] = (2 << 8) + 0;
-			ctx->chain[4] = (4 << 8) + 0;
-			ctx->chain_len = 10;
+			ctx->fb->chain[2] = (2 << 8) + 0;
+			ctx->fb->chain[4] = (4 << 8) + 0;
+			ctx->fb->chain_len = 10;
 			break;
 		case 367:
-			ctx->chain[1] = (1 << 8) + 0;
-			ctx->chain[2] = (2 << 8) + 1;
-			ctx->chain[6] = (6 << 8) + 3;
-			ctx->chain[9] = (9 << 8) + 2;
-			ctx->chain_len = 11;
+			ctx->fb->chain[1] = (1 << 8) + 0;
+			ctx->fb->chain[2] = (2 << 8) + 1;
+			ctx->fb->chain[6] = (6 << 8) + 3;
+			ctx->fb->chain[9] = (9 << 8) + 2;
+			ctx->fb->chain_len = 11;
 			break;
 		case 1223:
-			ctx->chain[1] = (1 << 8) + 0;
-			ctx->chain[2] = (2 << 8) + 0;
-			ctx->chain[4] = (4 << 8) + 2;
-			ctx->chain[5] = (5 << 8) + 4;
-			ctx->chain[10] = (10 << 8) + 2;
-			ctx->chain[11] = (11 << 8) + 10;
-			ctx->chain_len = 13;
+			ctx->fb->chain[1] = (1 << 8) + 0;
+			ctx->fb->chain[2] = (2 << 8) + 0;
+			ctx->fb->chain[4] = (4 << 8) + 2;
+			ctx->fb->chain[5] = (5 << 8) + 4;
+			ctx->fb->chain[10] = (10 << 8) + 2;
+			ctx->fb->chain[11] = (11 << 8) + 10;
+			ctx->fb->chain_len = 13;
 			break;
 		default:
 			l = 0;
@@ -254,11 +254,11 @@ static void find_chain() {
 				}
 			}
 			i = 0;
-			ctx->chain_len = k + l;
+			ctx->fb->chain_len = k + l;
 			while (j != 1) {
 				if ((j & 0x01) != 0) {
 					i++;
-					ctx->chain[ctx->chain_len - i] = ((ctx->chain_len - i) << 8) + 0;
+					ctx->fb->chain[ctx->fb->chain_len - i] = ((ctx->fb->chain_len - i) << 8) + 0;
 				}
 				i++;
 				j = j >> 1;
@@ -266,19 +266,19 @@ static void find_chain() {
 			break;
 	}
 
-	int x, y, u[ctx->chain_len + 1];
+	int x, y, u[ctx->fb->chain_len + 1];
 
 	for (i = 0; i < MAX_TERMS; i++) {
 		for (j = 0; j < FB_TABLE; j++) {
-			ctx->fb_tab_ptr[i][j] = &(ctx->fb_tab_sqr[i][j]);
+			ctx->fb->tab_ptr[i][j] = &(ctx->fb->tab_sqr[i][j]);
 		}
 	}
 
 	u[0] = 1;
 	u[1] = 2;
-	for (i = 2; i <= ctx->chain_len; i++) {
-		x = ctx->chain[i - 1] >> 8;
-		y = ctx->chain[i - 1] - (x << 8);
+	for (i = 2; i <= ctx->fb->chain_len; i++) {
+		x = ctx->fb->chain[i - 1] >> 8;
+		y = ctx->fb->chain[i - 1] - (x << 8);
 		if (x == y) {
 			u[i] = 2 * u[i - 1];
 		} else {
@@ -286,7 +286,7 @@ static void find_chain() {
 		}
 	}
 
-	for (i = 0; i <= ctx->chain_len; i++) {
+	for (i = 0; i <= ctx->fb->chain_len; i++) {
 		fb_itr_pre((fb_t *)fb_poly_tab_sqr(i), u[i]);
 	}
 }
@@ -299,7 +299,7 @@ static void find_chain() {
  * @param[in] f				- the new irreducible polynomial.
  */
 static void fb_poly_set(const fb_t f) {
-	fb_copy(core_get()->fb_poly, f);
+	fb_copy(core_get()->fb->poly, f);
 #if FB_TRC == QUICK || !defined(STRIP)
 	find_trace();
 #endif
@@ -321,16 +321,30 @@ static void fb_poly_set(const fb_t f) {
 void fb_poly_init(void) {
 	ctx_t *ctx = core_get();
 
-	fb_zero(ctx->fb_poly);
-	ctx->fb_pa = ctx->fb_pb = ctx->fb_pc = 0;
-	ctx->fb_na = ctx->fb_nb = ctx->fb_nc = -1;
+	ctx->fb->id = 0;
+	fb_zero(ctx->fb->poly);
+	ctx->fb->pa = ctx->fb->pb = ctx->fb->pc = 0;
+	ctx->fb->na = ctx->fb->nb = ctx->fb->nc = -1;
 }
 
 void fb_poly_clean(void) {
 }
 
+fb_field_t fb_field_get(void) {
+	return core_get()->fb;
+}
+
+void fb_field_set(fb_field_t field) {
+	ctx_t *ctx = core_get();
+
+	if (field == NULL) {
+		field = ctx->fb_def;
+	}
+	ctx->fb = field;
+}
+
 dig_t *fb_poly_get(void) {
-	return core_get()->fb_poly;
+	return core_get()->fb->poly;
 }
 
 void fb_poly_add(fb_t c, const fb_t a) {
@@ -340,24 +354,24 @@ void fb_poly_add(fb_t c, const fb_t a) {
 		fb_copy(c, a);
 	}
 
-	if (ctx->fb_pa != 0) {
-		c[FB_DIGS - 1] ^= ctx->fb_poly[FB_DIGS - 1];
-		if (ctx->fb_na != FB_DIGS - 1) {
-			c[ctx->fb_na] ^= ctx->fb_poly[ctx->fb_na];
+	if (ctx->fb->pa != 0) {
+		c[FB_DIGS - 1] ^= ctx->fb->poly[FB_DIGS - 1];
+		if (ctx->fb->na != FB_DIGS - 1) {
+			c[ctx->fb->na] ^= ctx->fb->poly[ctx->fb->na];
 		}
-		if (ctx->fb_pb != 0 && ctx->fb_pc != 0) {
-			if (ctx->fb_nb != ctx->fb_na) {
-				c[ctx->fb_nb] ^= ctx->fb_poly[ctx->fb_nb];
+		if (ctx->fb->pb != 0 && ctx->fb->pc != 0) {
+			if (ctx->fb->nb != ctx->fb->na) {
+				c[ctx->fb->nb] ^= ctx->fb->poly[ctx->fb->nb];
 			}
-			if (ctx->fb_nc != ctx->fb_na && ctx->fb_nc != ctx->fb_nb) {
-				c[ctx->fb_nc] ^= ctx->fb_poly[ctx->fb_nc];
+			if (ctx->fb->nc != ctx->fb->na && ctx->fb->nc != ctx->fb->nb) {
+				c[ctx->fb->nc] ^= ctx->fb->poly[ctx->fb->nc];
 			}
 		}
-		if (ctx->fb_na != 0 && ctx->fb_nb != 0 && ctx->fb_nc != 0) {
+		if (ctx->fb->na != 0 && ctx->fb->nb != 0 && ctx->fb->nc != 0) {
 			c[0] ^= 1;
 		}
 	} else {
-		fb_add(c, a, ctx->fb_poly);
+		fb_add(c, a, ctx->fb->poly);
 	}
 }
 
@@ -368,8 +382,8 @@ void fb_poly_sub(fb_t c, const fb_t a) {
 void fb_poly_set_dense(const fb_t f) {
 	ctx_t *ctx = core_get();
 	fb_poly_set(f);
-	ctx->fb_pa = ctx->fb_pb = ctx->fb_pc = 0;
-	ctx->fb_na = ctx->fb_nb = ctx->fb_nc = -1;
+	ctx->fb->pa = ctx->fb->pb = ctx->fb->pc = 0;
+	ctx->fb->na = ctx->fb->nb = ctx->fb->nc = -1;
 }
 
 void fb_poly_set_trino(int a) {
@@ -379,11 +393,11 @@ void fb_poly_set_trino(int a) {
 	fb_null(f);
 
 	TRY {
-		ctx->fb_pa = a;
-		ctx->fb_pb = ctx->fb_pc = 0;
+		ctx->fb->pa = a;
+		ctx->fb->pb = ctx->fb->pc = 0;
 
-		ctx->fb_na = ctx->fb_pa >> FB_DIG_LOG;
-		ctx->fb_nb = ctx->fb_nc = -1;
+		ctx->fb->na = ctx->fb->pa >> FB_DIG_LOG;
+		ctx->fb->nb = ctx->fb->nc = -1;
 
 		fb_new(f);
 		fb_zero(f);
@@ -409,13 +423,13 @@ void fb_poly_set_penta(int a, int b, int c) {
 	TRY {
 		fb_new(f);
 
-		ctx->fb_pa = a;
-		ctx->fb_pb = b;
-		ctx->fb_pc = c;
+		ctx->fb->pa = a;
+		ctx->fb->pb = b;
+		ctx->fb->pc = c;
 
-		ctx->fb_na = ctx->fb_pa >> FB_DIG_LOG;
-		ctx->fb_nb = ctx->fb_pb >> FB_DIG_LOG;
-		ctx->fb_nc = ctx->fb_pc >> FB_DIG_LOG;
+		ctx->fb->na = ctx->fb->pa >> FB_DIG_LOG;
+		ctx->fb->nb = ctx->fb->pb >> FB_DIG_LOG;
+		ctx->fb->nc = ctx->fb->pc >> FB_DIG_LOG;
 
 		fb_zero(f);
 		fb_set_bit(f, FB_BITS, 1);
@@ -435,7 +449,7 @@ void fb_poly_set_penta(int a, int b, int c) {
 
 dig_t *fb_poly_get_srz(void) {
 #if FB_SRT == QUICK || !defined(STRIP)
-	return core_get()->fb_srz;
+	return core_get()->fb->srz;
 #else
 	return NULL;
 #endif
@@ -445,9 +459,9 @@ const fb_t *fb_poly_tab_sqr(int i) {
 #if FB_INV == ITOHT || !defined(STRIP)
 	/* If ITOHT inversion is used and tables are precomputed, return them. */
 #if ALLOC == AUTO
-	return (const fb_t *)*core_get()->fb_tab_ptr[i];
+	return (const fb_t *)*core_get()->fb->tab_ptr[i];
 #else
-	return (const fb_t *)core_get()->fb_tab_ptr[i];
+	return (const fb_t *)core_get()->fb->tab_ptr[i];
 #endif
 
 #else
@@ -459,7 +473,7 @@ const dig_t *fb_poly_tab_srz(int i) {
 #if FB_SRT == QUICK || !defined(STRIP)
 
 #ifdef FB_PRECO
-	return core_get()->fb_tab_srz[i];
+	return core_get()->fb->tab_srz[i];
 #else
 	return NULL;
 #endif
@@ -472,9 +486,9 @@ const dig_t *fb_poly_tab_srz(int i) {
 void fb_poly_get_trc(int *a, int *b, int *c) {
 #if FB_TRC == QUICK || !defined(STRIP)
 	ctx_t *ctx = core_get();
-	*a = ctx->fb_ta;
-	*b = ctx->fb_tb;
-	*c = ctx->fb_tc;
+	*a = ctx->fb->ta;
+	*b = ctx->fb->tb;
+	*c = ctx->fb->tc;
 #else
 	*a = *b = *c = -1;
 #endif
@@ -482,14 +496,14 @@ void fb_poly_get_trc(int *a, int *b, int *c) {
 
 void fb_poly_get_rdc(int *a, int *b, int *c) {
 	ctx_t *ctx = core_get();
-	*a = ctx->fb_pa;
-	*b = ctx->fb_pb;
-	*c = ctx->fb_pc;
+	*a = ctx->fb->pa;
+	*b = ctx->fb->pb;
+	*c = ctx->fb->pc;
 }
 
 const dig_t *fb_poly_get_slv() {
 #if FB_SLV == QUICK || !defined(STRIP)
-	return (dig_t *)&(core_get()->fb_half);
+	return (dig_t *)&(core_get()->fb->half);
 #else
 	return NULL;
 #endif
@@ -498,11 +512,11 @@ const dig_t *fb_poly_get_slv() {
 const int *fb_poly_get_chain(int *len) {
 #if FB_INV == ITOHT || !defined(STRIP)
 	ctx_t *ctx = core_get();
-	if (ctx->chain_len > 0 && ctx->chain_len < MAX_TERMS) {
+	if (ctx->fb->chain_len > 0 && ctx->fb->chain_len < MAX_TERMS) {
 		if (len != NULL) {
-			*len = ctx->chain_len;
+			*len = ctx->fb->chain_len;
 		}
-		return ctx->chain;
+		return ctx->fb->chain;
 	} else {
 		if (len != NULL) {
 			*len = 0;
@@ -382,6 +382,51 @@ void fp_inv_exgcd(fp_t c, const fp_t a) {
 
 #endif
 
+#if FP_INV == DIVST || !defined(STRIP)
+
+void fp_inv_divst(fp_t c, const fp_t a) {
+	bn_t _a, p;
+#if FP_RDC == MONTY
+	fp_t t;
+
+	fp_null(t);
+#endif
+
+	bn_null(_a);
+	bn_null(p);
+
+	TRY {
+		bn_new(_a);
+		bn_new(p);
+
+		bn_read_raw(_a, a, FP_DIGS);
+		bn_read_raw(p, fp_prime_get(), FP_DIGS);
+		bn_mod_inv(_a, _a, p);
+		fp_zero(c);
+		dv_copy(c, _a->dp, _a->used);
+
+#if FP_RDC == MONTY
+		fp_new(t);
+		/* The inverse of aR is a^{-1}R^{-1}, so multiply it by R^2 twice. */
+		dv_copy(t, fp_prime_get_conv(), FP_DIGS);
+		fp_mul(c, c, t);
+		fp_mul(c, c, t);
+#endif
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(_a);
+		bn_free(p);
+#if FP_RDC == MONTY
+		fp_free(t);
+#endif
+	}
+}
+
+#endif
+
 #if FP_INV == LOWER || !defined(STRIP)
 
 void fp_inv_lower(fp_t c, const fp_t a) {
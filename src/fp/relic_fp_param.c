@@ -56,7 +56,7 @@
 /*============================================================================*/
 
 int fp_param_get(void) {
-	return core_get()->fp_id;
+	return core_get()->fp->id;
 }
 
 void fp_param_get_var(bn_t x) {
@@ -300,7 +300,7 @@ void fp_param_set(int param) {
 		bn_new(t2);
 		bn_new(p);
 
-		core_get()->fp_id = param;
+		core_get()->fp->id = param;
 
 		switch (param) {
 #if FP_PRIME == 158
@@ -608,7 +608,7 @@ void fp_param_set(int param) {
 #else
 			default:
 				fp_param_set_any_dense();
-				core_get()->fp_id = 0;
+				core_get()->fp->id = 0;
 				break;
 #endif
 		}
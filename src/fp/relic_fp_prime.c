@@ -37,6 +37,80 @@
 /* Private definitions                                                        */
 /*============================================================================*/
 
+/**
+ * Maximum window width considered for the square root exponent.
+ */
+#define SRT_WIDTH	6
+
+/**
+ * Precomputes the constants used by square roots and quadratic residuosity
+ * tests: the decomposition p - 1 = e * 2^f with e odd, a primitive 2^f-th root
+ * of unity and the recoding of (e - 1)/2 with the cheapest window width.
+ */
+static void fp_prime_srt(void) {
+	bn_t e, t;
+	fp_t z;
+	uint8_t win[FP_BITS + 1];
+	int i, w, l, cost, best = 0;
+	ctx_t *ctx = core_get();
+
+	bn_null(e);
+	bn_null(t);
+	fp_null(z);
+
+	TRY {
+		bn_new(e);
+		bn_new(t);
+		fp_new(z);
+
+		bn_sub_dig(e, &(ctx->fp->prime), 1);
+		for (ctx->fp->ad2 = 0; bn_is_even(e); ctx->fp->ad2++) {
+			bn_hlv(e, e);
+		}
+
+		/* Find the least quadratic non-residue and compute z^e. */
+		for (i = 2; ; i++) {
+			bn_set_dig(t, i);
+			bn_smb_jac(t, t, &(ctx->fp->prime));
+			if (bn_sign(t) == BN_NEG) {
+				break;
+			}
+		}
+		fp_set_dig(z, i);
+		fp_exp(ctx->fp->root, z, e);
+
+		bn_hlv(e, e);
+		ctx->fp->srt_wid = 2;
+		ctx->fp->srt_len = 0;
+		if (!bn_is_zero(e)) {
+			/* A window of width w costs 2^(w - 1) products for the table. */
+			for (w = 2; w <= SRT_WIDTH; w++) {
+				l = FP_BITS + 1;
+				bn_rec_slw(win, &l, e, w);
+				cost = 1 << (w - 1);
+				for (i = 0; i < l; i++) {
+					cost += (win[i] != 0);
+				}
+				if (best == 0 || cost < best) {
+					best = cost;
+					ctx->fp->srt_wid = w;
+				}
+			}
+			ctx->fp->srt_len = FP_BITS + 1;
+			bn_rec_slw(ctx->fp->srt_win, &(ctx->fp->srt_len), e,
+					ctx->fp->srt_wid);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(e);
+		bn_free(t);
+		fp_free(z);
+	}
+}
+
 /**
  * Assigns the prime field modulus.
  *
@@ -60,47 +134,48 @@ static void fp_prime_set(const bn_t p) {
 		bn_new(t);
 		dv_new(q);
 
-		bn_copy(&(ctx->prime), p);
+		bn_copy(&(ctx->fp->prime), p);
 
-		bn_mod_dig(&(ctx->mod8), &(ctx->prime), 8);
+		bn_mod_dig(&(ctx->fp->mod8), &(ctx->fp->prime), 8);
 
-		switch (ctx->mod8) {
+		switch (ctx->fp->mod8) {
 			case 3:
 			case 7:
-				ctx->qnr = -1;
+				ctx->fp->qnr = -1;
 				/* The current code for extensions of Fp^3 relies on qnr being
 				 * also a cubic non-residue. */
-				ctx->cnr = 0;
+				ctx->fp->cnr = 0;
 				break;
 			case 1:
 			case 5:
-				ctx->qnr = ctx->cnr = -2;
+				ctx->fp->qnr = ctx->fp->cnr = -2;
 				break;
 			default:
-				ctx->qnr = ctx->cnr = 0;
+				ctx->fp->qnr = ctx->fp->cnr = 0;
 				THROW(ERR_NO_VALID);
 				break;
 		}
 #ifdef FP_QNRES
-		if (ctx->mod8 != 3) {
+		if (ctx->fp->mod8 != 3) {
 			THROW(ERR_NO_VALID);
 		}
 #endif
 
 #if FP_RDC == MONTY || !defined(STRIP)
-		bn_mod_pre_monty(t, &(ctx->prime));
-		ctx->u = t->dp[0];
+		bn_mod_pre_monty(t, &(ctx->fp->prime));
+		ctx->fp->u = t->dp[0];
 		dv_zero(s, 2 * FP_DIGS);
 		s[2 * FP_DIGS] = 1;
 		dv_zero(q, 2 * FP_DIGS + 1);
-		dv_copy(q, ctx->prime.dp, FP_DIGS);
-		bn_divn_low(t->dp, ctx->conv.dp, s, 2 * FP_DIGS + 1, q, FP_DIGS);
-		ctx->conv.used = FP_DIGS;
-		bn_trim(&(ctx->conv));
-		bn_set_dig(&(ctx->one), 1);
-		bn_lsh(&(ctx->one), &(ctx->one), ctx->prime.used * BN_DIGIT);
-		bn_mod(&(ctx->one), &(ctx->one), &(ctx->prime));
+		dv_copy(q, ctx->fp->prime.dp, FP_DIGS);
+		bn_divn_low(t->dp, ctx->fp->conv.dp, s, 2 * FP_DIGS + 1, q, FP_DIGS);
+		ctx->fp->conv.used = FP_DIGS;
+		bn_trim(&(ctx->fp->conv));
+		bn_set_dig(&(ctx->fp->one), 1);
+		bn_lsh(&(ctx->fp->one), &(ctx->fp->one), ctx->fp->prime.used * BN_DIGIT);
+		bn_mod(&(ctx->fp->one), &(ctx->fp->one), &(ctx->fp->prime));
 #endif
+		fp_prime_srt();
 		fp_prime_calc();
 	}
 	CATCH_ANY {
@@ -140,38 +215,38 @@ static void fp2_calc() {
 		bn_div_dig(e, e, 6);
 		fp2_exp(t0, t0, e);
 #if ALLOC == AUTO
-		fp2_copy(ctx->fp2_p[0], t0);
-		fp2_sqr(ctx->fp2_p[1], ctx->fp2_p[0]);
-		fp2_mul(ctx->fp2_p[2], ctx->fp2_p[1], ctx->fp2_p[0]);
-		fp2_sqr(ctx->fp2_p[3], ctx->fp2_p[1]);
-		fp2_mul(ctx->fp2_p[4], ctx->fp2_p[3], ctx->fp2_p[0]);
+		fp2_copy(ctx->fp->fp2_p[0], t0);
+		fp2_sqr(ctx->fp->fp2_p[1], ctx->fp->fp2_p[0]);
+		fp2_mul(ctx->fp->fp2_p[2], ctx->fp->fp2_p[1], ctx->fp->fp2_p[0]);
+		fp2_sqr(ctx->fp->fp2_p[3], ctx->fp->fp2_p[1]);
+		fp2_mul(ctx->fp->fp2_p[4], ctx->fp->fp2_p[3], ctx->fp->fp2_p[0]);
 #else
-		fp_copy(ctx->fp2_p[0][0], t0[0]);
-		fp_copy(ctx->fp2_p[0][1], t0[1]);
+		fp_copy(ctx->fp->fp2_p[0][0], t0[0]);
+		fp_copy(ctx->fp->fp2_p[0][1], t0[1]);
 		fp2_sqr(t1, t0);
-		fp_copy(ctx->fp2_p[1][0], t1[0]);
-		fp_copy(ctx->fp2_p[1][1], t1[1]);
+		fp_copy(ctx->fp->fp2_p[1][0], t1[0]);
+		fp_copy(ctx->fp->fp2_p[1][1], t1[1]);
 		fp2_mul(t1, t1, t0);
-		fp_copy(ctx->fp2_p[2][0], t1[0]);
-		fp_copy(ctx->fp2_p[2][1], t1[1]);
+		fp_copy(ctx->fp->fp2_p[2][0], t1[0]);
+		fp_copy(ctx->fp->fp2_p[2][1], t1[1]);
 		fp2_sqr(t1, t0);
 		fp2_sqr(t1, t1);
-		fp_copy(ctx->fp2_p[3][0], t1[0]);
-		fp_copy(ctx->fp2_p[3][1], t1[1]);
+		fp_copy(ctx->fp->fp2_p[3][0], t1[0]);
+		fp_copy(ctx->fp->fp2_p[3][1], t1[1]);
 		fp2_mul(t1, t1, t0);
-		fp_copy(ctx->fp2_p[4][0], t1[0]);
-		fp_copy(ctx->fp2_p[4][1], t1[1]);
+		fp_copy(ctx->fp->fp2_p[4][0], t1[0]);
+		fp_copy(ctx->fp->fp2_p[4][1], t1[1]);
 #endif
 		fp2_frb(t1, t0, 1);
 		fp2_mul(t0, t1, t0);
-		fp_copy(ctx->fp2_p2[0], t0[0]);
-		fp_sqr(ctx->fp2_p2[1], ctx->fp2_p2[0]);
-		fp_mul(ctx->fp2_p2[2], ctx->fp2_p2[1], ctx->fp2_p2[0]);
-		fp_sqr(ctx->fp2_p2[3], ctx->fp2_p2[1]);
+		fp_copy(ctx->fp->fp2_p2[0], t0[0]);
+		fp_sqr(ctx->fp->fp2_p2[1], ctx->fp->fp2_p2[0]);
+		fp_mul(ctx->fp->fp2_p2[2], ctx->fp->fp2_p2[1], ctx->fp->fp2_p2[0]);
+		fp_sqr(ctx->fp->fp2_p2[3], ctx->fp->fp2_p2[1]);
 
 		for (int i = 0; i < 5; i++) {
-			fp_mul(ctx->fp2_p3[i][0], ctx->fp2_p2[i % 3], ctx->fp2_p[i][0]);
-			fp_mul(ctx->fp2_p3[i][1], ctx->fp2_p2[i % 3], ctx->fp2_p[i][1]);
+			fp_mul(ctx->fp->fp2_p3[i][0], ctx->fp->fp2_p2[i % 3], ctx->fp->fp2_p[i][0]);
+			fp_mul(ctx->fp->fp2_p3[i][1], ctx->fp->fp2_p2[i % 3], ctx->fp->fp2_p[i][1]);
 		}
 	} CATCH_ANY {
 		THROW(ERR_CAUGHT);
@@ -201,14 +276,14 @@ static void fp3_calc() {
 		fp3_new(t1);
 		fp3_new(t2);
 
-		fp_set_dig(ctx->fp3_base[0], -fp_prime_get_cnr());
-		fp_neg(ctx->fp3_base[0], ctx->fp3_base[0]);
+		fp_set_dig(ctx->fp->fp3_base[0], -fp_prime_get_cnr());
+		fp_neg(ctx->fp->fp3_base[0], ctx->fp->fp3_base[0]);
 		e->used = FP_DIGS;
 		dv_copy(e->dp, fp_prime_get(), FP_DIGS);
 		bn_sub_dig(e, e, 1);
 		bn_div_dig(e, e, 3);
-		fp_exp(ctx->fp3_base[0], ctx->fp3_base[0], e);
-		fp_sqr(ctx->fp3_base[1], ctx->fp3_base[0]);
+		fp_exp(ctx->fp->fp3_base[0], ctx->fp->fp3_base[0], e);
+		fp_sqr(ctx->fp->fp3_base[1], ctx->fp->fp3_base[0]);
 
 		fp3_zero(t0);
 		fp_set_dig(t0[1], 1);
@@ -218,62 +293,62 @@ static void fp3_calc() {
 
 		/* t0 = u^((p-1)/6). */
 		fp3_exp(t0, t0, e);
-		fp_copy(ctx->fp3_p[0], t0[2]);
+		fp_copy(ctx->fp->fp3_p[0], t0[2]);
 		fp3_sqr(t1, t0);
-		fp_copy(ctx->fp3_p[1], t1[1]);
+		fp_copy(ctx->fp->fp3_p[1], t1[1]);
 		fp3_mul(t2, t1, t0);
-		fp_copy(ctx->fp3_p[2], t2[0]);
+		fp_copy(ctx->fp->fp3_p[2], t2[0]);
 		fp3_sqr(t2, t1);
-		fp_copy(ctx->fp3_p[3], t2[2]);
+		fp_copy(ctx->fp->fp3_p[3], t2[2]);
 		fp3_mul(t2, t2, t0);
-		fp_copy(ctx->fp3_p[4], t2[1]);
+		fp_copy(ctx->fp->fp3_p[4], t2[1]);
 
-		fp_mul(ctx->fp3_p2[0], ctx->fp3_p[0], ctx->fp3_base[1]);
-		fp_mul(t0[0], ctx->fp3_p2[0], ctx->fp3_p[0]);
-		fp_neg(ctx->fp3_p2[0], t0[0]);
+		fp_mul(ctx->fp->fp3_p2[0], ctx->fp->fp3_p[0], ctx->fp->fp3_base[1]);
+		fp_mul(t0[0], ctx->fp->fp3_p2[0], ctx->fp->fp3_p[0]);
+		fp_neg(ctx->fp->fp3_p2[0], t0[0]);
 		for (int i = -1; i > fp_prime_get_cnr(); i--) {
-			fp_sub(ctx->fp3_p2[0], ctx->fp3_p2[0], t0[0]);
+			fp_sub(ctx->fp->fp3_p2[0], ctx->fp->fp3_p2[0], t0[0]);
 		}
-		fp_mul(ctx->fp3_p2[1], ctx->fp3_p[1], ctx->fp3_base[0]);
-		fp_mul(ctx->fp3_p2[1], ctx->fp3_p2[1], ctx->fp3_p[1]);
-		fp_sqr(ctx->fp3_p2[2], ctx->fp3_p[2]);
-		fp_mul(ctx->fp3_p2[3], ctx->fp3_p[3], ctx->fp3_base[1]);
-		fp_mul(t0[0], ctx->fp3_p2[3], ctx->fp3_p[3]);
-		fp_neg(ctx->fp3_p2[3], t0[0]);
+		fp_mul(ctx->fp->fp3_p2[1], ctx->fp->fp3_p[1], ctx->fp->fp3_base[0]);
+		fp_mul(ctx->fp->fp3_p2[1], ctx->fp->fp3_p2[1], ctx->fp->fp3_p[1]);
+		fp_sqr(ctx->fp->fp3_p2[2], ctx->fp->fp3_p[2]);
+		fp_mul(ctx->fp->fp3_p2[3], ctx->fp->fp3_p[3], ctx->fp->fp3_base[1]);
+		fp_mul(t0[0], ctx->fp->fp3_p2[3], ctx->fp->fp3_p[3]);
+		fp_neg(ctx->fp->fp3_p2[3], t0[0]);
 		for (int i = -1; i > fp_prime_get_cnr(); i--) {
-			fp_sub(ctx->fp3_p2[3], ctx->fp3_p2[3], t0[0]);
+			fp_sub(ctx->fp->fp3_p2[3], ctx->fp->fp3_p2[3], t0[0]);
 		}
-		fp_mul(ctx->fp3_p2[4], ctx->fp3_p[4], ctx->fp3_base[0]);
-		fp_mul(ctx->fp3_p2[4], ctx->fp3_p2[4], ctx->fp3_p[4]);
+		fp_mul(ctx->fp->fp3_p2[4], ctx->fp->fp3_p[4], ctx->fp->fp3_base[0]);
+		fp_mul(ctx->fp->fp3_p2[4], ctx->fp->fp3_p2[4], ctx->fp->fp3_p[4]);
 
-		fp_mul(ctx->fp3_p3[0], ctx->fp3_p[0], ctx->fp3_base[0]);
-		fp_mul(t0[0], ctx->fp3_p3[0], ctx->fp3_p2[0]);
-		fp_neg(ctx->fp3_p3[0], t0[0]);
+		fp_mul(ctx->fp->fp3_p3[0], ctx->fp->fp3_p[0], ctx->fp->fp3_base[0]);
+		fp_mul(t0[0], ctx->fp->fp3_p3[0], ctx->fp->fp3_p2[0]);
+		fp_neg(ctx->fp->fp3_p3[0], t0[0]);
 		for (int i = -1; i > fp_prime_get_cnr(); i--) {
-			fp_sub(ctx->fp3_p3[0], ctx->fp3_p3[0], t0[0]);
+			fp_sub(ctx->fp->fp3_p3[0], ctx->fp->fp3_p3[0], t0[0]);
 		}
-		fp_mul(ctx->fp3_p3[1], ctx->fp3_p[1], ctx->fp3_base[1]);
-		fp_mul(t0[0], ctx->fp3_p3[1], ctx->fp3_p2[1]);
-		fp_neg(ctx->fp3_p3[1], t0[0]);
+		fp_mul(ctx->fp->fp3_p3[1], ctx->fp->fp3_p[1], ctx->fp->fp3_base[1]);
+		fp_mul(t0[0], ctx->fp->fp3_p3[1], ctx->fp->fp3_p2[1]);
+		fp_neg(ctx->fp->fp3_p3[1], t0[0]);
 		for (int i = -1; i > fp_prime_get_cnr(); i--) {
-			fp_sub(ctx->fp3_p3[1], ctx->fp3_p3[1], t0[0]);
+			fp_sub(ctx->fp->fp3_p3[1], ctx->fp->fp3_p3[1], t0[0]);
 		}
-		fp_mul(ctx->fp3_p3[2], ctx->fp3_p[2], ctx->fp3_p2[2]);
-		fp_mul(ctx->fp3_p3[3], ctx->fp3_p[3], ctx->fp3_base[0]);
-		fp_mul(t0[0], ctx->fp3_p3[3], ctx->fp3_p2[3]);
-		fp_neg(ctx->fp3_p3[3], t0[0]);
+		fp_mul(ctx->fp->fp3_p3[2], ctx->fp->fp3_p[2], ctx->fp->fp3_p2[2]);
+		fp_mul(ctx->fp->fp3_p3[3], ctx->fp->fp3_p[3], ctx->fp->fp3_base[0]);
+		fp_mul(t0[0], ctx->fp->fp3_p3[3], ctx->fp->fp3_p2[3]);
+		fp_neg(ctx->fp->fp3_p3[3], t0[0]);
 		for (int i = -1; i > fp_prime_get_cnr(); i--) {
-			fp_sub(ctx->fp3_p3[3], ctx->fp3_p3[3], t0[0]);
+			fp_sub(ctx->fp->fp3_p3[3], ctx->fp->fp3_p3[3], t0[0]);
 		}
-		fp_mul(ctx->fp3_p3[4], ctx->fp3_p[4], ctx->fp3_base[1]);
-		fp_mul(t0[0], ctx->fp3_p3[4], ctx->fp3_p2[4]);
-		fp_neg(ctx->fp3_p3[4], t0[0]);
+		fp_mul(ctx->fp->fp3_p3[4], ctx->fp->fp3_p[4], ctx->fp->fp3_base[1]);
+		fp_mul(t0[0], ctx->fp->fp3_p3[4], ctx->fp->fp3_p2[4]);
+		fp_neg(ctx->fp->fp3_p3[4], t0[0]);
 		for (int i = -1; i > fp_prime_get_cnr(); i--) {
-			fp_sub(ctx->fp3_p3[4], ctx->fp3_p3[4], t0[0]);
+			fp_sub(ctx->fp->fp3_p3[4], ctx->fp->fp3_p3[4], t0[0]);
 		}
 		for (int i = 0; i < 5; i++) {
-			fp_mul(ctx->fp3_p4[i], ctx->fp3_p[i], ctx->fp3_p3[i]);
-			fp_mul(ctx->fp3_p5[i], ctx->fp3_p2[i], ctx->fp3_p3[i]);
+			fp_mul(ctx->fp->fp3_p4[i], ctx->fp->fp3_p[i], ctx->fp->fp3_p3[i]);
+			fp_mul(ctx->fp->fp3_p5[i], ctx->fp->fp3_p2[i], ctx->fp->fp3_p3[i]);
 		}
 	} CATCH_ANY {
 		THROW(ERR_CAUGHT);
@@ -293,48 +368,61 @@ static void fp3_calc() {
 
 void fp_prime_init() {
 	ctx_t *ctx = core_get();
-	ctx->fp_id = 0;
-	bn_init(&(ctx->prime), FP_DIGS);
+	ctx->fp->id = 0;
+	bn_init(&(ctx->fp->prime), FP_DIGS);
 #if FP_RDC == QUICK || !defined(STRIP)
-	ctx->sps_len = 0;
-	memset(ctx->sps, 0, sizeof(ctx->sps));
+	ctx->fp->sps_len = 0;
+	memset(ctx->fp->sps, 0, sizeof(ctx->fp->sps));
 #endif
 #if FP_RDC == MONTY || !defined(STRIP)
-	bn_init(&(ctx->conv), FP_DIGS);
-	bn_init(&(ctx->one), FP_DIGS);
+	bn_init(&(ctx->fp->conv), FP_DIGS);
+	bn_init(&(ctx->fp->one), FP_DIGS);
 #endif
 }
 
 void fp_prime_clean() {
 	ctx_t *ctx = core_get();
-	ctx->fp_id = 0;
+	ctx->fp->id = 0;
 #if FP_RDC == QUICK || !defined(STRIP)	
-	ctx->sps_len = 0;
-	memset(ctx->sps, 0, sizeof(ctx->sps));
+	ctx->fp->sps_len = 0;
+	memset(ctx->fp->sps, 0, sizeof(ctx->fp->sps));
 #endif
 #if FP_RDC == MONTY || !defined(STRIP)
-	bn_clean(&(ctx->one));
-	bn_clean(&(ctx->conv));
+	bn_clean(&(ctx->fp->one));
+	bn_clean(&(ctx->fp->conv));
 #endif
-	bn_clean(&(ctx->prime));
+	bn_clean(&(ctx->fp->prime));
+}
+
+fp_field_t fp_field_get(void) {
+	return core_get()->fp;
+}
+
+void fp_field_set(fp_field_t field) {
+	ctx_t *ctx = core_get();
+
+	if (field == NULL) {
+		field = &(ctx->fp_def);
+	}
+	ctx->fp = field;
 }
 
 const dig_t *fp_prime_get(void) {
-	return core_get()->prime.dp;
+	return core_get()->fp->prime.dp;
 }
 
 const dig_t *fp_prime_get_rdc(void) {
-	return &(core_get()->u);
+	return &(core_get()->fp->u);
 }
 
 const int *fp_prime_get_sps(int *len) {
 #if FP_RDC == QUICK || !defined(STRIP)
 	ctx_t *ctx = core_get();
-	if (ctx->sps_len > 0 && ctx->sps_len < MAX_TERMS) {
+	if (ctx->fp->sps_len > 0 && ctx->fp->sps_len < MAX_TERMS) {
 		if (len != NULL) {
-			*len = ctx->sps_len;
+			*len = ctx->fp->sps_len;
 		}
-		return ctx->sps;
+		return ctx->fp->sps;
 	} else {
 		if (len != NULL) {
 			*len = 0;
@@ -348,22 +436,22 @@ const int *fp_prime_get_sps(int *len) {
 
 const dig_t *fp_prime_get_conv(void) {
 #if FP_RDC == MONTY || !defined(STRIP)
-	return core_get()->conv.dp;
+	return core_get()->fp->conv.dp;
 #else
 	return NULL;
 #endif
 }
 
 dig_t fp_prime_get_mod8() {
-	return core_get()->mod8;
+	return core_get()->fp->mod8;
 }
 
 int fp_prime_get_qnr() {
-	return core_get()->qnr;
+	return core_get()->fp->qnr;
 }
 
 int fp_prime_get_cnr() {
-	return core_get()->cnr;
+	return core_get()->fp->cnr;
 }
 
 void fp_prime_set_dense(const bn_t p) {
@@ -406,10 +494,10 @@ void fp_prime_set_pmers(const int *f, int len) {
 #if FP_RDC == QUICK || !defined(STRIP)
 		ctx_t *ctx = core_get();
 		for (int i = 0; i < len; i++) {
-			ctx->sps[i] = f[i];
+			ctx->fp->sps[i] = f[i];
 		}
-		ctx->sps[len] = 0;
-		ctx->sps_len = len;
+		ctx->fp->sps[len] = 0;
+		ctx->fp->sps_len = len;
 #endif /* FP_RDC == QUICK */
 
 		fp_prime_set(p);
@@ -443,16 +531,16 @@ void fp_prime_conv(fp_t c, const bn_t a) {
 		bn_new(t);
 
 #if FP_RDC == MONTY
-		bn_mod(t, a, &(core_get()->prime));
+		bn_mod(t, a, &(core_get()->fp->prime));
 		bn_lsh(t, t, FP_DIGS * FP_DIGIT);
-		bn_mod(t, t, &(core_get()->prime));
+		bn_mod(t, t, &(core_get()->fp->prime));
 		dv_copy(c, t->dp, FP_DIGS);
 #else
 		if (a->used > FP_DIGS) {
 			THROW(ERR_NO_PRECI);
 		}
 
-		bn_mod(t, a, &(core_get()->prime));
+		bn_mod(t, a, &(core_get()->fp->prime));
 
 		if (bn_is_zero(t)) {
 			fp_zero(c);
@@ -480,7 +568,7 @@ void fp_prime_conv_dig(fp_t c, dig_t a) {
 	dv_t t;
 	ctx_t *ctx = core_get();
 
-	bn_null(t);
+	dv_null(t);
 
 	TRY {
 		dv_new(t);
@@ -488,10 +576,10 @@ void fp_prime_conv_dig(fp_t c, dig_t a) {
 #if FP_RDC == MONTY
 		if (a != 1) {
 			dv_zero(t, 2 * FP_DIGS + 1);
-			t[FP_DIGS] = fp_mul1_low(t, ctx->conv.dp, a);
+			t[FP_DIGS] = fp_mul1_low(t, ctx->fp->conv.dp, a);
 			fp_rdc(c, t);
 		} else {
-			dv_copy(c, ctx->one.dp, FP_DIGS);
+			dv_copy(c, ctx->fp->one.dp, FP_DIGS);
 		}
 #else
 		(void)ctx;
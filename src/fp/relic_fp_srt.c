@@ -31,101 +31,165 @@
 #include "relic_core.h"
 
 /*============================================================================*/
-/* Public definitions                                                         */
+/* Private definitions                                                        */
 /*============================================================================*/
 
-int fp_srt(fp_t c, const fp_t a) {
-	bn_t e;
-	fp_t t0;
-	fp_t t1;
-	int r = 0;
+/**
+ * Computes c = a^((e - 1)/2), where p - 1 = e * 2^f with e odd, following the
+ * window recoding precomputed when the prime was set.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the prime field element to exponentiate.
+ */
+static void fp_srt_exp(fp_t c, const fp_t a) {
+	ctx_t *ctx = core_get();
+	int i, j, n = 1 << (ctx->fp->srt_wid - 1);
+	fp_t t[n], r;
 
-	bn_null(e);
-	fp_null(t0);
-	fp_null(t1);
+	fp_null(r);
+	for (i = 0; i < n; i++) {
+		fp_null(t[i]);
+	}
 
 	TRY {
-		bn_new(e);
-		fp_new(t0);
-		fp_new(t1);
-
-		/* Make e = p. */
-		e->used = FP_DIGS;
-		dv_copy(e->dp, fp_prime_get(), FP_DIGS);
-
-		if (fp_prime_get_mod8() == 3 || fp_prime_get_mod8() == 7) {
-			/* Easy case, compute a^((p + 1)/4). */
-			bn_add_dig(e, e, 1);
-			bn_rsh(e, e, 2);
-
-			fp_exp(t0, a, e);
-			fp_sqr(t1, t0);
-			r = (fp_cmp(t1, a) == CMP_EQ);
-			fp_copy(c, t0);
-		} else {
-			int f = 0, m = 0;
-
-			/* First, check if there is a root. Compute t1 = a^((p - 1)/2). */
-			bn_rsh(e, e, 1);
-			fp_exp(t0, a, e);
-
-			if (fp_cmp_dig(t0, 1) != CMP_EQ) {
-				/* Nope, there is no square root. */
-				r = 0;
+		for (i = 0; i < n; i++) {
+			fp_new(t[i]);
+		}
+		fp_new(r);
+
+		fp_copy(t[0], a);
+		fp_sqr(r, a);
+		for (i = 1; i < n; i++) {
+			fp_mul(t[i], t[i - 1], r);
+		}
+
+		fp_set_dig(r, 1);
+		for (i = 0; i < ctx->fp->srt_len; i++) {
+			if (ctx->fp->srt_win[i] == 0) {
+				fp_sqr(r, r);
 			} else {
-				r = 1;
-				/* Find a quadratic non-residue modulo p, that is a number t2
-				 * such that (t2 | p) = t2^((p - 1)/2)!= 1. */
-				do {
-					fp_rand(t1);
-					fp_exp(t0, t1, e);
-				} while (fp_cmp_dig(t0, 1) == CMP_EQ);
-
-				/* Write p - 1 as (e * 2^f), odd e. */
-				bn_lsh(e, e, 1);
-				while (bn_is_even(e)) {
-					bn_rsh(e, e, 1);
-					f++;
+				for (j = 0; j < util_bits_dig(ctx->fp->srt_win[i]); j++) {
+					fp_sqr(r, r);
 				}
+				fp_mul(r, r, t[ctx->fp->srt_win[i] >> 1]);
+			}
+		}
+		fp_copy(c, r);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; i < n; i++) {
+			fp_free(t[i]);
+		}
+		fp_free(r);
+	}
+}
 
-				/* Compute t2 = t2^e. */
-				fp_exp(t1, t1, e);
-
-				/* Compute t1 = a^e, c = a^((e + 1)/2) = a^(e/2 + 1), odd e. */
-				bn_rsh(e, e, 1);
-				fp_exp(t0, a, e);
-				fp_mul(e->dp, t0, a);
-				fp_sqr(t0, t0);
-				fp_mul(t0, t0, a);
-				fp_copy(c, e->dp);
-
-				while (1) {
-					if (fp_cmp_dig(t0, 1) == CMP_EQ) {
-						break;
-					}
-					fp_copy(e->dp, t0);
-					for (m = 0; (m < f) && (fp_cmp_dig(t0, 1) != CMP_EQ); m++) {
-						fp_sqr(t0, t0);
-					}
-					fp_copy(t0, e->dp);
-					for (int i = 0; i < f - m - 1; i++) {
-						fp_sqr(t1, t1);
-					}
-					fp_mul(c, c, t1);
-					fp_sqr(t1, t1);
-					fp_mul(t0, t0, t1);
-					f = m;
-				}
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+int fp_is_sqr(const fp_t a) {
+	fp_t t, one;
+	int i, r = 1;
+
+	if (fp_is_zero(a)) {
+		return 1;
+	}
+
+	fp_null(t);
+	fp_null(one);
+
+	TRY {
+		fp_new(t);
+		fp_new(one);
+
+		/* Compute a^e from a^((e - 1)/2), then (a | p) = a^(e * 2^(f - 1)). */
+		fp_srt_exp(t, a);
+		fp_sqr(t, t);
+		fp_mul(t, t, a);
+		for (i = 1; i < core_get()->fp->ad2; i++) {
+			fp_sqr(t, t);
+		}
+		fp_set_dig(one, 1);
+		r = (fp_cmp(t, one) == CMP_EQ);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp_free(t);
+		fp_free(one);
+	}
+	return r;
+}
+
+int fp_srt(fp_t c, const fp_t a) {
+	fp_t x, b, z, t, one;
+	int i, j, m, r = 1;
+	ctx_t *ctx = core_get();
+
+	if (fp_is_zero(a)) {
+		fp_zero(c);
+		return 1;
+	}
+
+	fp_null(x);
+	fp_null(b);
+	fp_null(z);
+	fp_null(t);
+	fp_null(one);
+
+	TRY {
+		fp_new(x);
+		fp_new(b);
+		fp_new(z);
+		fp_new(t);
+		fp_new(one);
+
+		/* Compute b = a^e and x = a^((e + 1)/2), so that x^2 = a * b. */
+		fp_srt_exp(x, a);
+		fp_sqr(b, x);
+		fp_mul(b, b, a);
+		fp_mul(x, x, a);
+
+		/* Tonelli-Shanks: move b into smaller subgroups of order 2^m. When
+		 * p = 3 mod 4 there is a single step and x = a^((p + 1)/4). */
+		fp_copy(z, ctx->fp->root);
+		fp_set_dig(one, 1);
+		m = ctx->fp->ad2;
+		while (fp_cmp(b, one) != CMP_EQ) {
+			/* Find the least i such that b^(2^i) = 1. */
+			fp_copy(t, b);
+			for (i = 0; i < m && fp_cmp(t, one) != CMP_EQ; i++) {
+				fp_sqr(t, t);
+			}
+			if (i == m) {
+				/* The order of b is 2^m, so a is not a square. */
+				r = 0;
+				break;
+			}
+			for (j = 0; j < m - i - 1; j++) {
+				fp_sqr(z, z);
 			}
+			fp_mul(x, x, z);
+			fp_sqr(z, z);
+			fp_mul(b, b, z);
+			m = i;
 		}
+		fp_copy(c, x);
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
 	}
 	FINALLY {
-		bn_free(e);
-		fp_free(t0);
-		fp_free(t1);
+		fp_free(x);
+		fp_free(b);
+		fp_free(z);
+		fp_free(t);
+		fp_free(one);
 	}
 	return r;
 }
@@ -41,14 +41,14 @@ void fp2_mul_frb(fp2_t c, fp2_t a, int i, int j) {
 	ctx_t *ctx = core_get();
 
 	if (i == 2) {
-		fp_mul(c[0], a[0], ctx->fp2_p2[j - 1]);
-		fp_mul(c[1], a[1], ctx->fp2_p2[j - 1]);
+		fp_mul(c[0], a[0], ctx->fp->fp2_p2[j - 1]);
+		fp_mul(c[1], a[1], ctx->fp->fp2_p2[j - 1]);
 	} else {
 #if ALLOC == AUTO
 		if (i == 1) {
-			fp2_mul(c, a, ctx->fp2_p[j - 1]);
+			fp2_mul(c, a, ctx->fp->fp2_p[j - 1]);
 		} else {
-			fp2_mul(c, a, ctx->fp2_p3[j - 1]);
+			fp2_mul(c, a, ctx->fp->fp2_p3[j - 1]);
 		}
 #else
 		fp2_t t;
@@ -58,11 +58,11 @@ void fp2_mul_frb(fp2_t c, fp2_t a, int i, int j) {
 		TRY {
 			fp2_new(t);
 			if (i == 1) {
-				fp_copy(t[0], ctx->fp2_p[j - 1][0]);
-				fp_copy(t[1], ctx->fp2_p[j - 1][1]);
+				fp_copy(t[0], ctx->fp->fp2_p[j - 1][0]);
+				fp_copy(t[1], ctx->fp->fp2_p[j - 1][1]);
 			} else {
-				fp_copy(t[0], ctx->fp2_p3[j - 1][0]);
-				fp_copy(t[1], ctx->fp2_p3[j - 1][1]);
+				fp_copy(t[0], ctx->fp->fp2_p3[j - 1][0]);
+				fp_copy(t[1], ctx->fp->fp2_p3[j - 1][1]);
 			}
 			fp2_mul(c, a, t);
 		}
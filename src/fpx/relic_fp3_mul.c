@@ -170,13 +170,13 @@ void fp3_mul_frb(fp3_t c, fp3_t a, int i, int j, int k) {
 			break;
 		case 1:
 			fp_copy(c[0], a[0]);
-			fp_mul(c[1], a[1], ctx->fp3_base[0]);
-			fp_mul(c[2], a[2], ctx->fp3_base[1]);
+			fp_mul(c[1], a[1], ctx->fp->fp3_base[0]);
+			fp_mul(c[2], a[2], ctx->fp->fp3_base[1]);
 			break;
 		case 2:
 			fp_copy(c[0], a[0]);
-			fp_mul(c[1], a[1], ctx->fp3_base[1]);
-			fp_mul(c[2], a[2], ctx->fp3_base[0]);
+			fp_mul(c[1], a[1], ctx->fp->fp3_base[1]);
+			fp_mul(c[2], a[2], ctx->fp->fp3_base[0]);
 			break;
 		}
 	} else {
@@ -185,9 +185,9 @@ void fp3_mul_frb(fp3_t c, fp3_t a, int i, int j, int k) {
 				fp3_copy(c, a);
 				break;
 			case 1:
-				fp_mul(c[0], a[0], ctx->fp3_p[k - 1]);
-				fp_mul(c[1], a[1], ctx->fp3_p[k - 1]);
-				fp_mul(c[2], a[2], ctx->fp3_p[k - 1]);
+				fp_mul(c[0], a[0], ctx->fp->fp3_p[k - 1]);
+				fp_mul(c[1], a[1], ctx->fp->fp3_p[k - 1]);
+				fp_mul(c[2], a[2], ctx->fp->fp3_p[k - 1]);
 				if (k != 3) {
 					for (int l = 0; l < 3 - (k % 3); l++) {
 						fp3_mul_art(c, c);
@@ -195,22 +195,22 @@ void fp3_mul_frb(fp3_t c, fp3_t a, int i, int j, int k) {
 				}
 				break;
 			case 2:
-				fp_mul(c[0], a[0], ctx->fp3_p2[k - 1]);
-				fp_mul(c[1], a[1], ctx->fp3_p2[k - 1]);
-				fp_mul(c[2], a[2], ctx->fp3_p2[k - 1]);
+				fp_mul(c[0], a[0], ctx->fp->fp3_p2[k - 1]);
+				fp_mul(c[1], a[1], ctx->fp->fp3_p2[k - 1]);
+				fp_mul(c[2], a[2], ctx->fp->fp3_p2[k - 1]);
 				for (int l = 0; l < (k % 3); l++) {
 					fp3_mul_art(c, c);
 				}
 				break;
 			case 3:
-				fp_mul(c[0], a[0], ctx->fp3_p3[k - 1]);
-				fp_mul(c[1], a[1], ctx->fp3_p3[k - 1]);
-				fp_mul(c[2], a[2], ctx->fp3_p3[k - 1]);
+				fp_mul(c[0], a[0], ctx->fp->fp3_p3[k - 1]);
+				fp_mul(c[1], a[1], ctx->fp->fp3_p3[k - 1]);
+				fp_mul(c[2], a[2], ctx->fp->fp3_p3[k - 1]);
 				break;
 			case 4:
-				fp_mul(c[0], a[0], ctx->fp3_p4[k - 1]);
-				fp_mul(c[1], a[1], ctx->fp3_p4[k - 1]);
-				fp_mul(c[2], a[2], ctx->fp3_p4[k - 1]);
+				fp_mul(c[0], a[0], ctx->fp->fp3_p4[k - 1]);
+				fp_mul(c[1], a[1], ctx->fp->fp3_p4[k - 1]);
+				fp_mul(c[2], a[2], ctx->fp->fp3_p4[k - 1]);
 				if (k != 3) {
 					for (int l = 0; l < 3 - (k % 3); l++) {
 						fp3_mul_art(c, c);
@@ -218,9 +218,9 @@ void fp3_mul_frb(fp3_t c, fp3_t a, int i, int j, int k) {
 				}
 				break;
 			case 5:
-				fp_mul(c[0], a[0], ctx->fp3_p5[k - 1]);
-				fp_mul(c[1], a[1], ctx->fp3_p5[k - 1]);
-				fp_mul(c[2], a[2], ctx->fp3_p5[k - 1]);
+				fp_mul(c[0], a[0], ctx->fp->fp3_p5[k - 1]);
+				fp_mul(c[1], a[1], ctx->fp->fp3_p5[k - 1]);
+				fp_mul(c[2], a[2], ctx->fp->fp3_p5[k - 1]);
 				for (int l = 0; l < (k % 3); l++) {
 					fp3_mul_art(c, c);
 				}
@@ -328,6 +328,138 @@ void fp12_exp_cyc(fp12_t c, fp12_t a, bn_t b) {
 	}
 }
 
+void fp12_exp_cyc_gls(fp12_t c, fp12_t a, bn_t b) {
+	int i, j, l, _l[4];
+	int8_t naf[4][FP_BITS + 1];
+	bn_t n, u, _b[4];
+	fp12_t s, t[4][1 << (FP_WIDTH - 2)];
+
+#ifdef CHECK
+	if (!fp12_test_cyc(a)) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+#endif
+
+	switch (fp_param_get()) {
+		case BN_158:
+		case BN_254:
+		case BN_256:
+		case BN_638:
+			break;
+		default:
+			/* The generic method takes the absolute value of the exponent. */
+			fp12_exp_cyc(c, a, b);
+			if (bn_sign(b) == BN_NEG) {
+				fp12_inv_uni(c, c);
+			}
+			return;
+	}
+
+	if (bn_is_zero(b)) {
+		fp12_set_dig(c, 1);
+		return;
+	}
+
+	bn_null(n);
+	bn_null(u);
+	fp12_null(s);
+
+	TRY {
+		bn_new(n);
+		bn_new(u);
+		fp12_new(s);
+		for (i = 0; i < 4; i++) {
+			bn_null(_b[i]);
+			bn_new(_b[i]);
+			for (j = 0; j < (1 << (FP_WIDTH - 2)); j++) {
+				fp12_null(t[i][j]);
+				fp12_new(t[i][j]);
+			}
+		}
+
+		/* Compute the order n = 36u^4 + 36u^3 + 18u^2 + 6u + 1. */
+		fp_param_get_var(u);
+		bn_mul_dig(n, u, 6);
+		bn_add_dig(n, n, 6);
+		bn_mul(n, n, u);
+		bn_add_dig(n, n, 3);
+		bn_mul(n, n, u);
+		bn_mul_dig(n, n, 6);
+		bn_add_dig(n, n, 6);
+		bn_mul(n, n, u);
+		bn_add_dig(n, n, 1);
+
+		bn_abs(_b[0], b);
+		bn_rec_frb(_b, _b[0], u, n);
+
+		/* Precompute the odd powers of a and their Frobenius images. */
+		fp12_sqr_cyc(s, a);
+		fp12_copy(t[0][0], a);
+		for (j = 1; j < (1 << (FP_WIDTH - 2)); j++) {
+			fp12_mul(t[0][j], t[0][j - 1], s);
+		}
+		for (i = 1; i < 4; i++) {
+			for (j = 0; j < (1 << (FP_WIDTH - 2)); j++) {
+				fp12_frb(t[i][j], t[i - 1][j], 1);
+			}
+		}
+		for (i = 0; i < 4; i++) {
+			if (bn_sign(_b[i]) == BN_NEG) {
+				bn_neg(_b[i], _b[i]);
+				for (j = 0; j < (1 << (FP_WIDTH - 2)); j++) {
+					fp12_inv_uni(t[i][j], t[i][j]);
+				}
+			}
+		}
+
+		l = 0;
+		for (i = 0; i < 4; i++) {
+			_l[i] = FP_BITS + 1;
+			bn_rec_naf(naf[i], &_l[i], _b[i], FP_WIDTH);
+			l = MAX(l, _l[i]);
+		}
+		for (i = 0; i < 4; i++) {
+			for (j = _l[i]; j < l; j++) {
+				naf[i][j] = 0;
+			}
+		}
+
+		fp12_set_dig(s, 1);
+		for (j = l - 1; j >= 0; j--) {
+			fp12_sqr_cyc(s, s);
+			for (i = 0; i < 4; i++) {
+				if (naf[i][j] > 0) {
+					fp12_mul(s, s, t[i][naf[i][j] / 2]);
+				}
+				if (naf[i][j] < 0) {
+					fp12_inv_uni(c, t[i][-naf[i][j] / 2]);
+					fp12_mul(s, s, c);
+				}
+			}
+		}
+		if (bn_sign(b) == BN_NEG) {
+			fp12_inv_uni(c, s);
+		} else {
+			fp12_copy(c, s);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+		bn_free(u);
+		fp12_free(s);
+		for (i = 0; i < 4; i++) {
+			bn_free(_b[i]);
+			for (j = 0; j < (1 << (FP_WIDTH - 2)); j++) {
+				fp12_free(t[i][j]);
+			}
+		}
+	}
+}
+
 void fp12_exp_cyc_sps(fp12_t c, fp12_t a, int *b, int len) {
 	int i, j, k, w = len;
 	fp12_t t, u[w];
@@ -480,22 +612,33 @@ void fp12_back_cyc(fp12_t c, fp12_t a) {
 		fp2_new(t1);
 		fp2_new(t2);
 
-		/* t0 = g4^2. */
-		fp2_sqr(t0, a[0][1]);
-		/* t1 = 3 * g4^2 - 2 * g3. */
-		fp2_sub(t1, t0, a[0][2]);
-		fp2_dbl(t1, t1);
-		fp2_add(t1, t1, t0);
-		/* t0 = E * g5^2 + t1. */
-		fp2_sqr(t2, a[1][2]);
-		fp2_mul_nor(t0, t2);
-		fp2_add(t0, t0, t1);
-		/* t1 = 1/(4 * g2). */
-		fp2_dbl(t1, a[1][0]);
-		fp2_dbl(t1, t1);
-		fp2_inv(t1, t1);
-		/* c_1 = g1. */
-		fp2_mul(c[1][1], t0, t1);
+		if (!fp2_is_zero(a[1][0])) {
+			/* t0 = g4^2. */
+			fp2_sqr(t0, a[0][1]);
+			/* t1 = 3 * g4^2 - 2 * g3. */
+			fp2_sub(t1, t0, a[0][2]);
+			fp2_dbl(t1, t1);
+			fp2_add(t1, t1, t0);
+			/* t0 = E * g5^2 + t1. */
+			fp2_sqr(t2, a[1][2]);
+			fp2_mul_nor(t0, t2);
+			fp2_add(t0, t0, t1);
+			/* t1 = 1/(4 * g2). */
+			fp2_dbl(t1, a[1][0]);
+			fp2_dbl(t1, t1);
+			fp2_inv(t1, t1);
+			/* c_1 = g1. */
+			fp2_mul(c[1][1], t0, t1);
+		} else if (!fp2_is_zero(a[0][2])) {
+			/* If g2 = 0, then g1 = (2 * g4 * g5)/g3. */
+			fp2_mul(t0, a[0][1], a[1][2]);
+			fp2_dbl(t0, t0);
+			fp2_inv(t1, a[0][2]);
+			fp2_mul(c[1][1], t0, t1);
+		} else {
+			/* If g2 = g3 = 0, the element is trivial and g1 = 0. */
+			fp2_zero(c[1][1]);
+		}
 
 		/* t1 = g3 * g4. */
 		fp2_mul(t1, a[0][2], a[0][1]);
@@ -543,19 +686,30 @@ void fp12_back_cyc_sim(fp12_t c[], fp12_t a[], int n) {
 		}
 
 		for (int i = 0; i < n; i++) {
-			/* t0 = g4^2. */
-			fp2_sqr(t0[i], a[i][0][1]);
-			/* t1 = 3 * g4^2 - 2 * g3. */
-			fp2_sub(t1[i], t0[i], a[i][0][2]);
-			fp2_dbl(t1[i], t1[i]);
-			fp2_add(t1[i], t1[i], t0[i]);
-			/* t0 = E * g5^2 + t1. */
-			fp2_sqr(t2[i], a[i][1][2]);
-			fp2_mul_nor(t0[i], t2[i]);
-			fp2_add(t0[i], t0[i], t1[i]);
-			/* t1 = (4 * g2). */
-			fp2_dbl(t1[i], a[i][1][0]);
-			fp2_dbl(t1[i], t1[i]);
+			if (!fp2_is_zero(a[i][1][0])) {
+				/* t0 = g4^2. */
+				fp2_sqr(t0[i], a[i][0][1]);
+				/* t1 = 3 * g4^2 - 2 * g3. */
+				fp2_sub(t1[i], t0[i], a[i][0][2]);
+				fp2_dbl(t1[i], t1[i]);
+				fp2_add(t1[i], t1[i], t0[i]);
+				/* t0 = E * g5^2 + t1. */
+				fp2_sqr(t2[i], a[i][1][2]);
+				fp2_mul_nor(t0[i], t2[i]);
+				fp2_add(t0[i], t0[i], t1[i]);
+				/* t1 = (4 * g2). */
+				fp2_dbl(t1[i], a[i][1][0]);
+				fp2_dbl(t1[i], t1[i]);
+			} else if (!fp2_is_zero(a[i][0][2])) {
+				/* If g2 = 0, then t0 = 2 * g4 * g5 and t1 = g3. */
+				fp2_mul(t0[i], a[i][0][1], a[i][1][2]);
+				fp2_dbl(t0[i], t0[i]);
+				fp2_copy(t1[i], a[i][0][2]);
+			} else {
+				/* If g2 = g3 = 0, the element is trivial and g1 = 0. */
+				fp2_zero(t0[i]);
+				fp2_set_dig(t1[i], 1);
+			}
 		}
 
 		/* t1 = 1 / t1. */
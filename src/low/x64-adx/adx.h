@@ -0,0 +1,95 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2015 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * RELIC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with RELIC. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Runtime detection of the MULX, ADCX and ADOX instructions.
+ *
+ * @ingroup fp
+ */
+
+#ifndef RELIC_ADX_H
+#define RELIC_ADX_H
+
+#include <cpuid.h>
+
+#include "relic_types.h"
+
+/*============================================================================*/
+/* Function prototypes                                                        */
+/*============================================================================*/
+
+/**
+ * Multiplies two digit vectors of FP_DIGS digits. Computes c = a * b.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the first digit vector to multiply.
+ * @param[in] b				- the second digit vector to multiply.
+ */
+void fp_muln_adx(dig_t *c, const dig_t *a, const dig_t *b);
+
+/**
+ * Squares a digit vector of FP_DIGS digits. Computes c = a * a.
+ *
+ * @param[out] c			- the result.
+ * @param[in] a				- the digit vector to square.
+ */
+void fp_sqrn_adx(dig_t *c, const dig_t *a);
+
+/**
+ * Computes the Montgomery reduction of a digit vector without the final
+ * subtraction. The input vector is overwritten.
+ *
+ * @param[out] c			- the result.
+ * @param[in,out] a			- the digit vector to reduce.
+ * @param[in] m				- the modulus.
+ * @param[in] u				- the Montgomery reduction constant.
+ * @return the carry out of the most significant digit.
+ */
+dig_t fp_rdcn_adx(dig_t *c, dig_t *a, const dig_t *m, dig_t u);
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Checks if the processor supports the BMI2 and ADX extensions. The answer is
+ * cached after the first call.
+ *
+ * @return 1 if MULX, ADCX and ADOX can be used, 0 otherwise.
+ */
+static inline int fp_adx_low(void) {
+	static int adx = -1;
+	unsigned int a, b, c, d;
+
+	if (adx == -1) {
+		adx = 0;
+		if (__get_cpuid_count(7, 0, &a, &b, &c, &d)) {
+			/* BMI2 is bit 8 and ADX is bit 19 of EBX. */
+			adx = ((b >> 8) & (b >> 19)) & 1;
+		}
+	}
+	return adx;
+}
+
+#endif /* !RELIC_ADX_H */
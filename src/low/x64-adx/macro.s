@@ -0,0 +1,158 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2015 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * RELIC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with RELIC. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Macros for prime field arithmetic with the MULX, ADCX and ADOX instructions.
+ *
+ * @ingroup fp
+ */
+
+#include "relic_fp_low.h"
+
+#if WORD != 64
+#error "The x64-adx backend requires 64-bit digits."
+#endif
+
+/*
+ * All the macros below are unrolled for FP_DIGS digits by the assembler. The
+ * MULX instruction multiplies by %rdx without touching the flags, so that two
+ * independent carry chains can be kept in CF (through ADCX) and OF (through
+ * ADOX) at the same time.
+ */
+
+/* Zeroes N digits of C starting from digit I. Uses %rax. */
+.macro ZERO_DIGS C, I, N
+	movq	%rax, 8*(\I)(\C)
+	.if \N - 1
+		ZERO_DIGS \C, "(\I + 1)", "(\N - 1)"
+	.endif
+.endm
+
+/* Copies N digits of A starting from digit J to C starting from digit I. */
+.macro COPY_DIGS C, I, A, J, N
+	movq	8*(\J)(\A), %rax
+	movq	%rax, 8*(\I)(\C)
+	.if \N - 1
+		COPY_DIGS \C, "(\I + 1)", \A, "(\J + 1)", "(\N - 1)"
+	.endif
+.endm
+
+/*
+ * Accumulates %rdx * A[J] in C[I]. The low half is added in the CF chain and
+ * the high half of the previous product, kept in %r10, in the OF chain.
+ * Uses %rax, %r9, %r10 and %r11.
+ */
+.macro MULX_STEP C, I, A, J
+	movq	8*(\I)(\C), %r11
+	mulxq	8*(\J)(\A), %rax, %r9
+	adcxq	%rax, %r11
+	adoxq	%r10, %r11
+	movq	%r9, %r10
+	movq	%r11, 8*(\I)(\C)
+.endm
+
+/*
+ * Accumulates %rdx * (A[J], ..., A[J + N - 1]) in (C[I], ..., C[I + N - 1]),
+ * leaving the last high half in %r10 and the carries in CF and OF. Flags and
+ * %r10 must be cleared before the first step.
+ */
+.macro MULX_ROW C, I, A, J, N
+	MULX_STEP \C, \I, \A, \J
+	.if \N - 1
+		MULX_ROW \C, "(\I + 1)", \A, "(\J + 1)", "(\N - 1)"
+	.endif
+.endm
+
+/* Stores the last high half and both pending carries in the fresh digit C[I]. */
+.macro MULX_TOP C, I
+	movq	$0, %r11
+	adcxq	%r11, %r11
+	adoxq	%r10, %r11
+	movq	%r11, 8*(\I)(\C)
+.endm
+
+/* Computes the rows I, ..., N - 1 of the product of A and B into C. */
+.macro MULN_ROWS C, A, B, I, N
+	movq	8*(\I)(\B), %rdx
+	xorq	%r10, %r10
+	MULX_ROW \C, \I, \A, 0, \N
+	MULX_TOP \C, "(\I + \N)"
+	.if \N - \I - 1
+		MULN_ROWS \C, \A, \B, "(\I + 1)", \N
+	.endif
+.endm
+
+/* Computes the rows I, ..., N - 2 of the cross products A[I] * A[J], J > I. */
+.macro SQRN_ROWS C, A, I, N
+	movq	8*(\I)(\A), %rdx
+	xorq	%r10, %r10
+	MULX_ROW \C, "(2 * \I + 1)", \A, "(\I + 1)", "(\N - \I - 1)"
+	MULX_TOP \C, "(\I + \N)"
+	.if \N - \I - 2
+		SQRN_ROWS \C, \A, "(\I + 1)", \N
+	.endif
+.endm
+
+/*
+ * Doubles the cross products in C[2I] and C[2I + 1] in the CF chain and adds
+ * the square A[I]^2 in the OF chain, for digits I to N - 1.
+ */
+.macro SQRN_DIAG C, A, I, N
+	movq	8*(\I)(\A), %rdx
+	mulxq	%rdx, %rax, %r9
+	movq	8*(2 * \I)(\C), %r11
+	adcxq	%r11, %r11
+	adoxq	%rax, %r11
+	movq	%r11, 8*(2 * \I)(\C)
+	movq	8*(2 * \I + 1)(\C), %r11
+	adcxq	%r11, %r11
+	adoxq	%r9, %r11
+	movq	%r11, 8*(2 * \I + 1)(\C)
+	.if \N - \I - 1
+		SQRN_DIAG \C, \A, "(\I + 1)", \N
+	.endif
+.endm
+
+/*
+ * Computes the Montgomery reduction rows I, ..., N - 1 of A in place, using the
+ * modulus M and the constant U. The carry out of the most significant digit
+ * is accumulated in %rbx.
+ */
+.macro RDCN_ROWS A, M, U, I, N
+	movq	8*(\I)(\A), %rdx
+	imulq	\U, %rdx
+	xorq	%r10, %r10
+	MULX_ROW \A, \I, \M, 0, \N
+	movq	8*(\I + \N)(\A), %r11
+	adcxq	%rbx, %r11
+	movq	$0, %rbx
+	adoxq	%r10, %r11
+	movq	%r11, 8*(\I + \N)(\A)
+	adcxq	%rbx, %rbx
+	movq	$0, %r9
+	adoxq	%r9, %rbx
+	.if \N - \I - 1
+		RDCN_ROWS \A, \M, \U, "(\I + 1)", \N
+	.endif
+.endm
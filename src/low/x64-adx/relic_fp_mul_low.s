@@ -0,0 +1,46 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2015 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * RELIC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with RELIC. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level prime field multiplication functions.
+ *
+ * @ingroup fp
+ */
+
+#include "macro.s"
+
+.text
+.global fp_muln_adx
+
+/*
+ * Function: fp_muln_adx
+ * Inputs: rdi = c, rsi = a, rdx = b
+ * Output: c = a * b
+ */
+fp_muln_adx:
+	movq	%rdx, %rcx
+	xorq	%rax, %rax
+	ZERO_DIGS %rdi, 0, FP_DIGS
+	MULN_ROWS %rdi, %rsi, %rcx, 0, FP_DIGS
+	ret
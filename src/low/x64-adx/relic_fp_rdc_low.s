@@ -0,0 +1,49 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2015 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * RELIC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with RELIC. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the low-level prime field modular reduction functions.
+ *
+ * @ingroup fp
+ */
+
+#include "macro.s"
+
+.text
+.global fp_rdcn_adx
+
+/*
+ * Function: fp_rdcn_adx
+ * Inputs: rdi = c, rsi = a, rdx = m, rcx = u
+ * Output: c = a * R^(-1) mod m, up to a final subtraction, and the carry in rax
+ */
+fp_rdcn_adx:
+	push	%rbx
+	movq	%rdx, %r8
+	xorq	%rbx, %rbx
+	RDCN_ROWS %rsi, %r8, %rcx, 0, FP_DIGS
+	COPY_DIGS %rdi, 0, %rsi, FP_DIGS, FP_DIGS
+	movq	%rbx, %rax
+	pop	%rbx
+	ret
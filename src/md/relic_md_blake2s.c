@@ -46,6 +46,24 @@ void md_map_blake2s_160(uint8_t *hash, const uint8_t *msg, int len) {
 	blake2s(hash, msg, 0, 20, len, 0);
 }
 
+void md_init_blake2s_160(md_ctx_t ctx) {
+	if (blake2s_init((blake2s_state *)ctx->u.state, 20) != 0) {
+		THROW(ERR_NO_VALID);
+	}
+}
+
+void md_update_blake2s_160(md_ctx_t ctx, const uint8_t *msg, int len) {
+	if (blake2s_update((blake2s_state *)ctx->u.state, msg, len) != 0) {
+		THROW(ERR_NO_VALID);
+	}
+}
+
+void md_final_blake2s_160(uint8_t *hash, md_ctx_t ctx) {
+	if (blake2s_final((blake2s_state *)ctx->u.state, hash, 20) != 0) {
+		THROW(ERR_NO_VALID);
+	}
+}
+
 #endif
 
 #if MD_MAP == BLAKE2S_256 || !defined(STRIP)
@@ -54,4 +72,22 @@ void md_map_blake2s_256(uint8_t *hash, const uint8_t *msg, int len) {
 	blake2s(hash, msg, 0, 32, len, 0);
 }
 
+void md_init_blake2s_256(md_ctx_t ctx) {
+	if (blake2s_init((blake2s_state *)ctx->u.state, 32) != 0) {
+		THROW(ERR_NO_VALID);
+	}
+}
+
+void md_update_blake2s_256(md_ctx_t ctx, const uint8_t *msg, int len) {
+	if (blake2s_update((blake2s_state *)ctx->u.state, msg, len) != 0) {
+		THROW(ERR_NO_VALID);
+	}
+}
+
+void md_final_blake2s_256(uint8_t *hash, md_ctx_t ctx) {
+	if (blake2s_final((blake2s_state *)ctx->u.state, hash, 32) != 0) {
+		THROW(ERR_NO_VALID);
+	}
+}
+
 #endif
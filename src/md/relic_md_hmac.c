@@ -35,36 +35,51 @@
 #include "relic_util.h"
 #include "relic_md.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Size in bytes of the input block of the chosen hash function.
+ */
+#if MD_MAP == SH384 || MD_MAP == SH512
+#define MD_BLOCK	128
+#else
+#define MD_BLOCK	64
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
 void md_hmac(uint8_t *mac, const uint8_t *in, int in_len, const uint8_t *key,
 		int key_len) {
-#if MD_MAP == SHONE || MD_MAP == SH224 || MD_MAP == SH256 || MD_MAP == BLAKE2S_160 || MD_MAP == BLAKE2S_256
-	int block_size = 64;
-#elif MD_MAP == SH384 || MD_MAP == SH512
-	int block_size = 128;
-#endif
-	uint8_t opad[block_size + MD_LEN], ipad[block_size + in_len];
+	uint8_t _key[MD_BLOCK], pad[MD_BLOCK], h[MD_LEN];
+	md_ctx_t ctx;
+	int i;
 
-	if (key_len > block_size) {
-		uint8_t _key[MD_LEN];
+	memset(_key, 0, MD_BLOCK);
+	if (key_len > MD_BLOCK) {
 		md_map(_key, key, key_len);
-		key = _key;
-		key_len = MD_LEN;
-	}
-	if (key_len < block_size) {
-		uint8_t _key[block_size];
+	} else {
 		memcpy(_key, key, key_len);
-		memset(_key + key_len, 0, block_size - key_len);
-		key = _key;
 	}
-	for (int i = 0; i < block_size; i++) {
-		opad[i] = 0x5C ^ key[i];
-		ipad[i] = 0x36 ^ key[i];
+
+	/* Compute H((K ^ ipad) || in), hashing the input in place. */
+	for (i = 0; i < MD_BLOCK; i++) {
+		pad[i] = 0x36 ^ _key[i];
+	}
+	md_init(ctx);
+	md_update(ctx, pad, MD_BLOCK);
+	md_update(ctx, in, in_len);
+	md_final(h, ctx);
+
+	/* Compute H((K ^ opad) || H((K ^ ipad) || in)). */
+	for (i = 0; i < MD_BLOCK; i++) {
+		pad[i] = 0x5C ^ _key[i];
 	}
-	memcpy(ipad + block_size, in, in_len);
-	md_map(opad + block_size, ipad, block_size + in_len);
-	md_map(mac, opad, block_size + MD_LEN);
+	md_init(ctx);
+	md_update(ctx, pad, MD_BLOCK);
+	md_update(ctx, h, MD_LEN);
+	md_final(mac, ctx);
 }
@@ -36,43 +36,52 @@
 #include "relic_md.h"
 
 /*============================================================================*/
-/* Public definitions                                                         */
+/* Private definitions                                                        */
 /*============================================================================*/
 
-void md_kdf1(uint8_t *key, int key_len, const uint8_t *in,
-		int in_len) {
-	uint32_t i, j, d;
-	uint8_t buffer[in_len + sizeof(uint32_t)];
-	uint8_t t[key_len + MD_LEN];
+/**
+ * Derives a key by concatenating hash(z || c) for consecutive counters c,
+ * starting from a given counter.
+ *
+ * @param[out] key				- the resulting key.
+ * @param[in] key_len			- the intended key length in bytes.
+ * @param[in] in				- the shared secret.
+ * @param[in] in_len			- the length of the shared secret in bytes.
+ * @param[in] first				- the first counter.
+ */
+static void md_kdf(uint8_t *key, int key_len, const uint8_t *in, int in_len,
+		uint32_t first) {
+	uint32_t i, j;
+	uint8_t t[MD_LEN];
+	md_ctx_t ctx;
 
-	/* d = ceil(kLen/hLen). */
-	d = CEIL(key_len, MD_LEN);
-	memcpy(buffer, in, in_len);
-	for (i = 0; i < d; i++) {
+	for (i = first; key_len > 0; i++) {
 		j = util_conv_big(i);
-		/* c = integer_to_string(c, 4). */
-		memcpy(buffer + in_len, &j, sizeof(uint32_t));
-		/* t = t || hash(z || c). */
-		md_map(t + i * MD_LEN, buffer, in_len + sizeof(uint32_t));
+		/* t = hash(z || integer_to_string(c, 4)). */
+		md_init(ctx);
+		md_update(ctx, in, in_len);
+		md_update(ctx, (uint8_t *)&j, sizeof(uint32_t));
+		if (key_len >= MD_LEN) {
+			md_final(key, ctx);
+		} else {
+			md_final(t, ctx);
+			memcpy(key, t, key_len);
+		}
+		key += MD_LEN;
+		key_len -= MD_LEN;
 	}
-	memcpy(key, t, key_len);
 }
 
-void md_kdf2(uint8_t *key, int key_len, const uint8_t *in,
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void md_kdf1(uint8_t *key, int key_len, const uint8_t *in,
 		int in_len) {
-	uint32_t i, j, d;
-	uint8_t buffer[in_len + sizeof(uint32_t)];
-	uint8_t t[key_len + MD_LEN];
+	md_kdf(key, key_len, in, in_len, 0);
+}
 
-	/* d = ceil(kLen/hLen). */
-	d = CEIL(key_len, MD_LEN);
-	memcpy(buffer, in, in_len);
-	for (i = 1; i <= d; i++) {
-		j = util_conv_big(i);
-		/* c = integer_to_string(c, 4). */
-		memcpy(buffer + in_len, &j, sizeof(uint32_t));
-		/* t = t || hash(z || c). */
-		md_map(t + (i - 1) * MD_LEN, buffer, in_len + sizeof(uint32_t));
-	}
-	memcpy(key, t, key_len);
+void md_kdf2(uint8_t *key, int key_len, const uint8_t *in,
+		int in_len) {
+	md_kdf(key, key_len, in, in_len, 1);
 }
@@ -56,6 +56,24 @@ void md_map_shone(uint8_t *hash, const uint8_t *msg, int len) {
 	}
 }
 
+void md_init_shone(md_ctx_t ctx) {
+	if (SHA1Reset((SHA1Context *)ctx->u.state) != shaSuccess) {
+		THROW(ERR_NO_VALID);
+	}
+}
+
+void md_update_shone(md_ctx_t ctx, const uint8_t *msg, int len) {
+	if (SHA1Input((SHA1Context *)ctx->u.state, msg, len) != shaSuccess) {
+		THROW(ERR_NO_VALID);
+	}
+}
+
+void md_final_shone(uint8_t *hash, md_ctx_t ctx) {
+	if (SHA1Result((SHA1Context *)ctx->u.state, hash) != shaSuccess) {
+		THROW(ERR_NO_VALID);
+	}
+}
+
 #endif
 
 #if RAND == FIPS
@@ -53,4 +53,22 @@ void md_map_sh256(uint8_t *hash, const uint8_t *msg, int len) {
 	}
 }
 
+void md_init_sh256(md_ctx_t ctx) {
+	if (SHA256Reset((SHA256Context *)ctx->u.state) != shaSuccess) {
+		THROW(ERR_NO_VALID);
+	}
+}
+
+void md_update_sh256(md_ctx_t ctx, const uint8_t *msg, int len) {
+	if (SHA256Input((SHA256Context *)ctx->u.state, msg, len) != shaSuccess) {
+		THROW(ERR_NO_VALID);
+	}
+}
+
+void md_final_sh256(uint8_t *hash, md_ctx_t ctx) {
+	if (SHA256Result((SHA256Context *)ctx->u.state, hash) != shaSuccess) {
+		THROW(ERR_NO_VALID);
+	}
+}
+
 #endif
@@ -0,0 +1,602 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2015 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * RELIC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with RELIC. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of bounded discrete logarithms in the pairing groups.
+ *
+ * @ingroup pc
+ */
+
+#include <limits.h>
+#include <stdlib.h>
+
+#include "relic_pc.h"
+#include "relic_core.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+/**
+ * Size of the buffer for a compressed group element.
+ */
+#define DLOG_BYTES		(4 * FP_BYTES + 1)
+
+/**
+ * Number of G_1 elements normalized simultaneously.
+ */
+#define DLOG_BATCH		64
+
+/**
+ * Normalizes a vector of G_1 elements with a single inversion.
+ */
+#define g1_norm_sim(R, P, N)	CAT(G1_LOWER, norm_sim)(R, P, N)
+
+/**
+ * Computes the fingerprint of a compressed group element. The trailing bytes
+ * hold the least significant bits of the first coordinate and the leading byte
+ * holds the sign information, if any.
+ *
+ * @param[in] bin			- the compressed element.
+ * @param[in] len			- the number of bytes.
+ * @return the fingerprint.
+ */
+static uint64_t dlog_key(const uint8_t *bin, int len) {
+	uint64_t key = 0;
+
+	for (int i = MAX(len - 8, 0); i < len; i++) {
+		key = (key << 8) | bin[i];
+	}
+	return key ^ ((uint64_t)bin[0] << 56);
+}
+
+/**
+ * Computes the fingerprint of an element of G_T from one coordinate of its
+ * compressed form, avoiding the subgroup test done by gt_write_bin().
+ *
+ * @param[in] a				- the element.
+ * @return the fingerprint.
+ */
+static uint64_t dlog_key_gt(gt_t a) {
+	uint8_t bin[FP_BYTES];
+
+#if FP_PRIME < 1536
+	fp_write_bin(bin, FP_BYTES, a[1][2][1]);
+#else
+	fp_write_bin(bin, FP_BYTES, a[1]);
+#endif
+	return dlog_key(bin, FP_BYTES);
+}
+
+/**
+ * Allocates an empty hash table with at least twice as many slots as entries.
+ *
+ * @param[out] t			- the table.
+ * @param[in] m				- the number of entries.
+ */
+static void dlog_alloc(pc_dlog_t t, int m) {
+	int size = 2;
+
+	while (size < 2 * m) {
+		size <<= 1;
+	}
+
+	free(t->key);
+	free(t->idx);
+	t->key = (uint64_t *)calloc(size, sizeof(uint64_t));
+	t->idx = (int *)calloc(size, sizeof(int));
+	if (t->key == NULL || t->idx == NULL) {
+		free(t->key);
+		free(t->idx);
+		t->key = NULL;
+		t->idx = NULL;
+		t->step = t->size = 0;
+		THROW(ERR_NO_MEMORY);
+		return;
+	}
+	t->step = m;
+	t->size = size;
+}
+
+/**
+ * Inserts a baby step in the hash table using linear probing.
+ *
+ * @param[out] t			- the table.
+ * @param[in] key			- the fingerprint of the baby step.
+ * @param[in] i				- the index of the baby step.
+ */
+static void dlog_put(pc_dlog_t t, uint64_t key, int i) {
+	int j = (int)(key & (t->size - 1)), l;
+
+	for (l = 0; l < t->size && t->idx[j] != 0; l++) {
+		j = (j + 1) & (t->size - 1);
+	}
+	if (l == t->size) {
+		THROW(ERR_NO_BUFFER);
+		return;
+	}
+	t->key[j] = key;
+	t->idx[j] = i;
+}
+
+/**
+ * Returns the next candidate index of a baby step matching a fingerprint.
+ *
+ * @param[in] t				- the table.
+ * @param[in] key			- the fingerprint to search.
+ * @param[in,out] j			- the number of slots probed, initially zero.
+ * @return the index of the baby step or zero if there are no more candidates.
+ */
+static int dlog_get(pc_dlog_t t, uint64_t key, int *j) {
+	int i, l;
+	uint64_t k;
+
+	/* Probe each slot at most once, even if the table has no empty slot. */
+	while (*j < t->size) {
+		l = (int)((key + *j) & (t->size - 1));
+		i = t->idx[l];
+		k = t->key[l];
+		(*j)++;
+		if (i == 0) {
+			break;
+		}
+		if (k == key) {
+			return i;
+		}
+	}
+	return 0;
+}
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+void g1_dlog_pre(pc_dlog_t t, g1_t g, int m) {
+	uint8_t bin[DLOG_BYTES];
+	int i, j, l, len;
+	g1_t h, u[DLOG_BATCH];
+
+	g1_null(h);
+
+	TRY {
+		g1_new(h);
+		for (j = 0; j < DLOG_BATCH; j++) {
+			g1_null(u[j]);
+			g1_new(u[j]);
+		}
+
+		dlog_alloc(t, m);
+
+		g1_norm(h, g);
+		g1_copy(u[0], h);
+		len = g1_size_bin(h, 1);
+		for (i = 1; i <= m; i += DLOG_BATCH) {
+			l = MIN(DLOG_BATCH, m - i + 1);
+			for (j = 1; j < l; j++) {
+				g1_add(u[j], u[j - 1], h);
+			}
+			g1_norm_sim(u, (const g1_t *)u, l);
+			for (j = 0; j < l; j++) {
+				g1_write_bin(bin, len, u[j], 1);
+				dlog_put(t, dlog_key(bin, len), i + j);
+			}
+			g1_add(u[0], u[l - 1], h);
+			g1_norm(u[0], u[0]);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		g1_free(h);
+		for (j = 0; j < DLOG_BATCH; j++) {
+			g1_free(u[j]);
+		}
+	}
+}
+
+void g2_dlog_pre(pc_dlog_t t, g2_t g, int m) {
+	uint8_t bin[DLOG_BYTES];
+	int i, len;
+	g2_t u;
+
+	g2_null(u);
+
+	TRY {
+		g2_new(u);
+
+		dlog_alloc(t, m);
+
+		g2_norm(u, g);
+		len = g2_size_bin(u, 1);
+		for (i = 1; i <= m; i++) {
+			g2_write_bin(bin, len, u, 1);
+			dlog_put(t, dlog_key(bin, len), i);
+			g2_add(u, u, g);
+			g2_norm(u, u);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		g2_free(u);
+	}
+}
+
+void gt_dlog_pre(pc_dlog_t t, gt_t g, int m) {
+	int i;
+	gt_t u;
+
+	gt_null(u);
+
+	TRY {
+		gt_new(u);
+
+		dlog_alloc(t, m);
+
+		gt_copy(u, g);
+		for (i = 1; i <= m; i++) {
+			dlog_put(t, dlog_key_gt(u), i);
+			gt_mul(u, u, g);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		gt_free(u);
+	}
+}
+
+int g1_dlog(dig_t *k, pc_dlog_t t, g1_t g, g1_t a, dig_t max) {
+	uint8_t bin[DLOG_BYTES];
+	int i, j, l, n, len, inf, stop = 0, result = STS_ERR;
+	uint64_t key;
+	dig_t c;
+	g1_t s, v, u[DLOG_BATCH];
+
+	if (g1_is_infty(a)) {
+		*k = 0;
+		return STS_OK;
+	}
+
+	if (t->step == 0) {
+		return STS_ERR;
+	}
+
+	g1_null(s);
+	g1_null(v);
+
+	TRY {
+		g1_new(s);
+		g1_new(v);
+		for (j = 0; j < DLOG_BATCH; j++) {
+			g1_null(u[j]);
+			g1_new(u[j]);
+		}
+
+		/* Compute the giant step -mG. */
+		g1_mul_dig(s, g, t->step);
+		g1_neg(s, s);
+		g1_norm(s, s);
+		g1_norm(u[0], a);
+		len = g1_size_bin(s, 1);
+
+		/* Process a batch of giant steps A - (c + jm)G at a time. */
+		c = 0;
+		while (stop == 0) {
+			for (n = 0; n < DLOG_BATCH - 1; n++) {
+				if (g1_is_infty(u[n])) {
+					break;
+				}
+				g1_add(u[n + 1], u[n], s);
+			}
+			inf = g1_is_infty(u[n]);
+			if (!inf) {
+				n++;
+			}
+			if (n > 0) {
+				g1_norm_sim(u, (const g1_t *)u, n);
+			}
+			for (j = 0; j < n && stop == 0; j++) {
+				g1_write_bin(bin, len, u[j], 1);
+				key = dlog_key(bin, len);
+				l = 0;
+				while ((i = dlog_get(t, key, &l)) != 0) {
+					if (c + i > max) {
+						continue;
+					}
+					g1_mul_dig(v, g, c + i);
+					if (g1_cmp(v, a) == CMP_EQ) {
+						*k = c + i;
+						result = STS_OK;
+						stop = 1;
+						break;
+					}
+				}
+				if (stop == 0) {
+					if (max - c < (dig_t)t->step) {
+						stop = 1;
+					} else {
+						c += t->step;
+					}
+				}
+			}
+			if (stop == 0) {
+				if (inf) {
+					/* Then A = cG. */
+					*k = c;
+					result = STS_OK;
+					stop = 1;
+				} else {
+					g1_add(u[0], u[n - 1], s);
+					g1_norm(u[0], u[0]);
+				}
+			}
+		}
+	}
+	CATCH_ANY {
+		result = STS_ERR;
+	}
+	FINALLY {
+		g1_free(s);
+		g1_free(v);
+		for (j = 0; j < DLOG_BATCH; j++) {
+			g1_free(u[j]);
+		}
+	}
+
+	return result;
+}
+
+int g2_dlog(dig_t *k, pc_dlog_t t, g2_t g, g2_t a, dig_t max) {
+	uint8_t bin[DLOG_BYTES];
+	int i, j, len, result = STS_ERR;
+	uint64_t key;
+	dig_t c;
+	g2_t s, u, v;
+
+	if (g2_is_infty(a)) {
+		*k = 0;
+		return STS_OK;
+	}
+
+	if (t->step == 0) {
+		return STS_ERR;
+	}
+
+	g2_null(s);
+	g2_null(u);
+	g2_null(v);
+
+	TRY {
+		g2_new(s);
+		g2_new(u);
+		g2_new(v);
+
+		/* Compute the giant step -mG. */
+		g2_mul_dig(s, g, t->step);
+		g2_neg(s, s);
+		g2_norm(s, s);
+		g2_norm(u, a);
+		len = g2_size_bin(s, 1);
+
+		for (c = 0; c <= max; c += t->step) {
+			if (g2_is_infty(u)) {
+				/* Then A = cG. */
+				*k = c;
+				result = STS_OK;
+			} else {
+				g2_write_bin(bin, len, u, 1);
+				key = dlog_key(bin, len);
+				j = 0;
+				while ((i = dlog_get(t, key, &j)) != 0) {
+					if (c + i > max) {
+						continue;
+					}
+					g2_mul_dig(v, g, c + i);
+					if (g2_cmp(v, a) == CMP_EQ) {
+						*k = c + i;
+						result = STS_OK;
+						break;
+					}
+				}
+			}
+			if (result == STS_OK || max - c < (dig_t)t->step) {
+				break;
+			}
+			g2_add(u, u, s);
+			g2_norm(u, u);
+		}
+	}
+	CATCH_ANY {
+		result = STS_ERR;
+	}
+	FINALLY {
+		g2_free(s);
+		g2_free(u);
+		g2_free(v);
+	}
+
+	return result;
+}
+
+int gt_dlog(dig_t *k, pc_dlog_t t, gt_t g, gt_t a, dig_t max) {
+	int i, j, result = STS_ERR;
+	uint64_t key;
+	dig_t c;
+	bn_t e;
+	gt_t s, u, v;
+
+	if (gt_is_unity(a)) {
+		*k = 0;
+		return STS_OK;
+	}
+
+	if (t->step == 0) {
+		return STS_ERR;
+	}
+
+	bn_null(e);
+	gt_null(s);
+	gt_null(u);
+	gt_null(v);
+
+	TRY {
+		bn_new(e);
+		gt_new(s);
+		gt_new(u);
+		gt_new(v);
+
+		/* Compute the giant step g^(-m). */
+		bn_set_dig(e, t->step);
+		gt_exp(s, g, e);
+		gt_inv(s, s);
+		gt_copy(u, a);
+
+		for (c = 0; c <= max; c += t->step) {
+			if (gt_is_unity(u)) {
+				/* Then a = g^c. */
+				*k = c;
+				result = STS_OK;
+			} else {
+				key = dlog_key_gt(u);
+				j = 0;
+				while ((i = dlog_get(t, key, &j)) != 0) {
+					if (c + i > max) {
+						continue;
+					}
+					bn_set_dig(e, c + i);
+					gt_exp(v, g, e);
+					if (gt_cmp(v, a) == CMP_EQ) {
+						*k = c + i;
+						result = STS_OK;
+						break;
+					}
+				}
+			}
+			if (result == STS_OK || max - c < (dig_t)t->step) {
+				break;
+			}
+			gt_mul(u, u, s);
+		}
+	}
+	CATCH_ANY {
+		result = STS_ERR;
+	}
+	FINALLY {
+		bn_free(e);
+		gt_free(s);
+		gt_free(u);
+		gt_free(v);
+	}
+
+	return result;
+}
+
+int pc_dlog_size_bin(pc_dlog_t t) {
+	return 8 + t->size * (8 + 4);
+}
+
+void pc_dlog_read_bin(pc_dlog_t t, const uint8_t *bin, int len) {
+	int i, j, used;
+	uint32_t step, size, idx;
+
+	if (len < 8) {
+		THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	step = size = 0;
+	for (i = 0; i < 4; i++) {
+		step = (step << 8) | bin[i];
+		size = (size << 8) | bin[4 + i];
+	}
+	/* Reject the header before it is used to size any allocation. */
+	if (step == 0 || size > (uint32_t)(INT_MAX - 8) / (8 + 4) ||
+			(size & (size - 1)) != 0 || step > size / 2) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+	if ((uint32_t)len != 8 + size * (8 + 4)) {
+		THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	dlog_alloc(t, (int)step);
+	if ((uint32_t)t->size != size) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+
+	bin += 8;
+	used = 0;
+	for (i = 0; i < (int)size; i++) {
+		t->key[i] = 0;
+		for (j = 0; j < 8; j++) {
+			t->key[i] = (t->key[i] << 8) | bin[j];
+		}
+		idx = 0;
+		for (j = 8; j < 12; j++) {
+			idx = (idx << 8) | bin[j];
+		}
+		if (idx > step) {
+			THROW(ERR_NO_VALID);
+			return;
+		}
+		/* A table holds at most step entries, leaving empty slots. */
+		if (idx != 0 && ++used > (int)step) {
+			THROW(ERR_NO_VALID);
+			return;
+		}
+		t->idx[i] = (int)idx;
+		bin += 12;
+	}
+}
+
+void pc_dlog_write_bin(uint8_t *bin, int len, pc_dlog_t t) {
+	int i, j;
+
+	if (len != pc_dlog_size_bin(t)) {
+		THROW(ERR_NO_BUFFER);
+		return;
+	}
+
+	for (i = 0; i < 4; i++) {
+		bin[i] = (uint8_t)(t->step >> (24 - 8 * i));
+		bin[4 + i] = (uint8_t)(t->size >> (24 - 8 * i));
+	}
+
+	bin += 8;
+	for (i = 0; i < t->size; i++) {
+		for (j = 0; j < 8; j++) {
+			bin[j] = (uint8_t)(t->key[i] >> (56 - 8 * j));
+		}
+		for (j = 0; j < 4; j++) {
+			bin[8 + j] = (uint8_t)(t->idx[i] >> (24 - 8 * j));
+		}
+		bin += 12;
+	}
+}
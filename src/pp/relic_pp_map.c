@@ -41,33 +41,45 @@
  * given parameter.
  *
  * @param[out] r			- the result.
- * @param[out] t			- the resulting point.
- * @param[in] p				- the first pairing argument in affine coordinates.
- * @param[in] q				- the second pairing argument in affine coordinates.
+ * @param[out] t			- the resulting points.
+ * @param[in] p				- the first pairing arguments in affine coordinates.
+ * @param[in] q				- the second pairing arguments in affine coordinates.
+ * @param[in] m				- the number of pairings to evaluate.
  * @param[in] a				- the loop parameter.
  */
-static void pp_mil_k2(fp2_t r, ep_t t, ep_t p, ep_t q, bn_t a) {
+static void pp_mil_k2(fp2_t r, ep_t *t, ep_t *p, ep_t *q, int m, bn_t a) {
+	if (m <= 0) {
+		return;
+	}
+
 	fp2_t l;
-	ep_t _q;
+	ep_t _q[m];
+	int i, j;
 
 	fp2_null(l);
-	ep_null(_q);
+	for (j = 0; j < m; j++) {
+		ep_null(_q[j]);
+	}
 
 	TRY {
 		fp2_new(l);
-		ep_new(_q);
+		for (j = 0; j < m; j++) {
+			ep_new(_q[j]);
+			ep_copy(t[j], p[j]);
+			ep_neg(_q[j], q[j]);
+		}
 
 		fp2_zero(l);
-		ep_copy(t, p);
-		ep_neg(_q, q);
 
-		for (int i = bn_bits(a) - 2; i >= 0; i--) {
+		for (i = bn_bits(a) - 2; i >= 0; i--) {
 			fp2_sqr(r, r);
-			pp_dbl_k2(l, t, t, _q);
-			fp2_mul(r, r, l);
-			if (bn_get_bit(a, i)) {
-				pp_add_k2(l, t, p, q);
+			for (j = 0; j < m; j++) {
+				pp_dbl_k2(l, t[j], t[j], _q[j]);
 				fp2_mul(r, r, l);
+				if (bn_get_bit(a, i)) {
+					pp_add_k2(l, t[j], p[j], q[j]);
+					fp2_mul(r, r, l);
+				}
 			}
 		}
 	}
@@ -76,7 +88,9 @@ static void pp_mil_k2(fp2_t r, ep_t t, ep_t p, ep_t q, bn_t a) {
 	}
 	FINALLY {
 		fp2_free(l);
-		ep_free(_q);
+		for (j = 0; j < m; j++) {
+			ep_free(_q[j]);
+		}
 	}
 }
 
@@ -85,39 +99,52 @@ static void pp_mil_k2(fp2_t r, ep_t t, ep_t p, ep_t q, bn_t a) {
  * given parameter.
  *
  * @param[out] r			- the result.
- * @param[out] t			- the resulting point.
- * @param[in] p				- the first pairing argument in affine coordinates.
- * @param[in] q				- the second pairing argument in affine coordinates.
+ * @param[out] t			- the resulting points.
+ * @param[in] p				- the first pairing arguments in affine coordinates.
+ * @param[in] q				- the second pairing arguments in affine coordinates.
+ * @param[in] m				- the number of pairings to evaluate.
  * @param[in] a				- the loop parameter.
  */
-static void pp_mil_lit_k2(fp2_t r, ep_t t, ep_t p, ep_t q, bn_t a) {
-	fp2_t l, m;
-	ep_t _q;
+static void pp_mil_lit_k2(fp2_t r, ep_t *t, ep_t *p, ep_t *q, int m, bn_t a) {
+	if (m <= 0) {
+		return;
+	}
+
+	fp2_t l, _l;
+	ep_t _q[m];
+	int i, j;
 
 	fp2_null(l);
-	ep_null(_q);
+	fp2_null(_l);
+	for (j = 0; j < m; j++) {
+		ep_null(_q[j]);
+	}
 
 	TRY {
 		fp2_new(l);
-		fp2_new(m);
-		ep_new(_q);
+		fp2_new(_l);
+		for (j = 0; j < m; j++) {
+			ep_new(_q[j]);
+			ep_copy(t[j], p[j]);
+			ep_neg(_q[j], q[j]);
+		}
 
 		fp2_zero(l);
-		fp2_zero(m);
-		ep_copy(t, p);
-		ep_neg(_q, q);
+		fp2_zero(_l);
 
-		for (int i = bn_bits(a) - 2; i >= 0; i--) {
+		for (i = bn_bits(a) - 2; i >= 0; i--) {
 			fp2_sqr(r, r);
-			pp_dbl_k2(l, t, t, _q);
-			fp_copy(m[0], l[1]);
-			fp_copy(m[1], l[0]);
-			fp2_mul(r, r, m);
-			if (bn_get_bit(a, i)) {
-				pp_add_k2(l, t, p, q);
-				fp_copy(m[0], l[1]);
-				fp_copy(m[1], l[0]);
-				fp2_mul(r, r, m);
+			for (j = 0; j < m; j++) {
+				pp_dbl_k2(l, t[j], t[j], _q[j]);
+				fp_copy(_l[0], l[1]);
+				fp_copy(_l[1], l[0]);
+				fp2_mul(r, r, _l);
+				if (bn_get_bit(a, i)) {
+					pp_add_k2(l, t[j], p[j], q[j]);
+					fp_copy(_l[0], l[1]);
+					fp_copy(_l[1], l[0]);
+					fp2_mul(r, r, _l);
+				}
 			}
 		}
 	}
@@ -126,8 +153,10 @@ static void pp_mil_lit_k2(fp2_t r, ep_t t, ep_t p, ep_t q, bn_t a) {
 	}
 	FINALLY {
 		fp2_free(l);
-		fp2_free(m);
-		ep_free(_q);
+		fp2_free(_l);
+		for (j = 0; j < m; j++) {
+			ep_free(_q[j]);
+		}
 	}
 }
 
@@ -136,46 +165,65 @@ static void pp_mil_lit_k2(fp2_t r, ep_t t, ep_t p, ep_t q, bn_t a) {
  * given parameter.
  *
  * @param[out] r			- the result.
- * @param[out] t			- the resulting point.
- * @param[in] q				- the first pairing argument in affine coordinates.
- * @param[in] p				- the second pairing argument in affine coordinates.
+ * @param[out] t			- the resulting points.
+ * @param[in] q				- the first pairing arguments in affine coordinates.
+ * @param[in] p				- the second pairing arguments in affine coordinates.
+ * @param[in] m				- the number of pairings to evaluate.
  * @param[in] a				- the loop parameter.
  */
-static void pp_mil_k12(fp12_t r, ep2_t t, ep2_t q, ep_t p, bn_t a) {
+static void pp_mil_k12(fp12_t r, ep2_t *t, ep2_t *q, ep_t *p, int m, bn_t a) {
+	if (m <= 0) {
+		fp12_set_dig(r, 1);
+		return;
+	}
+
 	fp12_t l;
-	ep_t _p;
+	ep_t _p[m];
+	int i, j;
 
 	fp12_null(l);
-	ep_null(_p);
+	for (j = 0; j < m; j++) {
+		ep_null(_p[j]);
+	}
 
 	TRY {
 		fp12_new(l);
-		ep_new(_p);
-
-		fp12_zero(l);
-		ep2_copy(t, q);
-
-		/* Precomputing. */
+		for (j = 0; j < m; j++) {
+			ep_new(_p[j]);
+			ep2_copy(t[j], q[j]);
+			/* Precomputing. */
 #if EP_ADD == BASIC
-		ep_neg(_p, p);
+			ep_neg(_p[j], p[j]);
 #else
-		fp_add(_p->x, p->x, p->x);
-		fp_add(_p->x, _p->x, p->x);
-		fp_neg(_p->y, p->y);
+			fp_add(_p[j]->x, p[j]->x, p[j]->x);
+			fp_add(_p[j]->x, _p[j]->x, p[j]->x);
+			fp_neg(_p[j]->y, p[j]->y);
 #endif
+		}
 
-		pp_dbl_k12(r, t, t, _p);
-		if (bn_get_bit(a, bn_bits(a) - 2)) {
-			pp_add_k12(l, t, q, p);
+		fp12_zero(l);
+
+		/* The first line initializes the accumulator. */
+		pp_dbl_k12(r, t[0], t[0], _p[0]);
+		for (j = 1; j < m; j++) {
+			pp_dbl_k12(l, t[j], t[j], _p[j]);
 			fp12_mul_dxs(r, r, l);
 		}
-		for (int i = bn_bits(a) - 3; i >= 0; i--) {
+		if (bn_get_bit(a, bn_bits(a) - 2)) {
+			for (j = 0; j < m; j++) {
+				pp_add_k12(l, t[j], q[j], p[j]);
+				fp12_mul_dxs(r, r, l);
+			}
+		}
+		for (i = bn_bits(a) - 3; i >= 0; i--) {
 			fp12_sqr(r, r);
-			pp_dbl_k12(l, t, t, _p);
-			fp12_mul_dxs(r, r, l);
-			if (bn_get_bit(a, i)) {
-				pp_add_k12(l, t, q, p);
+			for (j = 0; j < m; j++) {
+				pp_dbl_k12(l, t[j], t[j], _p[j]);
 				fp12_mul_dxs(r, r, l);
+				if (bn_get_bit(a, i)) {
+					pp_add_k12(l, t[j], q[j], p[j]);
+					fp12_mul_dxs(r, r, l);
+				}
 			}
 		}
 	}
@@ -184,7 +232,9 @@ static void pp_mil_k12(fp12_t r, ep2_t t, ep2_t q, ep_t p, bn_t a) {
 	}
 	FINALLY {
 		fp12_free(l);
-		ep_free(_p);
+		for (j = 0; j < m; j++) {
+			ep_free(_p[j]);
+		}
 	}
 }
 
@@ -193,68 +243,90 @@ static void pp_mil_k12(fp12_t r, ep2_t t, ep2_t q, ep_t p, bn_t a) {
  * given parameter represented in sparse form.
  *
  * @param[out] r			- the result.
- * @param[out] t			- the resulting point.
- * @param[in] q				- the first pairing argument in affine coordinates.
- * @param[in] p				- the second pairing argument in affine coordinates.
+ * @param[out] t			- the resulting points.
+ * @param[in] q				- the first pairing arguments in affine coordinates.
+ * @param[in] p				- the second pairing arguments in affine coordinates.
+ * @param[in] m				- the number of pairings to evaluate.
  * @param[in] s				- the loop parameter in sparse form.
- * @paramin] len			- the length of the loop parameter.
+ * @param[in] len			- the length of the loop parameter.
  */
-static void pp_mil_sps_k12(fp12_t r, ep2_t t, ep2_t q, ep_t p, int *s, int len) {
+static void pp_mil_sps_k12(fp12_t r, ep2_t *t, ep2_t *q, ep_t *p, int m,
+		int *s, int len) {
+	if (m <= 0) {
+		fp12_set_dig(r, 1);
+		return;
+	}
+
 	fp12_t l;
-	ep_t _p;
-	ep2_t _q;
+	ep_t _p[m];
+	ep2_t _q[m];
+	int i, j;
 
 	fp12_null(l);
-	ep_null(_p);
-	ep2_null(_q);
+	for (j = 0; j < m; j++) {
+		ep_null(_p[j]);
+		ep2_null(_q[j]);
+	}
 
 	TRY {
 		fp12_new(l);
-		ep_new(_p);
-		ep2_new(_q);
-
-		fp12_zero(l);
-		ep2_copy(t, q);
-		ep2_neg(_q, q);
-
+		for (j = 0; j < m; j++) {
+			ep_new(_p[j]);
+			ep2_new(_q[j]);
+			ep2_copy(t[j], q[j]);
+			ep2_neg(_q[j], q[j]);
 #if EP_ADD == BASIC
-		ep_neg(_p, p);
+			ep_neg(_p[j], p[j]);
 #else
-		fp_add(_p->x, p->x, p->x);
-		fp_add(_p->x, _p->x, p->x);
-		fp_neg(_p->y, p->y);
+			fp_add(_p[j]->x, p[j]->x, p[j]->x);
+			fp_add(_p[j]->x, _p[j]->x, p[j]->x);
+			fp_neg(_p[j]->y, p[j]->y);
 #endif
-
-		pp_dbl_k12(r, t, t, _p);
-		if (s[len - 2] > 0) {
-			pp_add_k12(l, t, q, p);
-			fp12_mul_dxs(r, r, l);
 		}
-		if (s[len - 2] < 0) {
-			pp_add_k12(l, t, _q, p);
+
+		fp12_zero(l);
+
+		/* The first line initializes the accumulator. */
+		pp_dbl_k12(r, t[0], t[0], _p[0]);
+		for (j = 1; j < m; j++) {
+			pp_dbl_k12(l, t[j], t[j], _p[j]);
 			fp12_mul_dxs(r, r, l);
 		}
-		for (int i = len - 3; i >= 0; i--) {
-			fp12_sqr(r, r);
-			pp_dbl_k12(l, t, t, _p);
-			fp12_mul_dxs(r, r, l);
-			if (s[i] > 0) {
-				pp_add_k12(l, t, q, p);
+		for (j = 0; j < m; j++) {
+			if (s[len - 2] > 0) {
+				pp_add_k12(l, t[j], q[j], p[j]);
 				fp12_mul_dxs(r, r, l);
 			}
-			if (s[i] < 0) {
-				pp_add_k12(l, t, _q, p);
+			if (s[len - 2] < 0) {
+				pp_add_k12(l, t[j], _q[j], p[j]);
 				fp12_mul_dxs(r, r, l);
 			}
 		}
+		for (i = len - 3; i >= 0; i--) {
+			fp12_sqr(r, r);
+			for (j = 0; j < m; j++) {
+				pp_dbl_k12(l, t[j], t[j], _p[j]);
+				fp12_mul_dxs(r, r, l);
+				if (s[i] > 0) {
+					pp_add_k12(l, t[j], q[j], p[j]);
+					fp12_mul_dxs(r, r, l);
+				}
+				if (s[i] < 0) {
+					pp_add_k12(l, t[j], _q[j], p[j]);
+					fp12_mul_dxs(r, r, l);
+				}
+			}
+		}
 	}
 	CATCH_ANY {
 		THROW(ERR_CAUGHT);
 	}
 	FINALLY {
 		fp12_free(l);
-		ep_free(_p);
-		ep2_free(_q);
+		for (j = 0; j < m; j++) {
+			ep_free(_p[j]);
+			ep2_free(_q[j]);
+		}
 	}
 }
 
@@ -263,33 +335,46 @@ static void pp_mil_sps_k12(fp12_t r, ep2_t t, ep2_t q, ep_t p, int *s, int len)
  * given parameter.
  *
  * @param[out] r			- the result.
- * @param[out] t			- the resulting point.
- * @param[in] p				- the first pairing argument in affine coordinates.
- * @param[in] q				- the second pairing argument in affine coordinates.
+ * @param[out] t			- the resulting points.
+ * @param[in] p				- the first pairing arguments in affine coordinates.
+ * @param[in] q				- the second pairing arguments in affine coordinates.
+ * @param[in] m				- the number of pairings to evaluate.
  * @param[in] a				- the loop parameter.
  */
-static void pp_mil_lit_k12(fp12_t r, ep_t t, ep_t p, ep2_t q, bn_t a) {
+static void pp_mil_lit_k12(fp12_t r, ep_t *t, ep_t *p, ep2_t *q, int m,
+		bn_t a) {
+	if (m <= 0) {
+		return;
+	}
+
 	fp12_t l;
-	ep2_t _q;
+	ep2_t _q[m];
+	int i, j;
 
 	fp12_null(l);
-	ep2_null(_q);
+	for (j = 0; j < m; j++) {
+		ep2_null(_q[j]);
+	}
 
 	TRY {
 		fp12_new(l);
-		ep2_new(_q);
+		for (j = 0; j < m; j++) {
+			ep2_new(_q[j]);
+			ep_copy(t[j], p[j]);
+			ep2_neg(_q[j], q[j]);
+		}
 
-		ep_copy(t, p);
-		ep2_neg(_q, q);
 		fp12_zero(l);
 
-		for (int i = bn_bits(a) - 2; i >= 0; i--) {
+		for (i = bn_bits(a) - 2; i >= 0; i--) {
 			fp12_sqr(r, r);
-			pp_dbl_lit_k12(l, t, t, _q);
-			fp12_mul(r, r, l);
-			if (bn_get_bit(a, i)) {
-				pp_add_lit_k12(l, t, p, q);
+			for (j = 0; j < m; j++) {
+				pp_dbl_lit_k12(l, t[j], t[j], _q[j]);
 				fp12_mul(r, r, l);
+				if (bn_get_bit(a, i)) {
+					pp_add_lit_k12(l, t[j], p[j], q[j]);
+					fp12_mul(r, r, l);
+				}
 			}
 		}
 	}
@@ -298,7 +383,9 @@ static void pp_mil_lit_k12(fp12_t r, ep_t t, ep_t p, ep2_t q, bn_t a) {
 	}
 	FINALLY {
 		fp12_free(l);
-		ep2_free(_q);
+		for (j = 0; j < m; j++) {
+			ep2_free(_q[j]);
+		}
 	}
 }
 
@@ -346,6 +433,152 @@ static void pp_fin_k12_oatep(fp12_t r, ep2_t t, ep2_t q, ep_t p) {
 }
 
 
+/**
+ * Stores the three nonzero coefficients of a line function computed at the
+ * point (1, 1).
+ *
+ * @param[out] t			- the three coefficients.
+ * @param[in] l				- the line function.
+ */
+static void pp_put_k12(fp2_t *t, fp12_t l) {
+	int one = 1, zero = 0;
+
+	if (ep2_curve_is_twist() == EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	fp2_copy(t[0], l[zero][zero]);
+	fp2_copy(t[1], l[one][zero]);
+	fp2_copy(t[2], l[one][one]);
+}
+
+/**
+ * Evaluates a precomputed line function at an affine point. The line must have
+ * been computed at the point (1, 1), so that the coefficients depending on the
+ * point only need to be scaled by its coordinates. Only the three nonzero
+ * coefficients of the result are written.
+ *
+ * @param[out] l			- the result of the evaluation.
+ * @param[in] t				- the three coefficients of the line function.
+ * @param[in] p				- the affine point to evaluate the line function.
+ */
+static void pp_lin_k12(fp12_t l, fp2_t *t, ep_t p) {
+	int one = 1, zero = 0;
+
+	if (ep2_curve_is_twist() == EP_MTYPE) {
+		one ^= 1;
+		zero ^= 1;
+	}
+
+	fp_mul(l[zero][zero][0], t[0][0], p->y);
+	fp_mul(l[zero][zero][1], t[0][1], p->y);
+	fp_mul(l[one][zero][0], t[1][0], p->x);
+	fp_mul(l[one][zero][1], t[1][1], p->x);
+	fp2_copy(l[one][one], t[2]);
+}
+
+#if PP_MAP == OATEP || !defined(STRIP)
+
+/**
+ * Arguments of Miller loops evaluated in parallel.
+ */
+typedef struct {
+	/** The partial results. */
+	fp12_t *r;
+	/** The resulting points. */
+	ep2_t *t;
+	/** The first pairing arguments. */
+	ep2_t *q;
+	/** The second pairing arguments. */
+	ep_t *p;
+	/** The number of pairings to evaluate. */
+	int m;
+	/** The number of partial results. */
+	int c;
+	/** The loop parameter in sparse form. */
+	int *s;
+	/** The length of the loop parameter. */
+	int len;
+} pp_sim_t;
+
+/**
+ * Computes the Miller loop for a contiguous slice of a multi-pairing.
+ *
+ * @param[in,out] args		- the arguments of the Miller loops.
+ * @param[in] i				- the index of the slice.
+ */
+static void pp_mil_sps_job(void *args, int i) {
+	pp_sim_t *sim = (pp_sim_t *)args;
+	int lo = i * sim->m / sim->c, hi = (i + 1) * sim->m / sim->c;
+
+	pp_mil_sps_k12(sim->r[i], sim->t + lo, sim->q + lo, sim->p + lo, hi - lo,
+			sim->s, sim->len);
+}
+
+/**
+ * Computes the Miller loop for pairings of type G_2 x G_1 over the bits of a
+ * given parameter represented in sparse form, splitting the pairings among the
+ * available threads and multiplying the partial results.
+ *
+ * @param[out] r			- the result.
+ * @param[out] t			- the resulting points.
+ * @param[in] q				- the first pairing arguments in affine coordinates.
+ * @param[in] p				- the second pairing arguments in affine coordinates.
+ * @param[in] m				- the number of pairings to evaluate.
+ * @param[in] s				- the loop parameter in sparse form.
+ * @param[in] len			- the length of the loop parameter.
+ */
+static void pp_mil_par_k12(fp12_t r, ep2_t *t, ep2_t *q, ep_t *p, int m,
+		int *s, int len) {
+	int i, c = MIN(core_par_num(), m);
+	pp_sim_t sim;
+
+	if (c <= 1) {
+		pp_mil_sps_k12(r, t, q, p, m, s, len);
+		return;
+	}
+
+	fp12_t f[c];
+
+	for (i = 0; i < c; i++) {
+		fp12_null(f[i]);
+	}
+
+	TRY {
+		for (i = 0; i < c; i++) {
+			fp12_new(f[i]);
+			/* The first line only overwrites part of the accumulator. */
+			fp12_set_dig(f[i], 1);
+		}
+
+		sim.r = f;
+		sim.t = t;
+		sim.q = q;
+		sim.p = p;
+		sim.m = m;
+		sim.c = c;
+		sim.s = s;
+		sim.len = len;
+		core_par(pp_mil_sps_job, &sim, c);
+
+		fp12_copy(r, f[0]);
+		for (i = 1; i < c; i++) {
+			fp12_mul(r, r, f[i]);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		for (i = 0; i < c; i++) {
+			fp12_free(f[i]);
+		}
+	}
+}
+
+#endif
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
@@ -370,6 +603,8 @@ void pp_map_tatep_k2(fp2_t r, ep_t p, ep_t q) {
 	bn_null(n);
 
 	TRY {
+		ep_new(_p);
+		ep_new(_q);
 		ep_new(t);
 		bn_new(n);
 
@@ -381,7 +616,7 @@ void pp_map_tatep_k2(fp2_t r, ep_t p, ep_t q) {
 		fp2_set_dig(r, 1);
 
 		if (!ep_is_infty(_p) && !ep_is_infty(_q)) {
-			pp_mil_k2(r, t, _p, _q, n);
+			pp_mil_k2(r, &t, &_p, &_q, 1, n);
 			pp_exp_k2(r, r);
 		}
 	}
@@ -396,6 +631,62 @@ void pp_map_tatep_k2(fp2_t r, ep_t p, ep_t q) {
 	}
 }
 
+void pp_map_sim_tatep_k2(fp2_t r, ep_t *p, ep_t *q, int m) {
+	if (m <= 0) {
+		fp2_set_dig(r, 1);
+		return;
+	}
+
+	ep_t _p[m], _q[m], t[m];
+	bn_t n;
+	int i, j;
+
+	bn_null(n);
+	for (i = 0; i < m; i++) {
+		ep_null(_p[i]);
+		ep_null(_q[i]);
+		ep_null(t[i]);
+	}
+
+	TRY {
+		bn_new(n);
+		for (i = 0; i < m; i++) {
+			ep_new(_p[i]);
+			ep_new(_q[i]);
+			ep_new(t[i]);
+		}
+
+		/* Pairings with an argument at infinity are trivial and skipped. */
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !ep_is_infty(q[i])) {
+				ep_norm(_p[j], p[i]);
+				ep_norm(_q[j++], q[i]);
+			}
+		}
+
+		ep_curve_get_ord(n);
+		bn_sub_dig(n, n, 1);
+		fp2_set_dig(r, 1);
+
+		if (j > 0) {
+			pp_mil_k2(r, t, _p, _q, j, n);
+			pp_exp_k2(r, r);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+			ep_free(_q[i]);
+			ep_free(t[i]);
+		}
+	}
+}
+
 #endif
 
 #if PP_MAP == TATEP || !defined(STRIP)
@@ -422,7 +713,7 @@ void pp_map_tatep_k12(fp12_t r, ep_t p, ep2_t q) {
 		fp12_set_dig(r, 1);
 
 		if (!ep_is_infty(_p) && !ep2_is_infty(_q)) {
-			pp_mil_lit_k12(r, t, _p, _q, n);
+			pp_mil_lit_k12(r, &t, &_p, &_q, 1, n);
 			pp_exp_k12(r, r);
 		}
 	}
@@ -437,6 +728,62 @@ void pp_map_tatep_k12(fp12_t r, ep_t p, ep2_t q) {
 	}
 }
 
+void pp_map_sim_tatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
+	if (m <= 0) {
+		fp12_set_dig(r, 1);
+		return;
+	}
+
+	ep_t _p[m], t[m];
+	ep2_t _q[m];
+	bn_t n;
+	int i, j;
+
+	bn_null(n);
+	for (i = 0; i < m; i++) {
+		ep_null(_p[i]);
+		ep_null(t[i]);
+		ep2_null(_q[i]);
+	}
+
+	TRY {
+		bn_new(n);
+		for (i = 0; i < m; i++) {
+			ep_new(_p[i]);
+			ep_new(t[i]);
+			ep2_new(_q[i]);
+		}
+
+		/* Pairings with an argument at infinity are trivial and skipped. */
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !ep2_is_infty(q[i])) {
+				ep_norm(_p[j], p[i]);
+				ep2_norm(_q[j++], q[i]);
+			}
+		}
+
+		ep_curve_get_ord(n);
+		fp12_set_dig(r, 1);
+
+		if (j > 0) {
+			pp_mil_lit_k12(r, t, _p, _q, j, n);
+			pp_exp_k12(r, r);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(n);
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+			ep_free(t[i]);
+			ep2_free(_q[i]);
+		}
+	}
+}
+
 #endif
 
 #if PP_MAP == WEILP || !defined(STRIP)
@@ -472,8 +819,8 @@ void pp_map_weilp_k2(fp2_t r, ep_t p, ep_t q) {
 		fp2_set_dig(r1, 1);
 
 		if (!ep_is_infty(_p) && !ep_is_infty(_q)) {
-			pp_mil_lit_k2(r0, t0, _p, _q, n);
-			pp_mil_k2(r1, t1, _q, _p, n);
+			pp_mil_lit_k2(r0, &t0, &_p, &_q, 1, n);
+			pp_mil_k2(r1, &t1, &_q, &_p, 1, n);
 			fp2_inv(r1, r1);
 			fp2_mul(r0, r0, r1);
 			fp2_inv(r1, r0);
@@ -495,6 +842,78 @@ void pp_map_weilp_k2(fp2_t r, ep_t p, ep_t q) {
 	}
 }
 
+void pp_map_sim_weilp_k2(fp2_t r, ep_t *p, ep_t *q, int m) {
+	if (m <= 0) {
+		fp2_set_dig(r, 1);
+		return;
+	}
+
+	ep_t _p[m], _q[m], t0[m], t1[m];
+	fp2_t r0, r1;
+	bn_t n;
+	int i, j;
+
+	fp2_null(r0);
+	fp2_null(r1);
+	bn_null(n);
+	for (i = 0; i < m; i++) {
+		ep_null(_p[i]);
+		ep_null(_q[i]);
+		ep_null(t0[i]);
+		ep_null(t1[i]);
+	}
+
+	TRY {
+		fp2_new(r0);
+		fp2_new(r1);
+		bn_new(n);
+		for (i = 0; i < m; i++) {
+			ep_new(_p[i]);
+			ep_new(_q[i]);
+			ep_new(t0[i]);
+			ep_new(t1[i]);
+		}
+
+		/* Pairings with an argument at infinity are trivial and skipped. */
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !ep_is_infty(q[i])) {
+				ep_norm(_p[j], p[i]);
+				ep_norm(_q[j++], q[i]);
+			}
+		}
+
+		ep_curve_get_ord(n);
+		bn_sub_dig(n, n, 1);
+		fp2_set_dig(r0, 1);
+		fp2_set_dig(r1, 1);
+
+		if (j > 0) {
+			pp_mil_lit_k2(r0, t0, _p, _q, j, n);
+			pp_mil_k2(r1, t1, _q, _p, j, n);
+			fp2_inv(r1, r1);
+			fp2_mul(r0, r0, r1);
+			fp2_inv(r1, r0);
+			fp2_inv_uni(r0, r0);
+		}
+		fp2_mul(r, r0, r1);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp2_free(r0);
+		fp2_free(r1);
+		bn_free(n);
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+			ep_free(_q[i]);
+			ep_free(t0[i]);
+			ep_free(t1[i]);
+		}
+	}
+}
+
 void pp_map_weilp_k12(fp12_t r, ep_t p, ep2_t q) {
 	ep_t _p, t0;
 	ep2_t _q, t1;
@@ -526,8 +945,8 @@ void pp_map_weilp_k12(fp12_t r, ep_t p, ep2_t q) {
 		fp12_set_dig(r1, 1);
 
 		if (!ep_is_infty(_p) && !ep2_is_infty(_q)) {
-			pp_mil_lit_k12(r0, t0, _p, _q, n);
-			pp_mil_k12(r1, t1, _q, _p, n);
+			pp_mil_lit_k12(r0, &t0, &_p, &_q, 1, n);
+			pp_mil_k12(r1, &t1, &_q, &_p, 1, n);
 			fp12_inv(r1, r1);
 			fp12_mul(r0, r0, r1);
 			fp12_inv(r1, r0);
@@ -549,6 +968,79 @@ void pp_map_weilp_k12(fp12_t r, ep_t p, ep2_t q) {
 	}
 }
 
+void pp_map_sim_weilp_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
+	if (m <= 0) {
+		fp12_set_dig(r, 1);
+		return;
+	}
+
+	ep_t _p[m], t0[m];
+	ep2_t _q[m], t1[m];
+	fp12_t r0, r1;
+	bn_t n;
+	int i, j;
+
+	fp12_null(r0);
+	fp12_null(r1);
+	bn_null(n);
+	for (i = 0; i < m; i++) {
+		ep_null(_p[i]);
+		ep_null(t0[i]);
+		ep2_null(_q[i]);
+		ep2_null(t1[i]);
+	}
+
+	TRY {
+		fp12_new(r0);
+		fp12_new(r1);
+		bn_new(n);
+		for (i = 0; i < m; i++) {
+			ep_new(_p[i]);
+			ep_new(t0[i]);
+			ep2_new(_q[i]);
+			ep2_new(t1[i]);
+		}
+
+		/* Pairings with an argument at infinity are trivial and skipped. */
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !ep2_is_infty(q[i])) {
+				ep_norm(_p[j], p[i]);
+				ep2_norm(_q[j++], q[i]);
+			}
+		}
+
+		ep_curve_get_ord(n);
+		bn_sub_dig(n, n, 1);
+		fp12_set_dig(r0, 1);
+		fp12_set_dig(r1, 1);
+
+		if (j > 0) {
+			pp_mil_lit_k12(r0, t0, _p, _q, j, n);
+			pp_mil_k12(r1, t1, _q, _p, j, n);
+			fp12_inv(r1, r1);
+			fp12_mul(r0, r0, r1);
+			fp12_inv(r1, r0);
+			fp12_inv_uni(r0, r0);
+		}
+		fp12_mul(r, r0, r1);
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		fp12_free(r0);
+		fp12_free(r1);
+		bn_free(n);
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+			ep_free(t0[i]);
+			ep2_free(_q[i]);
+			ep2_free(t1[i]);
+		}
+	}
+}
+
 #endif
 
 
@@ -587,7 +1079,7 @@ void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q) {
 				case BN_P256:
 				case BN_P638:
 					/* r = f_{|a|,Q}(P). */
-					pp_mil_sps_k12(r, t, _q, _p, s, len);
+					pp_mil_sps_k12(r, &t, &_q, &_p, 1, s, len);
 					if (bn_sign(a) == BN_NEG) {
 						/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
 						fp12_inv_uni(r, r);
@@ -598,7 +1090,7 @@ void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q) {
 					break;
 				case B12_P638:
 					/* r = f_{|a|,Q}(P). */
-					pp_mil_sps_k12(r, t, _q, _p, s, len);
+					pp_mil_sps_k12(r, &t, &_q, &_p, 1, s, len);
 					if (bn_sign(a) == BN_NEG) {
 						fp12_inv_uni(r, r);
 						ep2_neg(t, t);
@@ -619,4 +1111,282 @@ void pp_map_oatep_k12(fp12_t r, ep_t p, ep2_t q) {
 	}
 }
 
+void pp_map_sim_oatep_k12(fp12_t r, ep_t *p, ep2_t *q, int m) {
+	if (m <= 0) {
+		fp12_set_dig(r, 1);
+		return;
+	}
+
+	ep_t _p[m];
+	ep2_t t[m], _q[m];
+	bn_t a;
+	int i, j, len = FP_BITS, s[FP_BITS];
+
+	bn_null(a);
+	for (i = 0; i < m; i++) {
+		ep_null(_p[i]);
+		ep2_null(_q[i]);
+		ep2_null(t[i]);
+	}
+
+	TRY {
+		bn_new(a);
+		for (i = 0; i < m; i++) {
+			ep_new(_p[i]);
+			ep2_new(_q[i]);
+			ep2_new(t[i]);
+		}
+
+		/* Pairings with an argument at infinity are trivial and skipped. */
+		j = 0;
+		for (i = 0; i < m; i++) {
+			if (!ep_is_infty(p[i]) && !ep2_is_infty(q[i])) {
+				ep_norm(_p[j], p[i]);
+				ep2_norm(_q[j++], q[i]);
+			}
+		}
+
+		fp_param_get_var(a);
+		bn_mul_dig(a, a, 6);
+		bn_add_dig(a, a, 2);
+		fp_param_get_map(s, &len);
+		fp12_set_dig(r, 1);
+
+		if (j > 0) {
+			switch (ep_param_get()) {
+				case BN_P158:
+				case BN_P254:
+				case BN_P256:
+				case BN_P638:
+					/* r = \prod f_{|a|,Q_i}(P_i). */
+					pp_mil_par_k12(r, t, _q, _p, j, s, len);
+					if (bn_sign(a) == BN_NEG) {
+						/* f_{-a,Q}(P) = 1/f_{a,Q}(P). */
+						fp12_inv_uni(r, r);
+						for (i = 0; i < j; i++) {
+							ep2_neg(t[i], t[i]);
+						}
+					}
+					for (i = 0; i < j; i++) {
+						pp_fin_k12_oatep(r, t[i], _q[i], _p[i]);
+					}
+					pp_exp_k12(r, r);
+					break;
+				case B12_P638:
+					/* r = \prod f_{|a|,Q_i}(P_i). */
+					pp_mil_par_k12(r, t, _q, _p, j, s, len);
+					if (bn_sign(a) == BN_NEG) {
+						fp12_inv_uni(r, r);
+					}
+					pp_exp_k12(r, r);
+					break;
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		bn_free(a);
+		for (i = 0; i < m; i++) {
+			ep_free(_p[i]);
+			ep2_free(_q[i]);
+			ep2_free(t[i]);
+		}
+	}
+}
+
+void pp_map_pre_oatep_k12(fp2_t *t, ep2_t q) {
+	ep_t u;
+	fp12_t l;
+	ep2_t r, _q, q1, q2;
+	bn_t a;
+	int i, j, len = FP_BITS, s[FP_BITS];
+
+	ep_null(u);
+	fp12_null(l);
+	ep2_null(r);
+	ep2_null(_q);
+	ep2_null(q1);
+	ep2_null(q2);
+	bn_null(a);
+
+	TRY {
+		ep_new(u);
+		fp12_new(l);
+		ep2_new(r);
+		ep2_new(_q);
+		ep2_new(q1);
+		ep2_new(q2);
+		bn_new(a);
+
+		ep2_norm(_q, q);
+		fp_param_get_var(a);
+		bn_mul_dig(a, a, 6);
+		bn_add_dig(a, a, 2);
+		fp_param_get_map(s, &len);
+
+		/* Count the lines: one per doubling, addition and final step. */
+		j = len + 1;
+		for (i = 0; i < len - 1; i++) {
+			j += (s[i] != 0);
+		}
+		if (3 * j > PP_TABLE) {
+			THROW(ERR_NO_BUFFER);
+		}
+
+		/* A zero first line denotes a table for the point at infinity. */
+		for (i = 0; i < PP_TABLE; i++) {
+			fp2_zero(t[i]);
+		}
+
+		if (!ep2_is_infty(_q)) {
+			/* Evaluate the lines at (1, 1) to keep only their coefficients. */
+			fp_set_dig(u->x, 1);
+			fp_set_dig(u->y, 1);
+			fp_set_dig(u->z, 1);
+			u->norm = 1;
+
+			j = 0;
+			ep2_copy(r, _q);
+			ep2_neg(q1, _q);
+			pp_dbl_k12(l, r, r, u);
+			pp_put_k12(t + 3 * j++, l);
+			if (s[len - 2] > 0) {
+				pp_add_k12(l, r, _q, u);
+				pp_put_k12(t + 3 * j++, l);
+			}
+			if (s[len - 2] < 0) {
+				pp_add_k12(l, r, q1, u);
+				pp_put_k12(t + 3 * j++, l);
+			}
+			for (i = len - 3; i >= 0; i--) {
+				pp_dbl_k12(l, r, r, u);
+				pp_put_k12(t + 3 * j++, l);
+				if (s[i] > 0) {
+					pp_add_k12(l, r, _q, u);
+					pp_put_k12(t + 3 * j++, l);
+				}
+				if (s[i] < 0) {
+					pp_add_k12(l, r, q1, u);
+					pp_put_k12(t + 3 * j++, l);
+				}
+			}
+
+			switch (ep_param_get()) {
+				case BN_P158:
+				case BN_P254:
+				case BN_P256:
+				case BN_P638:
+					if (bn_sign(a) == BN_NEG) {
+						ep2_neg(r, r);
+					}
+					/* Precompute the lines of pp_fin_k12_oatep(). */
+					fp2_set_dig(q1->z, 1);
+					fp2_set_dig(q2->z, 1);
+					ep2_frb(q1, _q, 1);
+					ep2_frb(q2, _q, 2);
+					ep2_neg(q2, q2);
+					pp_add_k12(l, r, q1, u);
+					pp_put_k12(t + 3 * j++, l);
+					pp_add_k12(l, r, q2, u);
+					pp_put_k12(t + 3 * j++, l);
+					break;
+			}
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		ep_free(u);
+		fp12_free(l);
+		ep2_free(r);
+		ep2_free(_q);
+		ep2_free(q1);
+		ep2_free(q2);
+		bn_free(a);
+	}
+}
+
+void pp_map_fix_oatep_k12(fp12_t r, ep_t p, fp2_t *t) {
+	ep_t _p, d;
+	fp12_t l;
+	bn_t a;
+	int i, j, len = FP_BITS, s[FP_BITS];
+
+	ep_null(_p);
+	ep_null(d);
+	fp12_null(l);
+	bn_null(a);
+
+	TRY {
+		ep_new(_p);
+		ep_new(d);
+		fp12_new(l);
+		bn_new(a);
+
+		ep_norm(_p, p);
+		fp_param_get_var(a);
+		bn_mul_dig(a, a, 6);
+		bn_add_dig(a, a, 2);
+		fp_param_get_map(s, &len);
+		fp12_set_dig(r, 1);
+
+		if (!ep_is_infty(_p) && !(fp2_is_zero(t[0]) && fp2_is_zero(t[1]) &&
+				fp2_is_zero(t[2]))) {
+			/* Doubling lines are evaluated at the same point as in Miller. */
+#if EP_ADD == BASIC
+			ep_neg(d, _p);
+#else
+			fp_add(d->x, _p->x, _p->x);
+			fp_add(d->x, d->x, _p->x);
+			fp_neg(d->y, _p->y);
+#endif
+			j = 0;
+			fp12_zero(l);
+			fp12_zero(r);
+			pp_lin_k12(r, t + 3 * j++, d);
+			if (s[len - 2] != 0) {
+				pp_lin_k12(l, t + 3 * j++, _p);
+				fp12_mul_dxs(r, r, l);
+			}
+			for (i = len - 3; i >= 0; i--) {
+				fp12_sqr(r, r);
+				pp_lin_k12(l, t + 3 * j++, d);
+				fp12_mul_dxs(r, r, l);
+				if (s[i] != 0) {
+					pp_lin_k12(l, t + 3 * j++, _p);
+					fp12_mul_dxs(r, r, l);
+				}
+			}
+			if (bn_sign(a) == BN_NEG) {
+				fp12_inv_uni(r, r);
+			}
+
+			switch (ep_param_get()) {
+				case BN_P158:
+				case BN_P254:
+				case BN_P256:
+				case BN_P638:
+					pp_lin_k12(l, t + 3 * j++, _p);
+					fp12_mul_dxs(r, r, l);
+					pp_lin_k12(l, t + 3 * j++, _p);
+					fp12_mul_dxs(r, r, l);
+					break;
+			}
+			pp_exp_k12(r, r);
+		}
+	}
+	CATCH_ANY {
+		THROW(ERR_CAUGHT);
+	}
+	FINALLY {
+		ep_free(_p);
+		ep_free(d);
+		fp12_free(l);
+		bn_free(a);
+	}
+}
+
 #endif
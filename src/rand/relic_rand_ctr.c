@@ -0,0 +1,211 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2015 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * RELIC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with RELIC. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file
+ *
+ * Implementation of the CTR_DRBG pseudo-random number generator.
+ *
+ * @ingroup rand
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "relic_conf.h"
+#include "relic_core.h"
+#include "relic_label.h"
+#include "relic_rand.h"
+#include "relic_bc.h"
+#include "relic_err.h"
+
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if RAND == CTR
+
+/**
+ * Size of the AES-256 key in bytes.
+ */
+#define RAND_KEY		32
+
+/**
+ * Size of the seed length in bytes, the key followed by the counter block.
+ */
+#define RAND_SEED		(RAND_KEY + BC_LEN)
+
+/**
+ * Encrypts a single block with AES-256.
+ *
+ * @param[out] out			- the ciphertext block.
+ * @param[in] in			- the plaintext block.
+ * @param[in] key			- the key.
+ */
+static void rand_enc(uint8_t *out, uint8_t *in, uint8_t *key) {
+	uint8_t zero[BC_LEN] = { 0 };
+	int len = BC_LEN;
+
+	/* Encrypting a zero block in CTR mode returns the counter encrypted. */
+	bc_aes_ctr_enc(out, &len, zero, BC_LEN, key, 8 * RAND_KEY, in);
+}
+
+/**
+ * Computes the block cipher derivation function.
+ *
+ * @param[out] out			- the result with RAND_SEED bytes.
+ * @param[in] in			- the input string.
+ * @param[in] in_len		- the number of bytes in the input.
+ */
+static void rand_df(uint8_t *out, uint8_t *in, int in_len) {
+	int i, j, k, len = CEIL(2 * sizeof(uint32_t) + in_len + 1, BC_LEN);
+	uint8_t s[len * BC_LEN], key[RAND_KEY], t[RAND_SEED + BC_LEN], x[BC_LEN];
+	uint32_t l;
+
+	/* S = L || N || input_string || 0x80 || 0^*. */
+	memset(s, 0, sizeof(s));
+	l = util_conv_big(in_len);
+	memcpy(s, &l, sizeof(uint32_t));
+	l = util_conv_big(RAND_SEED);
+	memcpy(s + sizeof(uint32_t), &l, sizeof(uint32_t));
+	memcpy(s + 2 * sizeof(uint32_t), in, in_len);
+	s[2 * sizeof(uint32_t) + in_len] = 0x80;
+
+	/* K = 0x00010203...1F. */
+	for (i = 0; i < RAND_KEY; i++) {
+		key[i] = i;
+	}
+
+	for (i = 0; i < CEIL(RAND_SEED, BC_LEN); i++) {
+		/* temp = temp || BCC(K, (IV || S)), with IV = i || 0^*. */
+		memset(x, 0, BC_LEN);
+		x[sizeof(uint32_t) - 1] = i;
+		rand_enc(x, x, key);
+		for (j = 0; j < len; j++) {
+			for (k = 0; k < BC_LEN; k++) {
+				x[k] ^= s[j * BC_LEN + k];
+			}
+			rand_enc(x, x, key);
+		}
+		memcpy(t + i * BC_LEN, x, BC_LEN);
+	}
+
+	/* K = leftmost(temp, keylen), X = select(temp, keylen + 1, seedlen). */
+	memcpy(key, t, RAND_KEY);
+	memcpy(x, t + RAND_KEY, BC_LEN);
+	for (i = 0; i < CEIL(RAND_SEED, BC_LEN); i++) {
+		/* X = Block_Encrypt(K, X), temp = temp || X. */
+		rand_enc(x, x, key);
+		memcpy(out + i * BC_LEN, x, BC_LEN);
+	}
+}
+
+/**
+ * Encrypts the given bytes in CTR mode under the current key and counter block
+ * and replaces the key and counter block with the last RAND_SEED bytes
+ * produced. The buffer may overlap the internal state, in which case the old
+ * key and counter block are read as zeros.
+ *
+ * @param[in,out] buf		- the bytes to encrypt.
+ * @param[in] len			- the number of bytes, including RAND_SEED.
+ */
+static void rand_ctr(uint8_t *buf, int len) {
+	uint8_t key[RAND_KEY], v[BC_LEN];
+	ctx_t *ctx = core_get();
+	int i;
+
+	memcpy(key, ctx->rand + RAND_BUF, RAND_KEY);
+	memcpy(v, ctx->rand + RAND_BUF + RAND_KEY, BC_LEN);
+	memset(ctx->rand + RAND_BUF, 0, RAND_SEED);
+	/* V = (V + 1) mod 2^blocklen. */
+	for (i = BC_LEN - 1; i >= 0; i--) {
+		if (++v[i] != 0) {
+			break;
+		}
+	}
+	bc_aes_ctr_enc(buf, &len, buf, len, key, 8 * RAND_KEY, v);
+	/* (K, V) = rightmost(temp, seedlen). */
+	memmove(ctx->rand + RAND_BUF, buf + len - RAND_SEED, RAND_SEED);
+}
+
+/**
+ * Refills the buffer of pre-generated bytes. The keystream is generated
+ * together with the next key and counter block, since updating the state with
+ * no additional input continues the same counter sequence.
+ */
+static void rand_gen(void) {
+	ctx_t *ctx = core_get();
+
+	memset(ctx->rand, 0, RAND_SIZE - RAND_SEED);
+	rand_ctr(ctx->rand, RAND_SIZE);
+	ctx->counter = RAND_BUF;
+}
+
+#endif
+
+/*============================================================================*/
+/* Public definitions                                                         */
+/*============================================================================*/
+
+#if RAND == CTR
+
+void rand_bytes(uint8_t *buf, int size) {
+	ctx_t *ctx = core_get();
+	int len;
+
+	while (size > 0) {
+		if (ctx->counter == 0) {
+			rand_gen();
+		}
+		/* Serve from the buffer and erase the bytes already returned. */
+		len = MIN(size, ctx->counter);
+		memcpy(buf, ctx->rand + RAND_BUF - ctx->counter, len);
+		memset(ctx->rand + RAND_BUF - ctx->counter, 0, len);
+		ctx->counter -= len;
+		buf += len;
+		size -= len;
+	}
+}
+
+void rand_seed(uint8_t *buf, int size) {
+	ctx_t *ctx = core_get();
+	uint8_t seed[RAND_SEED];
+
+	if (size <= 0) {
+		THROW(ERR_NO_VALID);
+	}
+
+	if (ctx->seeded == 0) {
+		/* K = 0^keylen, V = 0^blocklen. */
+		memset(ctx->rand, 0, RAND_SIZE);
+	}
+	/* (K, V) = update(df(seed_material), K, V). */
+	rand_df(seed, buf, size);
+	rand_ctr(seed, RAND_SEED);
+	/* Discard any pre-generated bytes from the previous state. */
+	memset(ctx->rand, 0, RAND_BUF);
+	ctx->counter = 0;
+	ctx->seeded = 1;
+}
+
+#endif
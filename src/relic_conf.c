@@ -84,6 +84,9 @@ void conf_print(void) {
 #ifdef WITH_BN
 	util_print("** Multiple precision module options:\n");
 	util_print("   Precision: %d bits, %d words\n", BN_BITS, BN_DIGS);
+#ifdef BN_SMALL
+	util_print("   Inline storage: %d words\n", BN_SMALL_DIGS);
+#endif
 	util_print("   Arithmetic method: " BN_METHD "\n\n");
 #endif
 
@@ -67,9 +67,207 @@ thread ctx_t first_ctx;
  */
 thread ctx_t *core_ctx = NULL;
 
+/**
+ * Flag indicating that the current thread is running a parallel job.
+ */
+static thread int core_busy = 0;
+
 #if MULTI == OPENMP
-#pragma omp threadprivate(first_ctx, core_ctx)
+#pragma omp threadprivate(first_ctx, core_ctx, core_busy)
+#endif
+
+/**
+ * State shared by the threads running a parallel operation.
+ */
+typedef struct {
+	/** The job to run. */
+	core_job_t job;
+	/** The arguments of the job. */
+	void *args;
+	/** The number of indices. */
+	int n;
+	/** The next index to be processed. */
+	int next;
+	/** Flag indicating if the job failed for some index. */
+	int fail;
+	/** The library context of the thread that started the operation. */
+	ctx_t *ctx;
+#if RAND == HASH || RAND == CTR || RAND == FIPS
+	/** The number of seeds already taken by the other threads. */
+	int seeds;
+	/** Seeds drawn from the caller's generator, one for each other thread. */
+	uint8_t seed[CORES][SEED_SIZE];
+#endif
+#if MULTI == PTHREAD
+	/** Lock protecting the counters. */
+	pthread_mutex_t lock;
+#endif
+} par_t;
+
+/**
+ * Increments a counter of a parallel operation atomically.
+ *
+ * @param[in,out] par			- the parallel operation.
+ * @param[in,out] counter		- the counter to increment.
+ * @return the value of the counter before the increment.
+ */
+static int core_par_take(par_t *par, int *counter) {
+	int i;
+
+#if MULTI == PTHREAD
+	pthread_mutex_lock(&par->lock);
+	i = (*counter)++;
+	pthread_mutex_unlock(&par->lock);
+#elif MULTI == OPENMP
+	(void)par;
+#pragma omp critical (core_par)
+	i = (*counter)++;
+#else
+	(void)par;
+	i = (*counter)++;
+#endif
+	return i;
+}
+
+/**
+ * Runs pending indices of a parallel operation in the current context until
+ * none is left.
+ *
+ * @param[in,out] par			- the parallel operation.
+ */
+static void core_par_loop(par_t *par) {
+	ctx_t *ctx = core_get();
+	int i, code = ctx->code;
+
+	core_busy = 1;
+	while ((i = core_par_take(par, &par->next)) < par->n) {
+		ctx->code = STS_OK;
+		TRY {
+			par->job(par->args, i);
+		}
+		CATCH_ANY {
+			par->fail = 1;
+		}
+		if (ctx->code != STS_OK) {
+			par->fail = 1;
+		}
+	}
+	ctx->code = code;
+	core_busy = 0;
+}
+
+#if MULTI == OPENMP || (MULTI == PTHREAD && CORES > 1)
+
+/**
+ * Prepares the context of a thread taking part in a parallel operation. Only
+ * the error state and the generator belong to the new context: the selected
+ * fields and curves, together with their precomputation tables, are referenced
+ * read-only from the context of the thread that started the operation.
+ *
+ * @param[out] ctx				- the new context, filled with zeros.
+ * @param[in,out] par			- the parallel operation.
+ */
+static void core_par_ctx(ctx_t *ctx, par_t *par) {
+	ctx_t *src = par->ctx;
+
+	ctx->code = STS_OK;
+#ifdef CHECK
+	memcpy(ctx->reason, src->reason, sizeof(ctx->reason));
+#endif
+
+#ifdef WITH_FB
+	ctx->fb = src->fb;
+#endif
+#ifdef WITH_FP
+	ctx->fp = src->fp;
+#endif
+#ifdef WITH_EP
+	ctx->ep = src->ep;
+#endif
+
+#ifdef WITH_EB
+	ctx->eb_id = src->eb_id;
+	memcpy(ctx->eb_a, src->eb_a, sizeof(ctx->eb_a));
+	memcpy(ctx->eb_b, src->eb_b, sizeof(ctx->eb_b));
+	ctx->eb_opt_a = src->eb_opt_a;
+	ctx->eb_opt_b = src->eb_opt_b;
+	ctx->eb_g = src->eb_g;
+	ctx->eb_r = src->eb_r;
+	ctx->eb_h = src->eb_h;
+	ctx->eb_is_kbltz = src->eb_is_kbltz;
+#ifdef EB_PRECO
+	memcpy(ctx->eb_ptr, src->eb_ptr, sizeof(ctx->eb_ptr));
+#endif
+#endif /* WITH_EB */
+
+#ifdef WITH_EPX
+	/* Points and integers only alias the caller's storage, which is fine for
+	 * read-only use. */
+	ctx->ep2_g = src->ep2_g;
+	memcpy(ctx->ep2_a, src->ep2_a, sizeof(ctx->ep2_a));
+	memcpy(ctx->ep2_b, src->ep2_b, sizeof(ctx->ep2_b));
+	ctx->ep2_r = src->ep2_r;
+	ctx->ep2_h = src->ep2_h;
+	ctx->ep2_is_twist = src->ep2_is_twist;
+#ifdef EP_PRECO
+	memcpy(ctx->ep2_ptr, src->ep2_ptr, sizeof(ctx->ep2_ptr));
+#endif
+#endif /* WITH_EPX */
+
+#ifdef WITH_ED
+	ctx->ed_id = src->ed_id;
+	memcpy(ctx->ed_a, src->ed_a, sizeof(ctx->ed_a));
+	memcpy(ctx->ed_d, src->ed_d, sizeof(ctx->ed_d));
+	ctx->ed_g = src->ed_g;
+	ctx->ed_r = src->ed_r;
+	ctx->ed_h = src->ed_h;
+#ifdef ED_PRECO
+	memcpy(ctx->ed_ptr, src->ed_ptr, sizeof(ctx->ed_ptr));
+#endif
+#endif /* WITH_ED */
+
+#if RAND == HASH || RAND == CTR || RAND == FIPS
+	/* Copying the generator would repeat the caller's stream in every thread,
+	 * so each thread seeds its own generator with a fresh seed. */
+	core_set(ctx);
+	rand_seed(par->seed[core_par_take(par, &par->seeds)], SEED_SIZE);
+#elif RAND == UDEV
+	/* Reading from the same descriptor is thread-safe. */
+	memcpy(ctx->rand, src->rand, sizeof(ctx->rand));
+	ctx->seeded = src->seeded;
+#elif RAND == CALL
+	ctx->rand_call = src->rand_call;
+	ctx->rand_args = src->rand_args;
+	ctx->seeded = src->seeded;
 #endif
+}
+
+/**
+ * Runs pending indices of a parallel operation in a new thread, using a light
+ * copy of the context of the thread that started the operation.
+ *
+ * @param[in,out] arg			- the parallel operation.
+ * @return NULL.
+ */
+static void *core_par_work(void *arg) {
+	par_t *par = (par_t *)arg;
+	ctx_t *ctx, *old = core_get();
+
+	/* The other threads take over the work if no context is available. */
+	ctx = (ctx_t *)calloc(1, sizeof(ctx_t));
+	if (ctx == NULL) {
+		return NULL;
+	}
+
+	core_par_ctx(ctx, par);
+	core_set(ctx);
+	core_par_loop(par);
+	core_set(old);
+	free(ctx);
+	return NULL;
+}
+
+#endif /* MULTI == OPENMP || (MULTI == PTHREAD && CORES > 1) */
 
 int core_init(void) {
 	if (core_ctx == NULL) {
@@ -91,10 +289,15 @@ int core_init(void) {
 	core_ctx->reason[ERR_NO_CURVE] = MSG_NO_CURVE;
 	core_ctx->reason[ERR_NO_CONFIG] = MSG_NO_CONFIG;
 	core_ctx->last = NULL;
+#ifdef CHECK_FAST
+	core_ctx->pending = 0;
+#endif
 #endif /* CHECK */
 
 #if ALLOC == STATIC
-	core_ctx->next = 0;
+	if (pool_init() != STS_OK) {
+		return STS_ERR;
+	}
 #endif
 
 #ifdef OVERH
@@ -103,6 +306,23 @@ int core_init(void) {
 
 	core_ctx->code = STS_OK;
 
+#ifdef WITH_FP
+	core_ctx->fp = &(core_ctx->fp_def);
+#endif
+#ifdef WITH_FB
+	/* The binary field tables are large, so keep them out of the context. */
+	core_ctx->fb_def = (fb_field_t)calloc(1, sizeof(fb_field_st));
+	if (core_ctx->fb_def == NULL) {
+		return STS_ERR;
+	}
+	core_ctx->fb = core_ctx->fb_def;
+	core_ctx->fb_shared = NULL;
+#endif
+#ifdef WITH_EP
+	core_ctx->ep = &(core_ctx->ep_def);
+	core_ctx->ep_shared = NULL;
+#endif
+
 	TRY {
 		arch_init();
 		rand_init();
@@ -137,11 +357,20 @@ int core_init(void) {
 
 int core_clean(void) {
 	rand_clean();
+#ifdef WITH_EP
+	ep_param_release();
+	ep_curve_set(NULL);
+#endif
 #ifdef WITH_FP
+	fp_field_set(NULL);
 	fp_prime_clean();
 #endif
 #ifdef WITH_FB
+	fb_param_release();
+	fb_field_set(NULL);
 	fb_poly_clean();
+	free(core_ctx->fb_def);
+	core_ctx->fb_def = NULL;
 #endif
 #ifdef WITH_FT
 	ft_poly_clean();
@@ -157,6 +386,9 @@ int core_clean(void) {
 #endif
 #ifdef WITH_PP
 	pp_map_clean();
+#endif
+#if ALLOC == STATIC
+	pool_clean();
 #endif
 	arch_clean();
 	core_ctx = NULL;
@@ -170,3 +402,74 @@ ctx_t *core_get() {
 void core_set(ctx_t *ctx) {
 	core_ctx = ctx;
 }
+
+int core_par_num(void) {
+#if MULTI == NONE || ALLOC == STATIC
+	return 1;
+#else
+	return CORES;
+#endif
+}
+
+void core_par(core_job_t job, void *args, int n) {
+	par_t par;
+	int t = MIN(core_par_num(), n);
+
+	par.job = job;
+	par.args = args;
+	par.n = n;
+	par.next = 0;
+	par.fail = 0;
+	par.ctx = core_get();
+
+#if RAND == HASH || RAND == CTR || RAND == FIPS
+	par.seeds = 0;
+	if (t > 1 && !core_busy) {
+		rand_bytes((uint8_t *)par.seed, (t - 1) * SEED_SIZE);
+	}
+#endif
+
+#if MULTI == PTHREAD
+	/* The counters are locked even when the indices run sequentially. */
+	pthread_mutex_init(&par.lock, NULL);
+#endif
+
+	if (t <= 1 || core_busy) {
+		/* Run nested or small operations sequentially. */
+		int busy = core_busy;
+		core_par_loop(&par);
+		core_busy = busy;
+	} else {
+#if MULTI == PTHREAD && CORES > 1
+		pthread_t tid[CORES];
+		int i, s[CORES];
+
+		for (i = 1; i < t; i++) {
+			s[i] = pthread_create(&tid[i], NULL, core_par_work, &par);
+		}
+		core_par_loop(&par);
+		for (i = 1; i < t; i++) {
+			if (s[i] == 0) {
+				pthread_join(tid[i], NULL);
+			}
+		}
+#elif MULTI == OPENMP
+#pragma omp parallel num_threads(t)
+		{
+			if (omp_get_thread_num() == 0) {
+				core_par_loop(&par);
+			} else {
+				core_par_work(&par);
+			}
+		}
+#endif
+	}
+
+#if MULTI == PTHREAD
+	pthread_mutex_destroy(&par.lock);
+#endif
+
+	if (par.fail) {
+		THROW(ERR_CAUGHT);
+	}
+}
@@ -90,16 +90,41 @@ void err_full_msg(const char *function, const char *file, int line,
 
 void err_get_msg(err_t *e, char **msg) {
 	ctx_t *ctx = core_get();
+#ifdef CHECK_FAST
+	*e = ctx->number;
+	ctx->pending = 0;
+#else
 	*e = *(ctx->last->error);
-	*msg = ctx->reason[*e];
 	ctx->last = NULL;
+#endif
+	*msg = ctx->reason[*e];
 }
 
+#ifdef CHECK_FAST
+
+int err_catch(err_t *e) {
+	ctx_t *ctx = core_get();
+
+	if (ctx->pending == 0) {
+		return 0;
+	}
+	ctx->pending = 0;
+	if (e != NULL) {
+		*e = ctx->number;
+	}
+	return 1;
+}
+
+#endif
+
 #endif /* CHECK */
 
 int err_get_code(void) {
 	ctx_t *ctx = core_get();
 	int r = ctx->code;
 	ctx->code = STS_OK;
+#ifdef CHECK_FAST
+	ctx->pending = 0;
+#endif
 	return r;
 }
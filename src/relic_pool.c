@@ -39,45 +39,193 @@
 #include "relic_bn.h"
 #include "relic_pool.h"
 
+/*============================================================================*/
+/* Private definitions                                                        */
+/*============================================================================*/
+
+#if ALLOC == STATIC
+
+/**
+ * If multi-threading is enabled, assigns each thread a local copy of the data.
+ */
+#if MULTI == PTHREAD
+#define thread 	__thread
+#else
+#define thread /* */
+#endif
+
+/**
+ * Arena supplied for the next pool to be initialized.
+ */
+static thread pool_t *pool_next_base = NULL;
+
+/**
+ * Number of elements in the arena supplied for the next pool.
+ */
+static thread int pool_next_size = 0;
+
+/**
+ * Static pool taken by the first library context initialized by each thread.
+ */
+static thread pool_t pool_def[POOL_SIZE];
+
+/**
+ * Library context using the static pool, if any.
+ */
+static thread ctx_t *pool_owner = NULL;
+
+#if MULTI == OPENMP
+#pragma omp threadprivate(pool_next_base, pool_next_size, pool_def, pool_owner)
+#endif
+
+/**
+ * Aligns the start of an arena and counts the pool elements that fit in it.
+ *
+ * @param[out] size			- the number of elements.
+ * @param[in] arena			- the memory region.
+ * @param[in] len			- the number of bytes in the memory region.
+ * @return the first element.
+ */
+static pool_t *pool_align(int *size, void *arena, int len) {
+	uintptr_t base = (uintptr_t)arena;
+
+	base = (base + POOL_ALIGN - 1) / POOL_ALIGN * POOL_ALIGN;
+	len -= (int)(base - (uintptr_t)arena);
+	*size = (len < (int)sizeof(pool_t) ? 0 : len / (int)sizeof(pool_t));
+	return (pool_t *)base;
+}
+
+#endif /* ALLOC == STATIC */
+
 /*============================================================================*/
 /* Public definitions                                                         */
 /*============================================================================*/
 
 #if ALLOC == STATIC
 
+int pool_init(void) {
+	ctx_t *ctx = core_get();
+	int i;
+
+	ctx->pool_mem = NULL;
+	if (pool_next_base != NULL) {
+		ctx->pool_base = pool_next_base;
+		ctx->pool_size = pool_next_size;
+		pool_next_base = NULL;
+		pool_next_size = 0;
+	} else if (pool_owner == NULL || pool_owner == ctx) {
+		ctx->pool_base = pool_def;
+		ctx->pool_size = POOL_SIZE;
+		pool_owner = ctx;
+	} else {
+		/* The static pool is taken, so this context needs an arena. */
+		ctx->pool_mem = malloc(POOL_BYTES(POOL_SIZE));
+		if (ctx->pool_mem == NULL) {
+			ctx->pool_base = NULL;
+			ctx->pool_size = 0;
+			ctx->next = POOL_EMPTY;
+			return STS_ERR;
+		}
+		ctx->pool_base = pool_align(&i, ctx->pool_mem, POOL_BYTES(POOL_SIZE));
+		ctx->pool_size = POOL_SIZE;
+	}
+
+	/* Link all elements in the free list, in increasing address order. */
+	for (i = 0; i < ctx->pool_size; i++) {
+#ifdef CHECK
+		ctx->pool_base[i].state = POOL_FREE;
+#endif
+		ctx->pool_base[i].elem[0] = i + 1;
+		ctx->pool_base[i].elem[DV_DIGS] = i;
+	}
+	ctx->pool_base[ctx->pool_size - 1].elem[0] = (dig_t)POOL_EMPTY;
+
+	ctx->next = 0;
+	ctx->pool_used = ctx->pool_peak = 0;
+	return STS_OK;
+}
+
+void pool_clean(void) {
+	ctx_t *ctx = core_get();
+
+	if (pool_owner == ctx) {
+		pool_owner = NULL;
+	}
+	free(ctx->pool_mem);
+	ctx->pool_mem = NULL;
+	ctx->pool_base = NULL;
+	ctx->pool_size = 0;
+	ctx->next = POOL_EMPTY;
+}
+
+int pool_arena(void *arena, int len) {
+	pool_t *base;
+	int size;
+
+	if (arena == NULL) {
+		pool_next_base = NULL;
+		pool_next_size = 0;
+		return STS_OK;
+	}
+
+	base = pool_align(&size, arena, len);
+	if (size == 0) {
+		return STS_ERR;
+	}
+
+	pool_next_base = base;
+	pool_next_size = MIN(size, POOL_SIZE);
+	return STS_OK;
+}
+
+void pool_stats(int *used, int *peak, int *size) {
+	ctx_t *ctx = core_get();
+
+	*used = ctx->pool_used;
+	*peak = ctx->pool_peak;
+	*size = ctx->pool_size;
+}
+
 dig_t *pool_get(void) {
-	int i, r;
 	ctx_t *ctx = core_get();
+	dig_t *a;
 
 	if (ctx->next == POOL_EMPTY) {
 		return NULL;
 	}
 
-	/** Allocate a free element. */
-	r = ctx->next;
-	ctx->pool[r].state = POOL_USED;
+	/* Pop the head of the free list. */
+#ifdef CHECK
+	ctx->pool_base[ctx->next].state = POOL_USED;
+#endif
+	a = ctx->pool_base[ctx->next].elem;
+	ctx->next = (int)a[0];
 
-	/* Search for a new free element. */
-	for (i = (r + 1) % POOL_SIZE; i != r; i = (i + 1) % POOL_SIZE) {
-		if (ctx->pool[i].state == POOL_FREE) {
-			break;
-		}
-	}
-	if (i == r) {
-		ctx->next = POOL_EMPTY;
-	} else {
-		ctx->next = i;
+	ctx->pool_used++;
+	if (ctx->pool_used > ctx->pool_peak) {
+		ctx->pool_peak = ctx->pool_used;
 	}
-	ctx->pool[r].elem[DV_DIGS] = r;
-	return (ctx->pool[r].elem);
+	return a;
 }
 
 void pool_put(dig_t *a) {
-	int pos = a[DV_DIGS];
 	ctx_t *ctx = core_get();
 
-	ctx->pool[pos].state = POOL_FREE;
-	ctx->next = pos;
+#ifdef CHECK
+	dig_t pos = a[DV_DIGS];
+
+	if (pos >= (dig_t)ctx->pool_size || ctx->pool_base[pos].elem != a ||
+			ctx->pool_base[pos].state != POOL_USED) {
+		THROW(ERR_NO_VALID);
+		return;
+	}
+	ctx->pool_base[pos].state = POOL_FREE;
+#endif
+
+	/* Push the element as the new head of the free list. */
+	a[0] = (dig_t)ctx->next;
+	ctx->next = (int)a[DV_DIGS];
+	ctx->pool_used--;
 }
 
 #endif /* ALLOC == STATIC */
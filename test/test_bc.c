@@ -0,0 +1,362 @@
+/*
+ * RELIC is an Efficient LIbrary for Cryptography
+ * Copyright (C) 2007-2015 RELIC Authors
+ *
+ * This file is part of RELIC. RELIC is legal property of its developers,
+ * whose names are not listed here. Please refer to the COPYRIGHT file
+ * for contact information.
+ *
+ * RELIC is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * RELIC is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with RELIC. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+/**
+ * @file
+ *
+ * Tests for block ciphers.
+ *
+ * @ingroup test
+ */
+
+#include <stdio.h>
+
+#include "relic.h"
+#include "relic_test.h"
+
+/*
+ * Test vectors taken from:
+ * - http://csrc.nist.gov/publications/nistpubs/800-38a/sp800-38a.pdf
+ * - http://csrc.nist.gov/groups/ST/toolkit/BCM/documents/proposedmodes/gcm/gcm-spec.pdf
+ *
+ * The CBC vectors include the PKCS#7 padding of the message.
+ */
+
+uint8_t key128[] = {
+	0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7,
+	0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C,
+};
+
+uint8_t key192[] = {
+	0x8E, 0x73, 0xB0, 0xF7, 0xDA, 0x0E, 0x64, 0x52, 0xC8, 0x10,
+	0xF3, 0x2B, 0x80, 0x90, 0x79, 0xE5, 0x62, 0xF8, 0xEA, 0xD2,
+	0x52, 0x2C, 0x6B, 0x7B,
+};
+
+uint8_t key256[] = {
+	0x60, 0x3D, 0xEB, 0x10, 0x15, 0xCA, 0x71, 0xBE, 0x2B, 0x73,
+	0xAE, 0xF0, 0x85, 0x7D, 0x77, 0x81, 0x1F, 0x35, 0x2C, 0x07,
+	0x3B, 0x61, 0x08, 0xD7, 0x2D, 0x98, 0x10, 0xA3, 0x09, 0x14,
+	0xDF, 0xF4,
+};
+
+uint8_t iv[] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+	0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+};
+
+uint8_t nonce[] = {
+	0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9,
+	0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF,
+};
+
+uint8_t msg[] = {
+	0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D,
+	0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A, 0xAE, 0x2D, 0x8A, 0x57,
+	0x1E, 0x03, 0xAC, 0x9C, 0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF,
+	0x8E, 0x51, 0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11,
+	0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF, 0xF6, 0x9F,
+	0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17, 0xAD, 0x2B, 0x41, 0x7B,
+	0xE6, 0x6C, 0x37, 0x10,
+};
+
+uint8_t cbc128[] = {
+	0x76, 0x49, 0xAB, 0xAC, 0x81, 0x19, 0xB2, 0x46, 0xCE, 0xE9,
+	0x8E, 0x9B, 0x12, 0xE9, 0x19, 0x7D, 0x50, 0x86, 0xCB, 0x9B,
+	0x50, 0x72, 0x19, 0xEE, 0x95, 0xDB, 0x11, 0x3A, 0x91, 0x76,
+	0x78, 0xB2, 0x73, 0xBE, 0xD6, 0xB8, 0xE3, 0xC1, 0x74, 0x3B,
+	0x71, 0x16, 0xE6, 0x9E, 0x22, 0x22, 0x95, 0x16, 0x2C, 0x50,
+	0x9B, 0xD3, 0x96, 0x14, 0x8C, 0x7C, 0xE2, 0x05, 0x97, 0x8A,
+	0xBA, 0xE9, 0xEE, 0x61,
+};
+
+uint8_t cbc192[] = {
+	0x4F, 0x02, 0x1D, 0xB2, 0x43, 0xBC, 0x63, 0x3D, 0x71, 0x78,
+	0x18, 0x3A, 0x9F, 0xA0, 0x71, 0xE8, 0xB4, 0xD9, 0xAD, 0xA9,
+	0xAD, 0x7D, 0xED, 0xF4, 0xE5, 0xE7, 0x38, 0x76, 0x3F, 0x69,
+	0x14, 0x5A, 0x57, 0x1B, 0x24, 0x20, 0x12, 0xFB, 0x7A, 0xE0,
+	0x7F, 0xA9, 0xBA, 0xAC, 0x3D, 0xF1, 0x02, 0xE0, 0x08, 0xB0,
+	0xE2, 0x79, 0x88, 0x59, 0x88, 0x81, 0xD9, 0x20, 0xA9, 0xE6,
+	0x4F, 0x56, 0x15, 0xCD, 0x61, 0x2C, 0xCD, 0x79, 0x22, 0x4B,
+	0x35, 0x09, 0x35, 0xD4, 0x5D, 0xD6, 0xA9, 0x8F, 0x81, 0x76,
+};
+
+uint8_t ctr256[] = {
+	0x60, 0x1E, 0xC3, 0x13, 0x77, 0x57, 0x89, 0xA5, 0xB7, 0xA7,
+	0xF5, 0x04, 0xBB, 0xF3, 0xD2, 0x28, 0xF4, 0x43, 0xE3, 0xCA,
+	0x4D, 0x62, 0xB5, 0x9A, 0xCA, 0x84, 0xE9, 0x90, 0xCA, 0xCA,
+	0xF5, 0xC5, 0x2B, 0x09, 0x30, 0xDA, 0xA2, 0x3D, 0xE9, 0x4C,
+	0xE8, 0x70, 0x17, 0xBA, 0x2D, 0x84, 0x98, 0x8D, 0xDF, 0xC9,
+	0xC5, 0x8D, 0xB6, 0x7A, 0xAD, 0xA6, 0x13, 0xC2, 0xDD, 0x08,
+};
+
+uint8_t gcm_key[] = {
+	0xFE, 0xFF, 0xE9, 0x92, 0x86, 0x65, 0x73, 0x1C, 0x6D, 0x6A,
+	0x8F, 0x94, 0x67, 0x30, 0x83, 0x08,
+};
+
+uint8_t gcm_iv[] = {
+	0xCA, 0xFE, 0xBA, 0xBE, 0xFA, 0xCE, 0xDB, 0xAD, 0xDE, 0xCA,
+	0xF8, 0x88,
+};
+
+uint8_t gcm_iv2[] = {
+	0x93, 0x13, 0x22, 0x5D, 0xF8, 0x84, 0x06, 0xE5, 0x55, 0x90,
+	0x9C, 0x5A, 0xFF, 0x52, 0x69, 0xAA, 0x6A, 0x7A, 0x95, 0x38,
+	0x53, 0x4F, 0x7D, 0xA1, 0xE4, 0xC3, 0x03, 0xD2, 0xA3, 0x18,
+	0xA7, 0x28, 0xC3, 0xC0, 0xC9, 0x51, 0x56, 0x80, 0x95, 0x39,
+	0xFC, 0xF0, 0xE2, 0x42, 0x9A, 0x6B, 0x52, 0x54, 0x16, 0xAE,
+	0xDB, 0xF5, 0xA0, 0xDE, 0x6A, 0x57, 0xA6, 0x37, 0xB3, 0x9B,
+};
+
+uint8_t gcm_aad[] = {
+	0xFE, 0xED, 0xFA, 0xCE, 0xDE, 0xAD, 0xBE, 0xEF, 0xFE, 0xED,
+	0xFA, 0xCE, 0xDE, 0xAD, 0xBE, 0xEF, 0xAB, 0xAD, 0xDA, 0xD2,
+};
+
+uint8_t gcm_msg[] = {
+	0xD9, 0x31, 0x32, 0x25, 0xF8, 0x84, 0x06, 0xE5, 0xA5, 0x59,
+	0x09, 0xC5, 0xAF, 0xF5, 0x26, 0x9A, 0x86, 0xA7, 0xA9, 0x53,
+	0x15, 0x34, 0xF7, 0xDA, 0x2E, 0x4C, 0x30, 0x3D, 0x8A, 0x31,
+	0x8A, 0x72, 0x1C, 0x3C, 0x0C, 0x95, 0x95, 0x68, 0x09, 0x53,
+	0x2F, 0xCF, 0x0E, 0x24, 0x49, 0xA6, 0xB5, 0x25, 0xB1, 0x6A,
+	0xED, 0xF5, 0xAA, 0x0D, 0xE6, 0x57, 0xBA, 0x63, 0x7B, 0x39,
+	0x1A, 0xAF, 0xD2, 0x55,
+};
+
+uint8_t gcm128[] = {
+	0x42, 0x83, 0x1E, 0xC2, 0x21, 0x77, 0x74, 0x24, 0x4B, 0x72,
+	0x21, 0xB7, 0x84, 0xD0, 0xD4, 0x9C, 0xE3, 0xAA, 0x21, 0x2F,
+	0x2C, 0x02, 0xA4, 0xE0, 0x35, 0xC1, 0x7E, 0x23, 0x29, 0xAC,
+	0xA1, 0x2E, 0x21, 0xD5, 0x14, 0xB2, 0x54, 0x66, 0x93, 0x1C,
+	0x7D, 0x8F, 0x6A, 0x5A, 0xAC, 0x84, 0xAA, 0x05, 0x1B, 0xA3,
+	0x0B, 0x39, 0x6A, 0x0A, 0xAC, 0x97, 0x3D, 0x58, 0xE0, 0x91,
+	0x5B, 0xC9, 0x4F, 0xBC, 0x32, 0x21, 0xA5, 0xDB, 0x94, 0xFA,
+	0xE9, 0x5A, 0xE7, 0x12, 0x1A, 0x47,
+};
+
+uint8_t gcm128_iv2[] = {
+	0x8C, 0xE2, 0x49, 0x98, 0x62, 0x56, 0x15, 0xB6, 0x03, 0xA0,
+	0x33, 0xAC, 0xA1, 0x3F, 0xB8, 0x94, 0xBE, 0x91, 0x12, 0xA5,
+	0xC3, 0xA2, 0x11, 0xA8, 0xBA, 0x26, 0x2A, 0x3C, 0xCA, 0x7E,
+	0x2C, 0xA7, 0x01, 0xE4, 0xA9, 0xA4, 0xFB, 0xA4, 0x3C, 0x90,
+	0xCC, 0xDC, 0xB2, 0x81, 0xD4, 0x8C, 0x7C, 0x6F, 0xD6, 0x28,
+	0x75, 0xD2, 0xAC, 0xA4, 0x17, 0x03, 0x4C, 0x34, 0xAE, 0xE5,
+	0x61, 0x9C, 0xC5, 0xAE, 0xFF, 0xFE, 0x0B, 0xFA, 0x46, 0x2A,
+	0xF4, 0x3C, 0x16, 0x99, 0xD0, 0x50,
+};
+
+uint8_t gcm256[] = {
+	0x52, 0x2D, 0xC1, 0xF0, 0x99, 0x56, 0x7D, 0x07, 0xF4, 0x7F,
+	0x37, 0xA3, 0x2A, 0x84, 0x42, 0x7D, 0x64, 0x3A, 0x8C, 0xDC,
+	0xBF, 0xE5, 0xC0, 0xC9, 0x75, 0x98, 0xA2, 0xBD, 0x25, 0x55,
+	0xD1, 0xAA, 0x8C, 0xB0, 0x8E, 0x48, 0x59, 0x0D, 0xBB, 0x3D,
+	0xA7, 0xB0, 0x8B, 0x10, 0x56, 0x82, 0x88, 0x38, 0xC5, 0xF6,
+	0x1E, 0x63, 0x93, 0xBA, 0x7A, 0x0A, 0xBC, 0xC9, 0xF6, 0x62,
+	0x76, 0xFC, 0x6E, 0xCE, 0x0F, 0x4E, 0x17, 0x68, 0xCD, 0xDF,
+	0x88, 0x53, 0xBB, 0x2D, 0x55, 0x1B,
+};
+
+static int cbc(void) {
+	int len, code = STS_ERR;
+	uint8_t out[sizeof(cbc192)], in[sizeof(cbc192)];
+
+	TEST_ONCE("aes-128 in cbc mode is correct") {
+		len = sizeof(out);
+		TEST_ASSERT(bc_aes_cbc_enc(out, &len, msg, sizeof(msg) - 4, key128,
+						8 * sizeof(key128), iv) == STS_OK, end);
+		TEST_ASSERT(len == sizeof(cbc128), end);
+		TEST_ASSERT(memcmp(out, cbc128, len) == 0, end);
+		TEST_ASSERT(bc_aes_cbc_dec(out, &len, out, len, key128,
+						8 * sizeof(key128), iv) == STS_OK, end);
+		TEST_ASSERT(len == sizeof(msg) - 4, end);
+		TEST_ASSERT(memcmp(out, msg, len) == 0, end);
+	}
+	TEST_END;
+
+	TEST_ONCE("aes-192 in cbc mode is correct") {
+		len = sizeof(out);
+		TEST_ASSERT(bc_aes_cbc_enc(out, &len, msg, sizeof(msg), key192,
+						8 * sizeof(key192), iv) == STS_OK, end);
+		TEST_ASSERT(len == sizeof(cbc192), end);
+		TEST_ASSERT(memcmp(out, cbc192, len) == 0, end);
+		TEST_ASSERT(bc_aes_cbc_dec(in, &len, out, len, key192,
+						8 * sizeof(key192), iv) == STS_OK, end);
+		TEST_ASSERT(len == sizeof(msg), end);
+		TEST_ASSERT(memcmp(in, msg, len) == 0, end);
+	}
+	TEST_END;
+
+	TEST_ONCE("aes in cbc mode rejects invalid padding") {
+		memcpy(out, cbc128, sizeof(cbc128));
+		out[sizeof(cbc128) - BC_LEN - 1] ^= 0x01;
+		len = sizeof(out);
+		TEST_ASSERT(bc_aes_cbc_dec(out, &len, out, sizeof(cbc128), key128,
+						8 * sizeof(key128), iv) == STS_ERR, end);
+	}
+	TEST_END;
+
+	code = STS_OK;
+
+  end:
+	return code;
+}
+
+static int ctr(void) {
+	int len, code = STS_ERR;
+	uint8_t out[sizeof(ctr256)], buf[1000], tmp[1000], k[32], v[BC_LEN];
+
+	TEST_ONCE("aes-256 in ctr mode is correct") {
+		len = sizeof(out);
+		TEST_ASSERT(bc_aes_ctr_enc(out, &len, msg, sizeof(ctr256), key256,
+						8 * sizeof(key256), nonce) == STS_OK, end);
+		TEST_ASSERT(len == sizeof(ctr256), end);
+		TEST_ASSERT(memcmp(out, ctr256, len) == 0, end);
+		TEST_ASSERT(bc_aes_ctr_dec(out, &len, out, len, key256,
+						8 * sizeof(key256), nonce) == STS_OK, end);
+		TEST_ASSERT(memcmp(out, msg, len) == 0, end);
+	}
+	TEST_END;
+
+	TEST_BEGIN("aes in ctr mode in place is consistent") {
+		rand_bytes(buf, sizeof(buf));
+		rand_bytes(k, sizeof(k));
+		rand_bytes(v, sizeof(v));
+		len = sizeof(tmp);
+		TEST_ASSERT(bc_aes_ctr_enc(tmp, &len, buf, sizeof(buf), k,
+						8 * sizeof(k), v) == STS_OK, end);
+		TEST_ASSERT(bc_aes_ctr_enc(buf, &len, buf, len, k, 8 * sizeof(k), v)
+				== STS_OK, end);
+		TEST_ASSERT(memcmp(buf, tmp, len) == 0, end);
+	}
+	TEST_END;
+
+	code = STS_OK;
+
+  end:
+	return code;
+}
+
+static int gcm(void) {
+	int len, code = STS_ERR;
+	uint8_t out[sizeof(gcm_msg) + BC_LEN], key[2 * sizeof(gcm_key)];
+
+	memcpy(key, gcm_key, sizeof(gcm_key));
+	memcpy(key + sizeof(gcm_key), gcm_key, sizeof(gcm_key));
+
+	TEST_ONCE("aes-128 in gcm mode is correct") {
+		len = sizeof(out);
+		TEST_ASSERT(bc_aes_gcm_enc(out, &len, gcm_msg, sizeof(gcm_msg) - 4,
+						gcm_key, 8 * sizeof(gcm_key), gcm_iv, sizeof(gcm_iv),
+						gcm_aad, sizeof(gcm_aad)) == STS_OK, end);
+		TEST_ASSERT(len == sizeof(gcm128), end);
+		TEST_ASSERT(memcmp(out, gcm128, len) == 0, end);
+		len = sizeof(out);
+		TEST_ASSERT(bc_aes_gcm_enc(out, &len, gcm_msg, sizeof(gcm_msg) - 4,
+						gcm_key, 8 * sizeof(gcm_key), gcm_iv2, sizeof(gcm_iv2),
+						gcm_aad, sizeof(gcm_aad)) == STS_OK, end);
+		TEST_ASSERT(len == sizeof(gcm128_iv2), end);
+		TEST_ASSERT(memcmp(out, gcm128_iv2, len) == 0, end);
+		TEST_ASSERT(bc_aes_gcm_dec(out, &len, out, len, gcm_key,
+						8 * sizeof(gcm_key), gcm_iv2, sizeof(gcm_iv2), gcm_aad,
+						sizeof(gcm_aad)) == STS_OK, end);
+		TEST_ASSERT(len == sizeof(gcm_msg) - 4, end);
+		TEST_ASSERT(memcmp(out, gcm_msg, len) == 0, end);
+	}
+	TEST_END;
+
+	TEST_ONCE("aes-256 in gcm mode is correct") {
+		memcpy(out, gcm_msg, sizeof(gcm_msg) - 4);
+		len = sizeof(out);
+		TEST_ASSERT(bc_aes_gcm_enc(out, &len, out, sizeof(gcm_msg) - 4, key,
+						8 * sizeof(key), gcm_iv, sizeof(gcm_iv), gcm_aad,
+						sizeof(gcm_aad)) == STS_OK, end);
+		TEST_ASSERT(len == sizeof(gcm256), end);
+		TEST_ASSERT(memcmp(out, gcm256, len) == 0, end);
+		TEST_ASSERT(bc_aes_gcm_dec(out, &len, out, len, key, 8 * sizeof(key),
+						gcm_iv, sizeof(gcm_iv), gcm_aad, sizeof(gcm_aad))
+				== STS_OK, end);
+		TEST_ASSERT(len == sizeof(gcm_msg) - 4, end);
+		TEST_ASSERT(memcmp(out, gcm_msg, len) == 0, end);
+	}
+	TEST_END;
+
+	TEST_ONCE("aes in gcm mode rejects forgeries") {
+		memcpy(out, gcm256, sizeof(gcm256));
+		out[0] ^= 0x01;
+		len = sizeof(out);
+		TEST_ASSERT(bc_aes_gcm_dec(out, &len, out, sizeof(gcm256), key,
+						8 * sizeof(key), gcm_iv, sizeof(gcm_iv), gcm_aad,
+						sizeof(gcm_aad)) == STS_ERR, end);
+		out[0] ^= 0x01;
+		len = sizeof(out);
+		TEST_ASSERT(bc_aes_gcm_dec(out, &len, out, sizeof(gcm256), key,
+						8 * sizeof(key), gcm_iv, sizeof(gcm_iv), gcm_aad,
+						sizeof(gcm_aad) - 1) == STS_ERR, end);
+	}
+	TEST_END;
+
+	code = STS_OK;
+
+  end:
+	return code;
+}
+
+int main(void) {
+	if (core_init() != STS_OK) {
+		core_clean();
+		return 1;
+	}
+
+	util_banner("Tests for the BC module:\n", 0);
+
+	/* Run the vectors with and without the instruction set extensions. */
+	for (int e = 1; e >= 0; e--) {
+		bc_aes_ext(e);
+		if (e) {
+			util_banner("Default engine:", 1);
+		} else {
+			util_banner("Constant-time engine:", 1);
+		}
+
+		if (cbc() != STS_OK) {
+			core_clean();
+			return 1;
+		}
+
+		if (ctr() != STS_OK) {
+			core_clean();
+			return 1;
+		}
+
+		if (gcm() != STS_OK) {
+			core_clean();
+			return 1;
+		}
+	}
+
+	util_banner("All tests have passed.\n", 0);
+
+	core_clean();
+	return 0;
+}
@@ -47,6 +47,20 @@ static int memory(void) {
 			bn_free(a);
 		}
 		TEST_END;
+
+#ifdef BN_SMALL
+		TEST_BEGIN("memory can grow beyond the inline buffer") {
+			bn_new(a);
+			TEST_ASSERT(a->alloc == BN_SMALL_DIGS, end);
+			bn_set_2b(a, 4 * BN_BITS);
+			TEST_ASSERT(a->alloc > BN_SMALL_DIGS, end);
+			bn_sub_dig(a, a, 1);
+			TEST_ASSERT(bn_bits(a) == 4 * BN_BITS, end);
+			TEST_ASSERT(bn_ham(a) == 4 * BN_BITS, end);
+			bn_free(a);
+		}
+		TEST_END;
+#endif
 	}
 	CATCH(e) {
 		switch (e) {
@@ -929,6 +943,31 @@ static int reduction(void) {
 		TEST_END;
 #endif
 
+		TEST_BEGIN("modular inversion is correct") {
+			bn_rand(a, BN_POS, BN_BITS);
+			bn_rand(b, BN_POS, BN_BITS / 2);
+			if (bn_is_even(b)) {
+				bn_add_dig(b, b, 1);
+			}
+			bn_gcd_ext(c, d, NULL, a, b);
+			if (bn_sign(d) == BN_NEG) {
+				bn_add(d, d, b);
+			}
+			if (bn_cmp_dig(c, 1) != CMP_EQ) {
+				bn_zero(d);
+			}
+			bn_mod_inv(e, a, b);
+			TEST_ASSERT(bn_cmp(e, d) == CMP_EQ, end);
+			bn_neg(a, a);
+			bn_sub(d, b, d);
+			if (bn_cmp(d, b) == CMP_EQ) {
+				bn_zero(d);
+			}
+			bn_mod_inv(a, a, b);
+			TEST_ASSERT(bn_cmp(a, d) == CMP_EQ, end);
+		}
+		TEST_END;
+
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -945,15 +984,19 @@ static int reduction(void) {
 
 static int exponentiation(void) {
 	int code = STS_ERR;
-	bn_t a, b, p;
+	bn_t a, b, c, d, p;
 
 	bn_null(a);
 	bn_null(b);
+	bn_null(c);
+	bn_null(d);
 	bn_null(p);
 
 	TRY {
 		bn_new(a);
 		bn_new(b);
+		bn_new(c);
+		bn_new(d);
 		bn_new(p);
 
 #if BN_MOD != PMERS
@@ -1014,6 +1057,32 @@ static int exponentiation(void) {
 		TEST_END;
 #endif
 
+#if BN_MXP == FIXED || !defined(STRIP)
+		TEST_BEGIN("fixed window modular exponentiation is correct") {
+			bn_rand(a, BN_POS, BN_BITS);
+			bn_mod(a, a, p);
+			bn_copy(b, a);
+			bn_mxp_fixed(b, b, p, p);
+			TEST_ASSERT(bn_cmp(a, b) == CMP_EQ, end);
+			/* Odd composite moduli and exponents longer than the modulus. */
+			bn_rand(d, BN_POS, BN_BITS / 2);
+			bn_set_bit(d, 0, 1);
+			bn_rand(a, BN_POS, BN_BITS);
+			bn_rand(b, BN_POS, BN_BITS - 1);
+			bn_mxp_fixed(c, a, b, d);
+			bn_sqr(c, c);
+			bn_mod(c, c, d);
+			bn_dbl(b, b);
+			bn_mxp_fixed(b, a, b, d);
+			TEST_ASSERT(bn_cmp(b, c) == CMP_EQ, end);
+			bn_set_dig(b, 1);
+			bn_mxp_fixed(c, a, b, d);
+			bn_mod(a, a, d);
+			TEST_ASSERT(bn_cmp(a, c) == CMP_EQ, end);
+		}
+		TEST_END;
+#endif
+
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -1022,6 +1091,8 @@ static int exponentiation(void) {
   end:
 	bn_free(a);
 	bn_free(b);
+	bn_free(c);
+	bn_free(d);
 	bn_free(p);
 	return code;
 }
@@ -1541,13 +1612,15 @@ static int digit(void) {
 }
 
 static int prime(void) {
-	int code = STS_ERR;
-	bn_t p;
+	int i, code = STS_ERR;
+	bn_t p, q;
 
 	bn_null(p);
+	bn_null(q);
 
 	TRY {
 		bn_new(p);
+		bn_new(q);
 
 		TEST_ONCE("prime generation is consistent") {
 			bn_gen_prime(p, BN_BITS);
@@ -1558,6 +1631,7 @@ static int prime(void) {
 		TEST_ONCE("basic prime generation is consistent") {
 			bn_gen_prime_basic(p, BN_BITS);
 			TEST_ASSERT(bn_is_prime(p) == 1, end);
+			TEST_ASSERT(bn_bits(p) == BN_BITS, end);
 		} TEST_END;
 #endif
 
@@ -1565,6 +1639,7 @@ static int prime(void) {
 		TEST_ONCE("safe prime generation is consistent") {
 			bn_gen_prime_safep(p, BN_BITS);
 			TEST_ASSERT(bn_is_prime(p) == 1, end);
+			TEST_ASSERT(bn_bits(p) == BN_BITS, end);
 			bn_sub_dig(p, p, 1);
 			bn_hlv(p, p);
 			TEST_ASSERT(bn_is_prime(p) == 1, end);
@@ -1591,6 +1666,27 @@ static int prime(void) {
 		TEST_ONCE("solovay-strassen prime testing is correct") {
 			TEST_ASSERT(bn_is_prime_solov(p) == 1, end);
 		} TEST_END;
+
+		TEST_ONCE("baillie-psw prime testing is correct") {
+			TEST_ASSERT(bn_is_prime_bpsw(p) == 1, end);
+			bn_zero(q);
+			for (i = 0; i < 4096; i++) {
+				TEST_ASSERT(bn_is_prime_bpsw(q) == bn_is_prime_basic(q), end);
+				bn_add_dig(q, q, 1);
+			}
+			/* Strong pseudoprimes to base 2 and strong Lucas pseudoprimes. */
+			bn_read_str(q, "2047", 4, 10);
+			TEST_ASSERT(bn_is_prime_bpsw(q) == 0, end);
+			bn_read_str(q, "3215031751", 10, 10);
+			TEST_ASSERT(bn_is_prime_bpsw(q) == 0, end);
+			bn_read_str(q, "5459", 4, 10);
+			TEST_ASSERT(bn_is_prime_bpsw(q) == 0, end);
+			bn_read_str(q, "5777", 4, 10);
+			TEST_ASSERT(bn_is_prime_bpsw(q) == 0, end);
+			bn_gen_prime(q, BN_BITS / 2);
+			bn_sqr(q, q);
+			TEST_ASSERT(bn_is_prime_bpsw(q) == 0, end);
+		} TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -1598,6 +1694,7 @@ static int prime(void) {
 	code = STS_OK;
   end:
 	bn_free(p);
+	bn_free(q);
 	return code;
 }
 
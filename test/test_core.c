@@ -33,6 +33,32 @@
 #include "relic.h"
 #include "relic_test.h"
 
+/**
+ * Squares an index into an array.
+ */
+static void square(void *args, int i) {
+	int *out = (int *)args;
+	out[i] = i * i;
+}
+
+/**
+ * Fails for a single index.
+ */
+static void failure(void *args, int i) {
+	(void)args;
+	if (i == 3) {
+		THROW(ERR_NO_VALID);
+	}
+}
+
+/**
+ * Draws a random block for an index.
+ */
+static void sample(void *args, int i) {
+	uint8_t (*out)[16] = (uint8_t (*)[16])args;
+	rand_bytes(out[i], sizeof(out[i]));
+}
+
 #if MULTI == PTHREAD
 
 void *master(void *ptr) {
@@ -97,6 +123,35 @@ int main(void) {
 		core_set(old_ctx);
 	} TEST_END;
 
+	TEST_ONCE("parallel jobs run for every index") {
+		int out[100] = { 0 }, i;
+		core_par(square, out, 100);
+		for (i = 0; i < 100; i++) {
+			TEST_ASSERT(out[i] == i * i, end);
+		}
+		TEST_ASSERT(err_get_code() == STS_OK, end);
+	} TEST_END;
+
+	TEST_ONCE("parallel jobs draw distinct random values") {
+		uint8_t out[32][16];
+		int i, j;
+		core_par(sample, out, 32);
+		for (i = 0; i < 32; i++) {
+			for (j = 0; j < i; j++) {
+				TEST_ASSERT(memcmp(out[i], out[j], 16) != 0, end);
+			}
+		}
+	} TEST_END;
+
+	TEST_ONCE("parallel jobs report errors") {
+		TRY {
+			core_par(failure, NULL, 8);
+		}
+		CATCH_ANY {
+		}
+		TEST_ASSERT(err_get_code() == STS_ERR, end);
+	} TEST_END;
+
 	code = STS_OK;
 
 #if MULTI == OPENMP
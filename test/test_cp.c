@@ -139,6 +139,25 @@ static int rsa(void) {
 			TEST_ASSERT(cp_rsa_ver(out, ol, h, MD_LEN, 1, pub) == 1, end);
 		} TEST_END;
 #endif
+
+#if CP_RSA == QUICK || !defined(STRIP)
+		result = cp_rsa_gen_multi(pub, prv, BN_BITS, CP_RSA_PRIMES);
+
+		TEST_BEGIN("multi-prime rsa encryption/signature is correct") {
+			TEST_ASSERT(result == STS_OK, end);
+			il = 10;
+			ol = BN_BITS / 8 + 1;
+			rand_bytes(in, il);
+			TEST_ASSERT(cp_rsa_enc(out, &ol, in, il, pub) == STS_OK, end);
+			TEST_ASSERT(cp_rsa_dec_quick(out, &ol, out, ol, prv) == STS_OK,
+					end);
+			TEST_ASSERT(memcmp(in, out, ol) == 0, end);
+			ol = BN_BITS / 8 + 1;
+			TEST_ASSERT(cp_rsa_sig_quick(out, &ol, in, il, 0, prv) == STS_OK,
+					end);
+			TEST_ASSERT(cp_rsa_ver(out, ol, in, il, 0, pub) == 1, end);
+		} TEST_END;
+#endif
 	} CATCH_ANY {
 		ERROR(end);
 	}
@@ -934,6 +953,14 @@ static int bgn(void) {
 			TEST_ASSERT(in == out, end);
 		} TEST_END;
 
+		TEST_BEGIN("boneh-go-nissim decryption of large plaintexts is correct") {
+			rand_bytes((unsigned char *)&in, sizeof(dig_t));
+			in = in % 1000000;
+			TEST_ASSERT(cp_bgn_enc1(c, in, pub) == STS_OK, end);
+			TEST_ASSERT(cp_bgn_dec1(&out, c, prv) == STS_OK, end);
+			TEST_ASSERT(in == out, end);
+		} TEST_END;
+
 		TEST_BEGIN("boneh-go-nissim encryption is additively homomorphic") {
 			rand_bytes((unsigned char *)&in, sizeof(dig_t));
 			in = in % 11;
@@ -996,23 +1023,68 @@ static int bgn(void) {
 static int bls(void) {
 	int code = STS_ERR;
 	bn_t d;
-	g1_t s;
-	g2_t q;
-	uint8_t m[5] = { 0, 1, 2, 3, 4 };
+	g1_t s, sigs[4];
+	g2_t q, qs[4];
+	uint8_t m[5] = { 0, 1, 2, 3, 4 }, _m[4][5], *msgs[4];
+	int lens[4], ver[4];
 
 	bn_null(d);
 	g1_null(s);
 	g2_null(q);
+	for (int i = 0; i < 4; i++) {
+		g1_null(sigs[i]);
+		g2_null(qs[i]);
+	}
 
 	TRY {
 		bn_new(d);
 		g1_new(s);
 		g2_new(q);
+		for (int i = 0; i < 4; i++) {
+			g1_new(sigs[i]);
+			g2_new(qs[i]);
+		}
 
 		TEST_BEGIN("boneh-lynn-schacham short signature is correct") {
 			TEST_ASSERT(cp_bls_gen(d, q) == STS_OK, end);
 			TEST_ASSERT(cp_bls_sig(s, m, sizeof(m), d) == STS_OK, end);
 			TEST_ASSERT(cp_bls_ver(s, m, sizeof(m), q) == 1, end);
+			m[0] ^= 1;
+			TEST_ASSERT(cp_bls_ver(s, m, sizeof(m), q) == 0, end);
+			m[0] ^= 1;
+		}
+		TEST_END;
+
+		TEST_BEGIN("boneh-lynn-schacham aggregate signature is correct") {
+			for (int i = 0; i < 4; i++) {
+				memcpy(_m[i], m, sizeof(m));
+				_m[i][0] = i;
+				msgs[i] = _m[i];
+				lens[i] = sizeof(m);
+				TEST_ASSERT(cp_bls_gen(d, qs[i]) == STS_OK, end);
+				TEST_ASSERT(cp_bls_sig(sigs[i], msgs[i], lens[i], d) == STS_OK,
+						end);
+			}
+			TEST_ASSERT(cp_bls_agg(s, sigs, 4) == STS_OK, end);
+			TEST_ASSERT(cp_bls_ver_agg(s, msgs, lens, qs, 4) == 1, end);
+			_m[2][1] ^= 1;
+			TEST_ASSERT(cp_bls_ver_agg(s, msgs, lens, qs, 4) == 0, end);
+			_m[2][1] ^= 1;
+		}
+		TEST_END;
+
+		TEST_BEGIN("boneh-lynn-schacham batch verification is correct") {
+			TEST_ASSERT(cp_bls_ver_batch(ver, sigs, msgs, lens, qs, 4) == 1,
+					end);
+			TEST_ASSERT(ver[0] && ver[1] && ver[2] && ver[3], end);
+			g1_copy(s, sigs[1]);
+			g1_copy(sigs[1], sigs[3]);
+			TEST_ASSERT(cp_bls_ver_batch(NULL, sigs, msgs, lens, qs, 4) == 0,
+					end);
+			TEST_ASSERT(cp_bls_ver_batch(ver, sigs, msgs, lens, qs, 4) == 0,
+					end);
+			TEST_ASSERT(ver[0] && !ver[1] && ver[2] && ver[3], end);
+			g1_copy(sigs[1], s);
 		}
 		TEST_END;
 	}
@@ -1025,6 +1097,10 @@ static int bls(void) {
 	bn_free(d);
 	g1_free(s);
 	g2_free(q);
+	for (int i = 0; i < 4; i++) {
+		g1_free(sigs[i]);
+		g2_free(qs[i]);
+	}
 	return code;
 }
 
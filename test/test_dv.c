@@ -87,6 +87,93 @@ static int memory(void) {
 	return code;
 }
 
+#if ALLOC == STATIC
+
+/**
+ * Number of pool elements supplied in an arena for a new context.
+ */
+#define ARENA	1024
+
+static int pool(void) {
+	dv_t a, b;
+	int used, peak, size, u, p, code = STS_ERR;
+	dig_t *t;
+
+	dv_null(a);
+	dv_null(b);
+
+	TRY {
+		TEST_BEGIN("pool statistics are consistent") {
+			pool_stats(&used, &peak, &size);
+			TEST_ASSERT(size == POOL_SIZE && used <= peak, end);
+			dv_new(a);
+			dv_new(b);
+			pool_stats(&u, &p, &size);
+			TEST_ASSERT(u == used + 2 && p >= u, end);
+			dv_free(a);
+			dv_free(b);
+			pool_stats(&u, &p, &size);
+			TEST_ASSERT(u == used && p >= used + 2, end);
+		} TEST_END;
+
+		TEST_BEGIN("freed pool elements are reused first") {
+			dv_new(a);
+			t = a;
+			dv_free(a);
+			dv_new(b);
+			TEST_ASSERT(b == t, end);
+			dv_free(b);
+		} TEST_END;
+
+#ifdef CHECK
+		TEST_ONCE("freeing a pool element twice is detected") {
+			dv_new(a);
+			t = a;
+			dv_free(a);
+			TRY {
+				pool_put(t);
+			}
+			CATCH_ANY {
+			}
+			TEST_ASSERT(err_get_code() == STS_ERR, end);
+			pool_stats(&u, &p, &size);
+			TEST_ASSERT(u == used, end);
+		} TEST_END;
+#endif
+
+		TEST_BEGIN("pool can be carved from an arena") {
+			static ctx_t ctx;
+			static uint8_t arena[POOL_BYTES(ARENA)];
+			ctx_t *old = core_get();
+			TEST_ASSERT(pool_arena(arena, 1) == STS_ERR, end);
+			TEST_ASSERT(pool_arena(arena + 1, sizeof(arena) - 1) == STS_OK, end);
+			core_set(&ctx);
+			TEST_ASSERT(core_init() == STS_OK, end);
+			pool_stats(&used, &peak, &size);
+			TEST_ASSERT(size == MIN(ARENA, POOL_SIZE), end);
+			dv_new(a);
+			t = a;
+			dv_free(a);
+			core_clean();
+			core_set(old);
+			TEST_ASSERT((uint8_t *)t > arena, end);
+			TEST_ASSERT((uint8_t *)t < arena + sizeof(arena), end);
+			TEST_ASSERT((uintptr_t)t % POOL_ALIGN == 0, end);
+			pool_stats(&used, &peak, &size);
+			TEST_ASSERT(size == POOL_SIZE, end);
+		} TEST_END;
+	} CATCH_ANY {
+		ERROR(end);
+	}
+	code = STS_OK;
+  end:
+	dv_free(a);
+	dv_free(b);
+	return code;
+}
+
+#endif
+
 static int copy(void) {
 	dv_t a, b;
 	int code = STS_ERR;
@@ -191,6 +278,13 @@ int main(void) {
 		return 1;
 	}
 
+#if ALLOC == STATIC
+	if (pool() != STS_OK) {
+		core_clean();
+		return 1;
+	}
+#endif
+
 	if (copy() != STS_OK) {
 		core_clean();
 		return 1;
@@ -408,6 +408,93 @@ static int compression(void) {
 	return code;
 }
 
+/**
+ * Number of points used to test the batch functions.
+ */
+#define ED_BATCH_SIZE	128
+
+static int batch(void) {
+	int code = STS_ERR, n = ED_BATCH_SIZE;
+	dig_t s[ED_BATCH(ED_BATCH_SIZE)];
+	ed_t a, _p[ED_BATCH_SIZE], _q[ED_BATCH_SIZE];
+
+	ed_null(a);
+	for (int i = 0; i < n; i++) {
+		ed_null(_p[i]);
+		ed_null(_q[i]);
+	}
+
+	TRY {
+		ed_new(a);
+		for (int i = 0; i < n; i++) {
+			ed_new(_p[i]);
+			ed_new(_q[i]);
+		}
+
+		/* Mix points in projective and affine coordinates and the neutral. */
+		for (int i = 0; i < n; i++) {
+			ed_rand(_p[i]);
+			if (i % 3 != 1) {
+				ed_dbl(_p[i], _p[i]);
+			}
+		}
+		ed_set_infty(_p[n / 2]);
+
+		TEST_BEGIN("batch normalization is correct") {
+			ed_norm_bat(_q, (const ed_t *)_p, n, NULL);
+			for (int i = 0; i < n; i++) {
+				ed_norm(a, _p[i]);
+				TEST_ASSERT(ed_cmp(a, _q[i]) == CMP_EQ, end);
+			}
+			ed_norm_bat(_q, (const ed_t *)_p, n, s);
+			for (int i = 0; i < n; i++) {
+				ed_norm(a, _p[i]);
+				TEST_ASSERT(ed_cmp(a, _q[i]) == CMP_EQ, end);
+			}
+		}
+		TEST_END;
+
+		TEST_BEGIN("batch validity test is correct") {
+			TEST_ASSERT(ed_is_valid_bat((const ed_t *)_p, n) == 1, end);
+			ed_copy(a, _p[n - 1]);
+			fp_add_dig(_p[n - 1]->x, _p[n - 1]->x, 1);
+			TEST_ASSERT(ed_is_valid_bat((const ed_t *)_p, n) == 0, end);
+			ed_copy(_p[n - 1], a);
+		}
+		TEST_END;
+
+		TEST_BEGIN("batch point compression is correct") {
+			ed_norm_bat(_p, (const ed_t *)_p, n, s);
+			for (int i = 0; i < n; i++) {
+				ed_pck(_q[i], _p[i]);
+			}
+			TEST_ASSERT(ed_upk_bat(_q, (const ed_t *)_q, n, s) == 1, end);
+			for (int i = 0; i < n; i++) {
+				TEST_ASSERT(ed_cmp(_p[i], _q[i]) == CMP_EQ, end);
+			}
+			for (int i = 0; i < n; i++) {
+				ed_pck(_q[i], _p[i]);
+			}
+			TEST_ASSERT(ed_upk_bat(_q, (const ed_t *)_q, n, NULL) == 1, end);
+			for (int i = 0; i < n; i++) {
+				TEST_ASSERT(ed_cmp(_p[i], _q[i]) == CMP_EQ, end);
+			}
+		}
+		TEST_END;
+	}
+	CATCH_ANY {
+		ERROR(end);
+	}
+	code = STS_OK;
+  end:
+	ed_free(a);
+	for (int i = 0; i < n; i++) {
+		ed_free(_p[i]);
+		ed_free(_q[i]);
+	}
+	return code;
+}
+
 static int hashing(void) {
 	int code = STS_ERR;
 	ed_t a;
@@ -481,6 +568,10 @@ int test(void) {
 		return STS_ERR;
 	}
 
+	if (batch() != STS_OK) {
+		return STS_ERR;
+	}
+
 	return STS_OK;
 }
 
@@ -718,8 +718,8 @@ static int fixed(void) {
 
 static int simultaneous(void) {
 	int code = STS_ERR;
-	bn_t n, k, l;
-	ep_t p, q, r;
+	bn_t n, k, l, _k[EP_LOT_BUCKET + 8];
+	ep_t p, q, r, _p[EP_LOT_BUCKET + 8];
 
 	bn_null(n);
 	bn_null(k);
@@ -727,9 +727,17 @@ static int simultaneous(void) {
 	ep_null(p);
 	ep_null(q);
 	ep_null(r);
+	for (int i = 0; i < EP_LOT_BUCKET + 8; i++) {
+		bn_null(_k[i]);
+		ep_null(_p[i]);
+	}
 
 	TRY {
 		bn_new(n);
+		for (int i = 0; i < EP_LOT_BUCKET + 8; i++) {
+			bn_new(_k[i]);
+			ep_new(_p[i]);
+		}
 		bn_new(k);
 		bn_new(l);
 		ep_new(p);
@@ -800,6 +808,67 @@ static int simultaneous(void) {
 			ep_mul_sim(q, p, k, q, l);
 			TEST_ASSERT(ep_cmp(q, r) == CMP_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("simultaneous multiplication of many points is correct") {
+			for (int j = 4; j <= EP_LOT_BUCKET; j += EP_LOT_BUCKET - 4) {
+				ep_set_infty(q);
+				for (int i = 0; i < j; i++) {
+					bn_rand_mod(_k[i], n);
+					ep_rand(_p[i]);
+					ep_mul(r, _p[i], _k[i]);
+					ep_add(q, q, r);
+				}
+				ep_norm(q, q);
+				ep_mul_sim_lot(r, (const ep_t *)_p, (const bn_t *)_k, j);
+				TEST_ASSERT(ep_cmp(q, r) == CMP_EQ, end);
+				/* Negative integers and points at infinity are handled. */
+				ep_mul(r, _p[0], _k[0]);
+				ep_sub(q, q, r);
+				ep_mul(r, _p[1], _k[1]);
+				ep_sub(q, q, r);
+				ep_sub(q, q, r);
+				ep_norm(q, q);
+				ep_set_infty(_p[0]);
+				bn_neg(_k[1], _k[1]);
+				ep_mul_sim_lot(r, (const ep_t *)_p, (const bn_t *)_k, j);
+				TEST_ASSERT(ep_cmp(q, r) == CMP_EQ, end);
+			}
+		} TEST_END;
+
+		TEST_BEGIN("bucket multiplication with integers of mixed sizes is correct") {
+			ep_set_infty(q);
+			for (int i = 0; i < EP_LOT_BUCKET + 8; i++) {
+				ep_rand(_p[i]);
+				switch (i % 4) {
+					case 0:
+						bn_rand(_k[i], BN_POS, 8);
+						break;
+					case 1:
+						bn_rand_mod(_k[i], n);
+						break;
+					case 2:
+						/* Wider than the recoding of a reduced integer. */
+						bn_rand(_k[i], BN_POS, 2 * FP_BITS);
+						break;
+					case 3:
+						bn_rand_mod(_k[i], n);
+						bn_neg(_k[i], _k[i]);
+						break;
+				}
+				bn_abs(k, _k[i]);
+				bn_mod(k, k, n);
+				ep_mul(r, _p[i], k);
+				if (bn_sign(_k[i]) == BN_NEG) {
+					ep_sub(q, q, r);
+				} else {
+					ep_add(q, q, r);
+				}
+			}
+			ep_norm(q, q);
+			ep_mul_sim_lot(r, (const ep_t *)_p, (const bn_t *)_k,
+					EP_LOT_BUCKET + 8);
+			TEST_ASSERT(ep_cmp(q, r) == CMP_EQ, end);
+		} TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -813,6 +882,10 @@ static int simultaneous(void) {
 	ep_free(p);
 	ep_free(q);
 	ep_free(r);
+	for (int i = 0; i < EP_LOT_BUCKET + 8; i++) {
+		bn_free(_k[i]);
+		ep_free(_p[i]);
+	}
 	return code;
 }
 
@@ -848,18 +921,101 @@ static int compression(void) {
 	return code;
 }
 
+static int batch(void) {
+	int code = STS_ERR, n = EP_LOT_BUCKET;
+	dig_t s[EP_BATCH(EP_LOT_BUCKET)];
+	ep_t a, _p[EP_LOT_BUCKET], _q[EP_LOT_BUCKET];
+
+	ep_null(a);
+	for (int i = 0; i < n; i++) {
+		ep_null(_p[i]);
+		ep_null(_q[i]);
+	}
+
+	TRY {
+		ep_new(a);
+		for (int i = 0; i < n; i++) {
+			ep_new(_p[i]);
+			ep_new(_q[i]);
+		}
+
+		/* Mix points in projective and affine coordinates and at infinity. */
+		for (int i = 0; i < n; i++) {
+			ep_rand(_p[i]);
+			if (i % 3 != 1) {
+				ep_dbl(_p[i], _p[i]);
+			}
+		}
+		ep_set_infty(_p[n / 2]);
+
+		TEST_BEGIN("batch normalization is correct") {
+			ep_norm_bat(_q, (const ep_t *)_p, n, NULL);
+			for (int i = 0; i < n; i++) {
+				ep_norm(a, _p[i]);
+				TEST_ASSERT(ep_cmp(a, _q[i]) == CMP_EQ, end);
+			}
+			ep_norm_bat(_q, (const ep_t *)_p, n, s);
+			for (int i = 0; i < n; i++) {
+				ep_norm(a, _p[i]);
+				TEST_ASSERT(ep_cmp(a, _q[i]) == CMP_EQ, end);
+			}
+		}
+		TEST_END;
+
+		TEST_BEGIN("batch validity test is correct") {
+			TEST_ASSERT(ep_is_valid_bat((const ep_t *)_p, n) == 1, end);
+			ep_copy(a, _p[n - 1]);
+			fp_add_dig(_p[n - 1]->x, _p[n - 1]->x, 1);
+			TEST_ASSERT(ep_is_valid_bat((const ep_t *)_p, n) == 0, end);
+			ep_copy(_p[n - 1], a);
+		}
+		TEST_END;
+
+		TEST_BEGIN("batch point compression is correct") {
+			ep_norm_bat(_p, (const ep_t *)_p, n, s);
+			for (int i = 0; i < n; i++) {
+				ep_pck(_q[i], _p[i]);
+			}
+			/* Points at infinity have no compressed form. */
+			ep_rand(_p[n / 2]);
+			ep_pck(_q[n / 2], _p[n / 2]);
+			TEST_ASSERT(ep_upk_bat(_q, (const ep_t *)_q, n) == 1, end);
+			for (int i = 0; i < n; i++) {
+				TEST_ASSERT(ep_cmp(_p[i], _q[i]) == CMP_EQ, end);
+			}
+		}
+		TEST_END;
+	}
+	CATCH_ANY {
+		ERROR(end);
+	}
+	code = STS_OK;
+  end:
+	ep_free(a);
+	for (int i = 0; i < n; i++) {
+		ep_free(_p[i]);
+		ep_free(_q[i]);
+	}
+	return code;
+}
+
 static int hashing(void) {
 	int code = STS_ERR;
-	ep_t a;
+	ep_t a, b;
 	bn_t n;
+	fp_t c;
 	uint8_t msg[5];
 
 	ep_null(a);
+	ep_null(b);
 	bn_null(n);
+	fp_null(c);
 
 	TRY {
 		ep_new(a);
+		ep_new(b);
 		bn_new(n);
+		fp_new(c);
 
 		ep_curve_get_ord(n);
 
@@ -870,6 +1026,56 @@ static int hashing(void) {
 			TEST_ASSERT(ep_is_infty(a) == 1, end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("try-and-increment point hashing is correct") {
+			rand_bytes(msg, sizeof(msg));
+			ep_map_basic(a, msg, sizeof(msg));
+			TEST_ASSERT(ep_is_valid(a) == 1, end);
+			ep_mul(a, a, n);
+			TEST_ASSERT(ep_is_infty(a) == 1, end);
+		}
+		TEST_END;
+
+		if (!fp_is_zero(ep_curve_get_map())) {
+			TEST_ONCE("deterministic hashing constant is valid") {
+				if (ep_curve_opt_a() == OPT_ZERO) {
+					fp_sqr(c, ep_curve_get_map());
+					fp_add_dig(c, c, 3);
+					TEST_ASSERT(fp_is_zero(c), end);
+				} else {
+					TEST_ASSERT(fp_is_sqr(ep_curve_get_map()) == 0, end);
+					fp_add_dig(c, ep_curve_get_map(), 1);
+					TEST_ASSERT(fp_is_zero(c) == 0, end);
+				}
+			}
+			TEST_END;
+
+			TEST_BEGIN("deterministic point hashing is correct") {
+				rand_bytes(msg, sizeof(msg));
+				ep_map_swu(a, msg, sizeof(msg));
+				TEST_ASSERT(ep_is_valid(a) == 1, end);
+				ep_map_swu(b, msg, sizeof(msg));
+				TEST_ASSERT(ep_cmp(a, b) == CMP_EQ, end);
+				msg[0] ^= 1;
+				ep_map_swu(b, msg, sizeof(msg));
+				TEST_ASSERT(ep_cmp(a, b) != CMP_EQ, end);
+				ep_mul(a, a, n);
+				TEST_ASSERT(ep_is_infty(a) == 1, end);
+			}
+			TEST_END;
+		}
+
+#if FP_PRIME == 256 && defined(EP_PLAIN)
+		TEST_ONCE("hashing constant of NIST P-256 follows RFC 9380") {
+			int id = ep_param_get();
+			ep_param_set(NIST_P256);
+			fp_set_dig(c, 10);
+			fp_neg(c, c);
+			TEST_ASSERT(fp_cmp(ep_curve_get_map(), c) == CMP_EQ, end);
+			ep_param_set(id);
+		}
+		TEST_END;
+#endif
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -877,7 +1083,148 @@ static int hashing(void) {
 	code = STS_OK;
   end:
 	ep_free(a);
+	ep_free(b);
 	bn_free(n);
+	fp_free(c);
+	return code;
+}
+
+/**
+ * Selects a curve for the configured prime, preferring one different from the
+ * current curve.
+ *
+ * @param[in] id			- the identifier of the current curve.
+ */
+static void select_other(int id) {
+	if (ep_param_set_any_pairf() == STS_OK && ep_param_get() != id) {
+		return;
+	}
+#if defined(EP_ENDOM)
+	if (ep_param_set_any_endom() == STS_OK && ep_param_get() != id) {
+		return;
+	}
+#endif
+#if defined(EP_PLAIN)
+	if (ep_param_set_any_plain() == STS_OK && ep_param_get() != id) {
+		return;
+	}
+#endif
+	ep_param_set(id);
+}
+
+static int selection(void) {
+	int id, code = STS_ERR, selected = 0;
+	fp_field_st field;
+	ep_curve_st curve;
+	ctx_t *old_ctx = core_get();
+	ep_t p, q, r;
+	bn_t k;
+
+	ep_null(p);
+	ep_null(q);
+	ep_null(r);
+	bn_null(k);
+
+	TRY {
+		ep_new(p);
+		ep_new(q);
+		ep_new(r);
+		bn_new(k);
+
+		TEST_BEGIN("curves can be selected without being rebuilt") {
+			id = ep_param_get();
+			/* A short scalar is smaller than the order of both curves. */
+			bn_rand(k, BN_POS, BN_DIGIT);
+			ep_mul_gen(p, k);
+
+			fp_field_set(&field);
+			fp_prime_init();
+			ep_curve_set(&curve);
+			ep_curve_init();
+			selected = 1;
+			select_other(id);
+			TEST_ASSERT(ep_curve_get() == &curve, end);
+			TEST_ASSERT(fp_field_get() == &field, end);
+			ep_mul_gen(q, k);
+
+			fp_field_set(NULL);
+			ep_curve_set(NULL);
+			TEST_ASSERT(ep_param_get() == id, end);
+			ep_mul_gen(r, k);
+			TEST_ASSERT(ep_cmp(p, r) == CMP_EQ, end);
+
+			fp_field_set(&field);
+			ep_curve_set(&curve);
+			ep_mul_gen(r, k);
+			TEST_ASSERT(ep_cmp(q, r) == CMP_EQ, end);
+			TEST_ASSERT(ep_is_valid(r), end);
+
+			ep_curve_clean();
+			fp_prime_clean();
+			selected = 0;
+			fp_field_set(NULL);
+			ep_curve_set(NULL);
+		} TEST_END;
+
+		TEST_ONCE("curves can be shared among contexts") {
+			static ctx_t new_ctx;
+#if ALLOC != STATIC
+			ep_curve_t shared;
+#endif
+
+			id = ep_param_get();
+			bn_rand(k, BN_POS, BN_DIGIT);
+			ep_mul_gen(p, k);
+
+			ep_param_set_shared(id);
+			TEST_ASSERT(ep_param_get() == id, end);
+#if ALLOC != STATIC
+			shared = ep_curve_get();
+#endif
+			ep_mul_gen(r, k);
+			TEST_ASSERT(ep_cmp(p, r) == CMP_EQ, end);
+
+			core_set(&new_ctx);
+			core_init();
+			ep_param_set_shared(id);
+#if ALLOC != STATIC
+			TEST_ASSERT(ep_curve_get() == shared, end);
+#endif
+			ep_mul_gen(q, k);
+			core_clean();
+			core_set(old_ctx);
+			TEST_ASSERT(ep_cmp(p, q) == CMP_EQ, end);
+
+			/* The parameters survive the release by the other context. */
+			ep_mul_gen(r, k);
+			TEST_ASSERT(ep_cmp(p, r) == CMP_EQ, end);
+			ep_param_release();
+			TEST_ASSERT(ep_curve_get() == &(core_get()->ep_def), end);
+			TEST_ASSERT(ep_param_get() == id, end);
+		} TEST_END;
+	}
+	CATCH_ANY {
+		ERROR(end);
+	}
+	code = STS_OK;
+  end:
+	if (core_get() != old_ctx) {
+		core_clean();
+		core_set(old_ctx);
+	}
+	if (selected) {
+		fp_field_set(&field);
+		ep_curve_set(&curve);
+		ep_curve_clean();
+		fp_prime_clean();
+	}
+	/* Never leave the context pointing to the objects on this stack. */
+	fp_field_set(NULL);
+	ep_curve_set(NULL);
+	ep_free(p);
+	ep_free(q);
+	ep_free(r);
+	bn_free(k);
 	return code;
 }
 
@@ -925,6 +1272,10 @@ int test(void) {
 		return STS_ERR;
 	}
 
+	if (batch() != STS_OK) {
+		return STS_ERR;
+	}
+
 	if (hashing() != STS_OK) {
 		return STS_ERR;
 	}
@@ -993,6 +1344,11 @@ int main(void) {
 		}
 	}
 
+	if (selection() != STS_OK) {
+		core_clean();
+		return 1;
+	}
+
 	util_banner("All tests have passed.\n", 0);
 
 	core_clean();
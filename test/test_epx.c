@@ -515,6 +515,32 @@ static int multiplication(void) {
 			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
 		} TEST_END;
 
+		TEST_BEGIN("binary point multiplication is correct") {
+			bn_rand_mod(k, n);
+			ep2_mul(q, p, k);
+			ep2_mul_basic(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+		} TEST_END;
+
+#if EP2_MUL == LWNAF || !defined(STRIP)
+		TEST_BEGIN("left-to-right w-naf point multiplication is correct") {
+			bn_rand_mod(k, n);
+			ep2_mul_lwnaf(q, p, k);
+			ep2_mul_basic(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+			bn_rand(k, BN_POS, 2 * bn_bits(n));
+			ep2_rand(p);
+			ep2_mul_lwnaf(q, p, k);
+			ep2_mul_basic(r, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+			bn_neg(k, k);
+			ep2_mul_lwnaf(q, p, k);
+			TEST_ASSERT(ep2_cmp(q, r) == CMP_EQ, end);
+			ep2_curve_get_gen(p);
+		}
+		TEST_END;
+#endif
+
 		TEST_BEGIN("multiplication by digit is correct") {
 			bn_rand(k, BN_POS, BN_DIGIT);
 			ep2_mul(q, p, k);
@@ -826,6 +852,90 @@ static int compression(void) {
 	return code;
 }
 
+static int batch(void) {
+	int code = STS_ERR, n = EP_LOT_BUCKET;
+	dig_t s[EPX_BATCH(EP_LOT_BUCKET)];
+	ep2_t a, _p[EP_LOT_BUCKET], _q[EP_LOT_BUCKET];
+
+	ep2_null(a);
+	for (int i = 0; i < n; i++) {
+		ep2_null(_p[i]);
+		ep2_null(_q[i]);
+	}
+
+	TRY {
+		ep2_new(a);
+		for (int i = 0; i < n; i++) {
+			ep2_new(_p[i]);
+			ep2_new(_q[i]);
+		}
+
+		/* Mix points in projective and affine coordinates and at infinity. */
+		for (int i = 0; i < n; i++) {
+			ep2_rand(_p[i]);
+			if (i % 3 != 1) {
+				ep2_dbl(_p[i], _p[i]);
+			}
+		}
+		ep2_set_infty(_p[n / 2]);
+
+		TEST_BEGIN("batch normalization is correct") {
+			ep2_norm_bat(_q, _p, n, NULL);
+			for (int i = 0; i < n; i++) {
+				ep2_norm(a, _p[i]);
+				TEST_ASSERT(ep2_cmp(a, _q[i]) == CMP_EQ, end);
+			}
+			ep2_norm_bat(_q, _p, n, s);
+			for (int i = 0; i < n; i++) {
+				ep2_norm(a, _p[i]);
+				TEST_ASSERT(ep2_cmp(a, _q[i]) == CMP_EQ, end);
+			}
+		}
+		TEST_END;
+
+		TEST_BEGIN("batch validity test is correct") {
+			TEST_ASSERT(ep2_is_valid_bat(_p, n) == 1, end);
+			ep2_copy(a, _p[n - 1]);
+			fp_add_dig(_p[n - 1]->x[1], _p[n - 1]->x[1], 1);
+			TEST_ASSERT(ep2_is_valid_bat(_p, n) == 0, end);
+			ep2_copy(_p[n - 1], a);
+		}
+		TEST_END;
+
+		TEST_BEGIN("batch point compression is correct") {
+			ep2_norm_bat(_p, _p, n, s);
+			/* Points at infinity have no compressed form. */
+			ep2_rand(_p[n / 2]);
+			for (int i = 0; i < n; i++) {
+				ep2_pck(_q[i], _p[i]);
+			}
+			TEST_ASSERT(ep2_upk_bat(_q, _q, n, s) == 1, end);
+			for (int i = 0; i < n; i++) {
+				TEST_ASSERT(ep2_cmp(_p[i], _q[i]) == CMP_EQ, end);
+			}
+			for (int i = 0; i < n; i++) {
+				ep2_pck(_q[i], _p[i]);
+			}
+			TEST_ASSERT(ep2_upk_bat(_q, _q, n, NULL) == 1, end);
+			for (int i = 0; i < n; i++) {
+				TEST_ASSERT(ep2_cmp(_p[i], _q[i]) == CMP_EQ, end);
+			}
+		}
+		TEST_END;
+	}
+	CATCH_ANY {
+		ERROR(end);
+	}
+	code = STS_OK;
+  end:
+	ep2_free(a);
+	for (int i = 0; i < n; i++) {
+		ep2_free(_p[i]);
+		ep2_free(_q[i]);
+	}
+	return code;
+}
+
 static int hashing(void) {
 	int code = STS_ERR;
 	bn_t n;
@@ -987,6 +1097,11 @@ int main(void) {
 		return 1;
 	}
 
+	if (batch() != STS_OK) {
+		core_clean();
+		return 1;
+	}
+
 	if (hashing() != STS_OK) {
 		core_clean();
 		return 1;
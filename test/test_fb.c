@@ -199,6 +199,39 @@ static int util(void) {
 			TEST_ASSERT((fb_size_str(a, 2) - 1) == fb_bits(a), end);
 		}
 		TEST_END;
+
+		TEST_ONCE("binary fields can be shared among contexts") {
+			static ctx_t new_ctx;
+			ctx_t *old_ctx = core_get();
+			fb_field_t shared;
+			int id = fb_param_get();
+
+			do {
+				fb_rand(a);
+			} while (fb_is_zero(a));
+			fb_inv(b, a);
+
+			fb_param_set_shared(id);
+			TEST_ASSERT(fb_param_get() == id, end);
+			shared = fb_field_get();
+
+			core_set(&new_ctx);
+			core_init();
+			fb_param_set_shared(id);
+			TEST_ASSERT(fb_field_get() == shared, end);
+			fb_inv(c, a);
+			core_clean();
+			core_set(old_ctx);
+			TEST_ASSERT(fb_cmp(b, c) == CMP_EQ, end);
+
+			/* The field survives the release by the other context. */
+			fb_inv(c, a);
+			TEST_ASSERT(fb_cmp(b, c) == CMP_EQ, end);
+			fb_param_release();
+			TEST_ASSERT(fb_field_get() == core_get()->fb_def, end);
+			TEST_ASSERT(fb_param_get() == id, end);
+		}
+		TEST_END;
 	}
 	CATCH_ANY {
 		ERROR(end);
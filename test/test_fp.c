@@ -853,6 +853,27 @@ static int inversion(void) {
 		} TEST_END;
 #endif
 
+#if FP_INV == DIVST || !defined(STRIP)
+		TEST_BEGIN("divstep inversion is correct") {
+			do {
+				fp_rand(a);
+			} while (fp_is_zero(a));
+			fp_inv_divst(b, a);
+			fp_mul(c, a, b);
+			TEST_ASSERT(fp_cmp_dig(c, 1) == CMP_EQ, end);
+#if !defined(STRIP)
+			fp_inv_basic(c, a);
+			TEST_ASSERT(fp_cmp(c, b) == CMP_EQ, end);
+#endif
+			fp_set_dig(a, 1);
+			fp_inv_divst(b, a);
+			TEST_ASSERT(fp_cmp_dig(b, 1) == CMP_EQ, end);
+			fp_zero(a);
+			fp_inv_divst(b, a);
+			TEST_ASSERT(fp_is_zero(b), end);
+		} TEST_END;
+#endif
+
 #if FP_INV == LOWER || !defined(STRIP)
 		TEST_BEGIN("lower inversion is correct") {
 			fp_rand(a);
@@ -971,17 +992,20 @@ static int exponentiation(void) {
 }
 
 static int square_root(void) {
-	int code = STS_ERR;
+	int code = STS_ERR, param = fp_param_get();
 	fp_t a, b, c;
+	bn_t p;
 
 	fp_null(a);
 	fp_null(b);
 	fp_null(c);
+	bn_null(p);
 
 	TRY {
 		fp_new(a);
 		fp_new(b);
 		fp_new(c);
+		bn_new(p);
 
 		TEST_BEGIN("square root extraction is correct") {
 			fp_rand(a);
@@ -996,6 +1020,39 @@ static int square_root(void) {
 			}
 		}
 		TEST_END;
+
+		TEST_BEGIN("quadratic residuosity test is correct") {
+			fp_rand(a);
+			fp_sqr(c, a);
+			TEST_ASSERT(fp_is_sqr(c) == 1, end);
+			fp_rand(a);
+			TEST_ASSERT(fp_is_sqr(a) == fp_srt(b, a), end);
+		}
+		TEST_END;
+
+#if FP_RDC != QUICK && !defined(FP_QNRES)
+		TEST_ONCE("square root extraction is correct for p = 1 mod 2^32") {
+			do {
+				bn_rand(p, BN_POS, FP_BITS - 32);
+				bn_lsh(p, p, 32);
+				bn_add_dig(p, p, 1);
+			} while (bn_bits(p) != FP_BITS || !bn_is_prime(p));
+			fp_prime_set_dense(p);
+			fp_rand(a);
+			fp_sqr(c, a);
+			TEST_ASSERT(fp_is_sqr(c) && fp_srt(b, c), end);
+			fp_neg(c, b);
+			TEST_ASSERT(fp_cmp(b, a) == CMP_EQ || fp_cmp(c, a) == CMP_EQ, end);
+			fp_rand(a);
+			TEST_ASSERT(fp_is_sqr(a) == fp_srt(b, a), end);
+			if (fp_is_sqr(a)) {
+				fp_sqr(c, b);
+				TEST_ASSERT(fp_cmp(c, a) == CMP_EQ, end);
+			}
+			fp_param_set(param);
+		}
+		TEST_END;
+#endif
 	}
 	CATCH_ANY {
 		ERROR(end);
@@ -1005,6 +1062,7 @@ static int square_root(void) {
 	fp_free(a);
 	fp_free(b);
 	fp_free(c);
+	bn_free(p);
 	return code;
 }
 
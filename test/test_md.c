@@ -462,6 +462,32 @@ static int hmac(void) {
 	return code;
 }
 
+static int incremental(void) {
+	int code = STS_ERR;
+	int j, k, l;
+	uint8_t message[1024], digest[MD_LEN], result[MD_LEN];
+	md_ctx_t ctx;
+
+	TEST_BEGIN("incremental hashing is consistent") {
+		rand_bytes(message, sizeof(message));
+		md_map(result, message, sizeof(message));
+		md_init(ctx);
+		for (k = 0; k < (int)sizeof(message); k += l) {
+			rand_bytes((uint8_t *)&j, sizeof(int));
+			l = MIN((j & 0xFF), (int)sizeof(message) - k);
+			md_update(ctx, message + k, l);
+		}
+		md_final(digest, ctx);
+		TEST_ASSERT(memcmp(digest, result, MD_LEN) == 0, end);
+	}
+	TEST_END;
+
+	code = STS_OK;
+
+  end:
+	return code;
+}
+
 int main(void) {
 	if (core_init() != STS_OK) {
 		core_clean();
@@ -505,6 +531,11 @@ int main(void) {
 	}
 #endif
 
+	if (incremental() != STS_OK) {
+		core_clean();
+		return 1;
+	}
+
 	if (kdf() != STS_OK) {
 		core_clean();
 		return 1;
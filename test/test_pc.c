@@ -29,6 +29,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "relic.h"
 #include "relic_test.h"
@@ -1214,16 +1215,20 @@ static int inversion(void) {
 
 int exponentiation(void) {
 	int code = STS_ERR;
-	gt_t a, c;
-	bn_t n;
+	gt_t a, b, c;
+	bn_t k, n;
 
 	gt_null(a);
+	gt_null(b);
 	gt_null(c);
+	bn_null(k);
 	bn_null(n);
 
 	TRY {
 		gt_new(a);
+		gt_new(b);
 		gt_new(c);
+		bn_new(k);
 		bn_new(n);
 
 		gt_get_gen(a);
@@ -1240,6 +1245,43 @@ int exponentiation(void) {
 			TEST_ASSERT(gt_is_unity(c), end);
 		}
 		TEST_END;
+
+		TEST_BEGIN("exponentiation is correct") {
+			gt_rand(a);
+			bn_rand_mod(k, n);
+			gt_copy(b, a);
+			for (int i = bn_bits(k) - 2; i >= 0; i--) {
+				gt_sqr(b, b);
+				if (bn_get_bit(k, i)) {
+					gt_mul(b, b, a);
+				}
+			}
+			gt_exp(c, a, k);
+			TEST_ASSERT(gt_cmp(b, c) == CMP_EQ, end);
+			bn_add(k, k, n);
+			gt_exp(c, a, k);
+			TEST_ASSERT(gt_cmp(b, c) == CMP_EQ, end);
+			bn_sub(k, k, n);
+			bn_neg(k, k);
+			gt_exp(c, a, k);
+			gt_inv(c, c);
+			TEST_ASSERT(gt_cmp(b, c) == CMP_EQ, end);
+		}
+		TEST_END;
+
+#if FP_PRIME < 1536 && defined(CHECK)
+		TEST_ONCE("exponentiation rejects elements outside the group") {
+			fp12_rand(a);
+			bn_rand_mod(k, n);
+			TRY {
+				gt_exp(c, a, k);
+			}
+			CATCH_ANY {
+			}
+			TEST_ASSERT(err_get_code() == STS_ERR, end);
+		}
+		TEST_END;
+#endif
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1248,7 +1290,9 @@ int exponentiation(void) {
 	code = STS_OK;
   end:
 	gt_free(a);
+	gt_free(b);
 	gt_free(c);
+	bn_free(k);
 	bn_free(n);
 	return code;
 }
@@ -1259,6 +1303,8 @@ static int pairing(void) {
 	g1_t p;
 	g2_t q, r;
 	bn_t k, n;
+	g1_t _p[2];
+	g2_t _q[2];
 
 	gt_null(e1);
 	gt_null(e2);
@@ -1267,6 +1313,10 @@ static int pairing(void) {
 	g2_null(r);
 	bn_null(k);
 	bn_null(n);
+	for (int i = 0; i < 2; i++) {
+		g1_null(_p[i]);
+		g2_null(_q[i]);
+	}
 
 	TRY {
 		gt_new(e1);
@@ -1276,6 +1326,10 @@ static int pairing(void) {
 		g2_new(r);
 		bn_new(k);
 		bn_new(n);
+		for (int i = 0; i < 2; i++) {
+			g1_new(_p[i]);
+			g2_new(_q[i]);
+		}
 
 		g1_get_ord(n);
 
@@ -1314,6 +1368,22 @@ static int pairing(void) {
 			gt_sqr(e1, e1);
 			TEST_ASSERT(gt_cmp(e1, e2) == CMP_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("multi-pairing is correct") {
+			g1_rand(_p[0]);
+			g1_rand(_p[1]);
+			g2_rand(_q[0]);
+			g2_rand(_q[1]);
+			pc_map(e1, _p[0], _q[0]);
+			pc_map(e2, _p[1], _q[1]);
+			gt_mul(e1, e1, e2);
+			pc_map_sim(e2, _p, _q, 2);
+			TEST_ASSERT(gt_cmp(e1, e2) == CMP_EQ, end);
+			g1_neg(_p[1], _p[0]);
+			g2_copy(_q[1], _q[0]);
+			pc_map_sim(e2, _p, _q, 2);
+			TEST_ASSERT(gt_cmp_dig(e2, 1) == CMP_EQ, end);
+		} TEST_END;
 	}
 	CATCH_ANY {
 		util_print("FATAL ERROR!\n");
@@ -1328,6 +1398,131 @@ static int pairing(void) {
 	g2_free(r);
 	bn_free(k);
 	bn_free(n);
+	for (int i = 0; i < 2; i++) {
+		g1_free(_p[i]);
+		g2_free(_q[i]);
+	}
+	return code;
+}
+
+static int logarithm(void) {
+	int len, code = STS_ERR;
+	dig_t k, l;
+	uint8_t *bin = NULL;
+	pc_dlog_t t;
+	g1_t p, q;
+	g2_t r, s;
+	gt_t e, f;
+	bn_t n;
+
+	pc_dlog_null(t);
+	g1_null(p);
+	g1_null(q);
+	g2_null(r);
+	g2_null(s);
+	gt_null(e);
+	gt_null(f);
+	bn_null(n);
+
+	TRY {
+		pc_dlog_new(t);
+		g1_new(p);
+		g1_new(q);
+		g2_new(r);
+		g2_new(s);
+		gt_new(e);
+		gt_new(f);
+		bn_new(n);
+
+		TEST_BEGIN("bounded discrete logarithm in G_1 is correct") {
+			g1_rand(p);
+			g1_dlog_pre(t, p, 256);
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= 65536;
+			g1_mul_dig(q, p, k);
+			TEST_ASSERT(g1_dlog(&l, t, p, q, 65535) == STS_OK, end);
+			TEST_ASSERT(k == l, end);
+			g1_mul_dig(q, p, 65536);
+			TEST_ASSERT(g1_dlog(&l, t, p, q, 65535) == STS_ERR, end);
+			TEST_ASSERT(g1_dlog(&l, t, p, q, 65536) == STS_OK, end);
+			TEST_ASSERT(l == 65536, end);
+			g1_set_infty(q);
+			TEST_ASSERT(g1_dlog(&l, t, p, q, 0) == STS_OK, end);
+			TEST_ASSERT(l == 0, end);
+		} TEST_END;
+
+		TEST_BEGIN("bounded discrete logarithm in G_2 is correct") {
+			g2_rand(r);
+			g2_dlog_pre(t, r, 256);
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= 65536;
+			g2_mul_dig(s, r, k);
+			TEST_ASSERT(g2_dlog(&l, t, r, s, 65535) == STS_OK, end);
+			TEST_ASSERT(k == l, end);
+		} TEST_END;
+
+		TEST_BEGIN("bounded discrete logarithm in G_T is correct") {
+			gt_rand(e);
+			gt_dlog_pre(t, e, 256);
+			rand_bytes((uint8_t *)&k, sizeof(dig_t));
+			k %= 65536;
+			bn_set_dig(n, k);
+			gt_exp(f, e, n);
+			TEST_ASSERT(gt_dlog(&l, t, e, f, 65535) == STS_OK, end);
+			TEST_ASSERT(k == l, end);
+		} TEST_END;
+
+		TEST_BEGIN("reading and writing a table of baby steps are consistent") {
+			len = pc_dlog_size_bin(t);
+			bin = (uint8_t *)malloc(len);
+			TEST_ASSERT(bin != NULL, end);
+			pc_dlog_write_bin(bin, len, t);
+			gt_dlog_pre(t, f, 16);
+			pc_dlog_read_bin(t, bin, len);
+			TEST_ASSERT(gt_dlog(&l, t, e, f, 65535) == STS_OK, end);
+			TEST_ASSERT(k == l, end);
+		} TEST_END;
+
+		TEST_ONCE("reading a table of baby steps with a bad header fails") {
+			bin[4] = 0x80;
+			bin[5] = bin[6] = bin[7] = 0;
+			TRY {
+				pc_dlog_read_bin(t, bin, len);
+			}
+			CATCH_ANY {
+			}
+			TEST_ASSERT(err_get_code() == STS_ERR, end);
+		} TEST_END;
+
+		TEST_ONCE("reading a table of baby steps without empty slots fails") {
+			pc_dlog_write_bin(bin, len, t);
+			for (int i = 8; i < len; i += 12) {
+				bin[i + 8] = bin[i + 9] = bin[i + 10] = 0;
+				bin[i + 11] = 1;
+			}
+			TRY {
+				pc_dlog_read_bin(t, bin, len);
+			}
+			CATCH_ANY {
+			}
+			TEST_ASSERT(err_get_code() == STS_ERR, end);
+		} TEST_END;
+	}
+	CATCH_ANY {
+		util_print("FATAL ERROR!\n");
+		ERROR(end);
+	}
+	code = STS_OK;
+  end:
+	free(bin);
+	pc_dlog_free(t);
+	g1_free(p);
+	g1_free(q);
+	g2_free(r);
+	g2_free(s);
+	gt_free(e);
+	gt_free(f);
+	bn_free(n);
 	return code;
 }
 
@@ -1455,6 +1650,10 @@ int test(void) {
 		return STS_ERR;
 	}
 
+	if (logarithm() != STS_OK) {
+		return STS_ERR;
+	}
+
 	return STS_OK;
 }
 
@@ -266,6 +266,8 @@ static int pairing2(void) {
 	bn_t k, n;
 	ep_t p, q, r;
 	fp2_t e1, e2;
+	ep_t _p[2];
+	ep_t _q[2];
 
 	bn_null(k);
 	bn_null(n);
@@ -274,6 +276,10 @@ static int pairing2(void) {
 	ep_null(r);
 	fp2_null(e1);
 	fp2_null(e2);
+	for (int i = 0; i < 2; i++) {
+		ep_null(_p[i]);
+		ep_null(_q[i]);
+	}
 
 	TRY {
 		bn_new(n);
@@ -283,6 +289,10 @@ static int pairing2(void) {
 		ep_new(r);
 		fp2_new(e1);
 		fp2_new(e2);
+		for (int i = 0; i < 2; i++) {
+			ep_new(_p[i]);
+			ep_new(_q[i]);
+		}
 
 		ep_curve_get_ord(n);
 
@@ -322,6 +332,28 @@ static int pairing2(void) {
 			TEST_ASSERT(fp2_cmp(e1, e2) == CMP_EQ, end);
 		} TEST_END;
 
+		TEST_BEGIN("multi-pairing is correct") {
+			ep_rand(_p[0]);
+			ep_rand(_p[1]);
+			ep_rand(_q[0]);
+			ep_rand(_q[1]);
+			pp_map_k2(e1, _p[0], _q[0]);
+			pp_map_k2(e2, _p[1], _q[1]);
+			fp2_mul(e1, e1, e2);
+			pp_map_sim_k2(e2, _p, _q, 2);
+			TEST_ASSERT(fp2_cmp(e1, e2) == CMP_EQ, end);
+			ep_set_infty(_p[1]);
+			pp_map_k2(e1, _p[0], _q[0]);
+			pp_map_sim_k2(e2, _p, _q, 2);
+			TEST_ASSERT(fp2_cmp(e1, e2) == CMP_EQ, end);
+			ep_neg(_p[1], _p[0]);
+			ep_copy(_q[1], _q[0]);
+			pp_map_sim_k2(e2, _p, _q, 2);
+			TEST_ASSERT(fp2_cmp_dig(e2, 1) == CMP_EQ, end);
+			pp_map_sim_k2(e2, _p, _q, 0);
+			TEST_ASSERT(fp2_cmp_dig(e2, 1) == CMP_EQ, end);
+		} TEST_END;
+
 #if PP_MAP == TATEP || PP_MAP == OATEP || !defined(STRIP)
 		TEST_BEGIN("tate pairing non-degeneracy is correct") {
 			ep_rand(p);
@@ -358,6 +390,26 @@ static int pairing2(void) {
 			fp2_sqr(e1, e1);
 			TEST_ASSERT(fp2_cmp(e1, e2) == CMP_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("tate multi-pairing is correct") {
+			ep_rand(_p[0]);
+			ep_rand(_p[1]);
+			ep_rand(_q[0]);
+			ep_rand(_q[1]);
+			pp_map_tatep_k2(e1, _p[0], _q[0]);
+			pp_map_tatep_k2(e2, _p[1], _q[1]);
+			fp2_mul(e1, e1, e2);
+			pp_map_sim_tatep_k2(e2, _p, _q, 2);
+			TEST_ASSERT(fp2_cmp(e1, e2) == CMP_EQ, end);
+			ep_set_infty(_p[1]);
+			pp_map_tatep_k2(e1, _p[0], _q[0]);
+			pp_map_sim_tatep_k2(e2, _p, _q, 2);
+			TEST_ASSERT(fp2_cmp(e1, e2) == CMP_EQ, end);
+			ep_neg(_p[1], _p[0]);
+			ep_copy(_q[1], _q[0]);
+			pp_map_sim_tatep_k2(e2, _p, _q, 2);
+			TEST_ASSERT(fp2_cmp_dig(e2, 1) == CMP_EQ, end);
+		} TEST_END;
 #endif
 
 #if PP_MAP == WEIL || !defined(STRIP)
@@ -396,6 +448,26 @@ static int pairing2(void) {
 			fp2_sqr(e1, e1);
 			//TEST_ASSERT(fp2_cmp(e1, e2) == CMP_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("weil multi-pairing is correct") {
+			ep_rand(_p[0]);
+			ep_rand(_p[1]);
+			ep_rand(_q[0]);
+			ep_rand(_q[1]);
+			pp_map_weilp_k2(e1, _p[0], _q[0]);
+			pp_map_weilp_k2(e2, _p[1], _q[1]);
+			fp2_mul(e1, e1, e2);
+			pp_map_sim_weilp_k2(e2, _p, _q, 2);
+			TEST_ASSERT(fp2_cmp(e1, e2) == CMP_EQ, end);
+			ep_set_infty(_p[1]);
+			pp_map_weilp_k2(e1, _p[0], _q[0]);
+			pp_map_sim_weilp_k2(e2, _p, _q, 2);
+			TEST_ASSERT(fp2_cmp(e1, e2) == CMP_EQ, end);
+			ep_neg(_p[1], _p[0]);
+			ep_copy(_q[1], _q[0]);
+			pp_map_sim_weilp_k2(e2, _p, _q, 2);
+			TEST_ASSERT(fp2_cmp_dig(e2, 1) == CMP_EQ, end);
+		} TEST_END;
 #endif
 	}
 	CATCH_ANY {
@@ -411,6 +483,10 @@ static int pairing2(void) {
 	ep_free(r);
 	fp2_free(e1);
 	fp2_free(e2);
+	for (int i = 0; i < 2; i++) {
+		ep_free(_p[i]);
+		ep_free(_q[i]);
+	}
 	return code;
 }
 
@@ -663,6 +739,9 @@ static int pairing12(void) {
 	ep_t p;
 	ep2_t q, r;
 	fp12_t e1, e2;
+	ep_t _p[2];
+	ep2_t _q[2];
+	fp2_t t[PP_TABLE];
 
 	bn_null(k);
 	bn_null(n);
@@ -671,6 +750,13 @@ static int pairing12(void) {
 	ep2_null(r);
 	fp12_null(e1);
 	fp12_null(e2);
+	for (int i = 0; i < 2; i++) {
+		ep_null(_p[i]);
+		ep2_null(_q[i]);
+	}
+	for (int i = 0; i < PP_TABLE; i++) {
+		fp2_null(t[i]);
+	}
 
 	TRY {
 		bn_new(n);
@@ -680,6 +766,13 @@ static int pairing12(void) {
 		ep2_new(r);
 		fp12_new(e1);
 		fp12_new(e2);
+		for (int i = 0; i < 2; i++) {
+			ep_new(_p[i]);
+			ep2_new(_q[i]);
+		}
+		for (int i = 0; i < PP_TABLE; i++) {
+			fp2_new(t[i]);
+		}
 
 		ep_curve_get_ord(n);
 
@@ -719,6 +812,28 @@ static int pairing12(void) {
 			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
 		} TEST_END;
 
+		TEST_BEGIN("multi-pairing is correct") {
+			ep_rand(_p[0]);
+			ep_rand(_p[1]);
+			ep2_rand(_q[0]);
+			ep2_rand(_q[1]);
+			pp_map_k12(e1, _p[0], _q[0]);
+			pp_map_k12(e2, _p[1], _q[1]);
+			fp12_mul(e1, e1, e2);
+			pp_map_sim_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+			ep_set_infty(_p[1]);
+			pp_map_k12(e1, _p[0], _q[0]);
+			pp_map_sim_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+			ep_neg(_p[1], _p[0]);
+			ep2_copy(_q[1], _q[0]);
+			pp_map_sim_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == CMP_EQ, end);
+			pp_map_sim_k12(e2, _p, _q, 0);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == CMP_EQ, end);
+		} TEST_END;
+
 #if PP_MAP == TATEP || !defined(STRIP)
 		TEST_BEGIN("tate pairing non-degeneracy is correct") {
 			ep_rand(p);
@@ -755,6 +870,26 @@ static int pairing12(void) {
 			fp12_sqr(e1, e1);
 			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("tate multi-pairing is correct") {
+			ep_rand(_p[0]);
+			ep_rand(_p[1]);
+			ep2_rand(_q[0]);
+			ep2_rand(_q[1]);
+			pp_map_tatep_k12(e1, _p[0], _q[0]);
+			pp_map_tatep_k12(e2, _p[1], _q[1]);
+			fp12_mul(e1, e1, e2);
+			pp_map_sim_tatep_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+			ep_set_infty(_p[1]);
+			pp_map_tatep_k12(e1, _p[0], _q[0]);
+			pp_map_sim_tatep_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+			ep_neg(_p[1], _p[0]);
+			ep2_copy(_q[1], _q[0]);
+			pp_map_sim_tatep_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == CMP_EQ, end);
+		} TEST_END;
 #endif
 
 #if PP_MAP == WEIL || !defined(STRIP)
@@ -793,6 +928,26 @@ static int pairing12(void) {
 			fp12_sqr(e1, e1);
 			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("weil multi-pairing is correct") {
+			ep_rand(_p[0]);
+			ep_rand(_p[1]);
+			ep2_rand(_q[0]);
+			ep2_rand(_q[1]);
+			pp_map_weilp_k12(e1, _p[0], _q[0]);
+			pp_map_weilp_k12(e2, _p[1], _q[1]);
+			fp12_mul(e1, e1, e2);
+			pp_map_sim_weilp_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+			ep_set_infty(_p[1]);
+			pp_map_weilp_k12(e1, _p[0], _q[0]);
+			pp_map_sim_weilp_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+			ep_neg(_p[1], _p[0]);
+			ep2_copy(_q[1], _q[0]);
+			pp_map_sim_weilp_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == CMP_EQ, end);
+		} TEST_END;
 #endif
 
 #if PP_MAP == OATEP || !defined(STRIP)
@@ -828,6 +983,47 @@ static int pairing12(void) {
 			fp12_sqr(e1, e1);
 			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
 		} TEST_END;
+
+		TEST_BEGIN("optimal ate multi-pairing is correct") {
+			ep_rand(_p[0]);
+			ep_rand(_p[1]);
+			ep2_rand(_q[0]);
+			ep2_rand(_q[1]);
+			pp_map_oatep_k12(e1, _p[0], _q[0]);
+			pp_map_oatep_k12(e2, _p[1], _q[1]);
+			fp12_mul(e1, e1, e2);
+			pp_map_sim_oatep_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+			ep_set_infty(_p[1]);
+			pp_map_oatep_k12(e1, _p[0], _q[0]);
+			pp_map_sim_oatep_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+			ep_neg(_p[1], _p[0]);
+			ep2_copy(_q[1], _q[0]);
+			pp_map_sim_oatep_k12(e2, _p, _q, 2);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == CMP_EQ, end);
+		} TEST_END;
+
+		TEST_BEGIN("optimal ate pairing with precomputation is correct") {
+			ep_rand(p);
+			ep2_rand(q);
+			pp_map_oatep_k12(e1, p, q);
+			pp_map_pre_oatep_k12(t, q);
+			pp_map_fix_oatep_k12(e2, p, t);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+			ep_rand(p);
+			pp_map_oatep_k12(e1, p, q);
+			pp_map_fix_oatep_k12(e2, p, t);
+			TEST_ASSERT(fp12_cmp(e1, e2) == CMP_EQ, end);
+			ep_set_infty(p);
+			pp_map_fix_oatep_k12(e2, p, t);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == CMP_EQ, end);
+			ep_rand(p);
+			ep2_set_infty(q);
+			pp_map_pre_oatep_k12(t, q);
+			pp_map_fix_oatep_k12(e2, p, t);
+			TEST_ASSERT(fp12_cmp_dig(e2, 1) == CMP_EQ, end);
+		} TEST_END;
 #endif
 	}
 	CATCH_ANY {
@@ -843,6 +1039,13 @@ static int pairing12(void) {
 	ep2_free(r);
 	fp12_free(e1);
 	fp12_free(e2);
+	for (int i = 0; i < 2; i++) {
+		ep_free(_p[i]);
+		ep2_free(_q[i]);
+	}
+	for (int i = 0; i < PP_TABLE; i++) {
+		fp2_free(t[i]);
+	}
 	return code;
 }
 
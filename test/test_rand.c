@@ -367,6 +367,100 @@ static int test(void) {
 	return code;
 }
 
+#elif RAND == CTR
+
+/*
+ * Test vectors generated from the entropy input and nonce of COUNT = 0 of
+ * the AES-256 with derivation function test of the NIST CAVP, since the
+ * returned bytes are buffered across requests:
+ * - http://csrc.nist.gov/groups/STM/cavp/documents/drbg/drbgtestvectors.zip
+ */
+
+uint8_t seed1[] = {
+	0x36, 0x40, 0x19, 0x40, 0xFA, 0x8B, 0x1F, 0xBA, 0x91, 0xA1,
+	0x66, 0x1F, 0x21, 0x1D, 0x78, 0xA0, 0xB9, 0x38, 0x9A, 0x74,
+	0xE5, 0xBC, 0xCF, 0xEC, 0xE8, 0xD7, 0x66, 0xAF, 0x1A, 0x6D,
+	0x3B, 0x14, 0x49, 0x6F, 0x25, 0xB0, 0xF1, 0x30, 0x1B, 0x4F,
+	0x50, 0x1B, 0xE3, 0x03, 0x80, 0xA1, 0x37, 0xEB,
+};
+
+uint8_t result1[] = {
+	0x52, 0x79, 0xBF, 0xCD, 0x3A, 0x2C, 0x40, 0xBC, 0x9B, 0x74,
+	0xAB, 0x17, 0x51, 0xBC, 0x91, 0xEB, 0x0A, 0x84, 0x27, 0x6E,
+	0xBC, 0xA0, 0x49, 0x33, 0xC9, 0x2B, 0xB9, 0xF5, 0x65, 0xDD,
+	0x91, 0x81, 0x9E, 0x65, 0x60, 0x09, 0xB4, 0xD9, 0x32, 0x7E,
+	0xDC, 0x5C, 0x77, 0x7E, 0xE2, 0xE0, 0x5A, 0x27, 0xD9, 0xBF,
+	0xD2, 0x6A, 0xB7, 0xA0, 0xBF, 0x2C, 0x68, 0x9E, 0xE3, 0x58,
+	0xD2, 0x98, 0x2D, 0xE1,
+};
+
+uint8_t result2[] = {
+	0xED, 0xF8, 0xD5, 0xFE, 0xEE, 0xBE, 0xA9, 0x09, 0x5D, 0x4E,
+	0x17, 0x1C, 0x0E, 0x88, 0xE5, 0xD3, 0x1A, 0x1F, 0xE6, 0x72,
+	0xA7, 0xCF, 0x46, 0x7A, 0x71, 0xCD, 0x32, 0xAF, 0xF1, 0xFD,
+	0x38, 0x68, 0x14, 0x0A, 0x60, 0xC2, 0x90, 0xAB, 0x4D, 0x2B,
+	0x36, 0x73, 0xDC, 0x4A, 0x02, 0x37, 0x9B, 0x68, 0x95, 0xAD,
+	0xB6, 0x30, 0x54, 0x27, 0x83, 0x45, 0x2F, 0xFE, 0x0C, 0x8A,
+	0x8C, 0x6E, 0x65, 0xF3,
+};
+
+uint8_t result3[] = {
+	0x60, 0x5E, 0x3F, 0x02, 0xB4, 0xBB, 0x24, 0xFD, 0xEA, 0x4C,
+	0x5E, 0x3B, 0x0D, 0xA4, 0x94, 0x59, 0x61, 0xB3, 0xE8, 0xB3,
+	0xD1, 0x84, 0x52, 0xCB, 0xB3, 0xFB, 0xCF, 0x2B, 0x84, 0x31,
+	0x00, 0x40, 0xD4, 0xEF, 0xA6, 0x8F, 0x86, 0xE6, 0x8C, 0x7E,
+	0x30, 0xAE, 0x5A, 0x95, 0x1C, 0x66, 0x83, 0x8A, 0x01, 0x1B,
+	0x15, 0x75, 0x5E, 0x63, 0x0E, 0x26, 0x52, 0x06, 0x5E, 0xC4,
+	0x5E, 0x95, 0xA3, 0x3F,
+};
+
+static int test(void) {
+	int i, code = STS_ERR;
+	uint8_t out[RAND_BUF + 64], seed2[48];
+
+	for (i = 0; i < sizeof(seed2); i++) {
+		seed2[i] = i;
+	}
+
+	TEST_ONCE("ctr-drbg (aes-256) random generator is correct") {
+		rand_clean();
+		rand_seed(seed1, sizeof(seed1));
+		rand_bytes(out, 64);
+		TEST_ASSERT(memcmp(out, result1, 64) == 0, end);
+		rand_clean();
+		rand_seed(seed1, sizeof(seed1));
+		rand_bytes(out, RAND_BUF + 64);
+		TEST_ASSERT(memcmp(out, result1, 64) == 0, end);
+		TEST_ASSERT(memcmp(out + RAND_BUF, result2, 64) == 0, end);
+	}
+	TEST_END;
+
+	TEST_ONCE("ctr-drbg (aes-256) reseeding is correct") {
+		rand_clean();
+		rand_seed(seed1, sizeof(seed1));
+		rand_seed(seed2, sizeof(seed2));
+		rand_bytes(out, 64);
+		TEST_ASSERT(memcmp(out, result3, 64) == 0, end);
+	}
+	TEST_END;
+
+	TEST_ONCE("ctr-drbg (aes-256) buffered output is consistent") {
+		rand_clean();
+		rand_seed(seed1, sizeof(seed1));
+		for (i = 0; i < RAND_BUF + 64; i += 24) {
+			rand_bytes(out + i, MIN(24, RAND_BUF + 64 - i));
+		}
+		TEST_ASSERT(memcmp(out, result1, 64) == 0, end);
+		TEST_ASSERT(memcmp(out + RAND_BUF, result2, 64) == 0, end);
+	}
+	TEST_END;
+
+	code = STS_OK;
+
+  end:
+	return code;
+}
+
 #elif RAND == FIPS
 
 /*